@@ -161,6 +161,7 @@ public:
 //                      - TopImage
 //                      - DstImage
 //                      - BlendingFunctor
+//                      - maxNumOfThreads
 //
 // TEMPLATE ARGUMENTS:  - blDataType
 //                      - blBlendingFunctorType
@@ -187,18 +188,25 @@ public:
 //                      - The user specifies the type of
 //                        variable used to do the calculations,
 //                        for example:  float or double or whatever.
+//                      - The blending functor is called concurrently
+//                        from the threads of the shared thread pool,
+//                        so it has to be thread safe (a functor with
+//                        state that isn't should pass a
+//                        maxNumOfThreads of 1 to run on the calling
+//                        thread only, 0 uses the pool's setting)
 //-------------------------------------------------------------------
 template<typename blDataType,typename blBlendingFunctorType>
 inline void blBlendIgnoringROIs(const blImage<blDataType>& BottomImage,
                                 const blImage<blDataType>& TopImage,
                                 blImage<blDataType>& DstImage,
-                                const blBlendingFunctorType& BlendingFunctor)
+                                const blBlendingFunctorType& BlendingFunctor,
+                                const int& maxNumOfThreads = 0)
 {
     // Get the min and max values
     // representable by the image
     // type
-    double MinValue = rangeMin(DstImage.GetDepth());
-    double MaxValue = rangeMax(DstImage.GetDepth());
+    double MinValue = rangeMin(DstImage.getDepth());
+    double MaxValue = rangeMax(DstImage.getDepth());
     double Range = MaxValue - MinValue;
 
     // Calculate the number of
@@ -212,19 +220,24 @@ inline void blBlendIgnoringROIs(const blImage<blDataType>& BottomImage,
 
     // Step through the destination
     // image and calculate the
-    // corresponsind pixels
-    for(int i = 0; i < Rows; ++i)
+    // corresponsind pixels, one
+    // tile at a time using the
+    // shared thread pool
+    parallelForTiles(Rows,Cols,[&](const blImageTile& tile)
     {
-        for(int j = 0; j < Cols; ++j)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            MyBlendingFunctor(BottomImage[i][j],
-                              TopImage[i][j],
-                              DstImage[i][j],
-                              MinValue,
-                              Range,
-                              BlendingFunctor);
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+            {
+                MyBlendingFunctor(BottomImage[i][j],
+                                  TopImage[i][j],
+                                  DstImage[i][j],
+                                  MinValue,
+                                  Range,
+                                  BlendingFunctor);
+            }
         }
-    }
+    },0,0,maxNumOfThreads);
 }
 //-------------------------------------------------------------------
 
@@ -238,6 +251,7 @@ inline void blBlendIgnoringROIs(const blImage<blDataType>& BottomImage,
 //                      - BlendingFunctor
 //                      - BottomImageOffsetToDstImage
 //                      - TopImageOffsetToDstImage
+//                      - maxNumOfThreads
 //
 // TEMPLATE ARGUMENTS:  - blDataType
 //                      - blBlendingFunctorType
@@ -267,6 +281,11 @@ inline void blBlendIgnoringROIs(const blImage<blDataType>& BottomImage,
 //                      - The user specifies the type of
 //                        variable used to do the calculations,
 //                        for example:  float or double or whatever.
+//                      - The blending functor is called concurrently
+//                        from the threads of the shared thread pool,
+//                        so it has to be thread safe (pass a
+//                        maxNumOfThreads of 1 to blend on the calling
+//                        thread only)
 //-------------------------------------------------------------------
 template<typename blDataType,typename blBlendingFunctorType>
 inline void blBlend(const blImage<blDataType>& BottomImage,
@@ -274,64 +293,70 @@ inline void blBlend(const blImage<blDataType>& BottomImage,
                     blImage<blDataType>& DstImage,
                     const blBlendingFunctorType& BlendingFunctor,
                     const CvPoint& BottomImageOffsetToDstImage = cvPoint(0,0),
-                    const CvPoint& TopImageOffsetToDstImage = cvPoint(0,0))
+                    const CvPoint& TopImageOffsetToDstImage = cvPoint(0,0),
+                    const int& maxNumOfThreads = 0)
 {
     // Get the min and max values
     // representable by the image
     // type
-    double MinValue = rangeMin(DstImage.GetDepth());
-    double MaxValue = rangeMin(DstImage.GetDepth());
+    double MinValue = rangeMin(DstImage.getDepth());
+    double MaxValue = rangeMax(DstImage.getDepth());
     double Range = MaxValue - MinValue;
 
     // Find the ROI of the
     // destination image
-    CvRect DstROI = DstImage.GetROI();
+    CvRect DstROI = DstImage.getROIRect();
 
     // Step through the destination
     // image ROI and calculate the
-    // corresponding pixels
-    for(int i = DstROI.y; i < DstROI.height; ++i)
+    // corresponding pixels, one
+    // tile at a time using the
+    // shared thread pool
+    parallelForTiles(DstROI.height,DstROI.width,[&](const blImageTile& tile)
     {
-        for(int j = DstROI.x; j < DstROI.width; ++j)
+        for(int i = DstROI.y + tile.m_row; i < DstROI.y + tile.m_row + tile.m_numOfRows; ++i)
         {
-            if(BottomImage.DoesIndexPointToPixelInImageROI(i + BottomImageOffsetToDstImage.y,j + BottomImageOffsetToDstImage.x) &&
-               TopImage.DoesIndexPointToPixelInImageROI(i + TopImageOffsetToDstImage.y,j + TopImageOffsetToDstImage.x))
-            {
-                // In this case, the current
-                // index is pointing at pixels
-                // from both the top and bottom
-                // images, therefore we calculate
-                // the blended pixel
-                BlendingFunctor(BottomImage[i + BottomImageOffsetToDstImage.y][j + BottomImageOffsetToDstImage.x],
-                                TopImage[i + TopImageOffsetToDstImage.y][j + TopImageOffsetToDstImage.x],
-                                DstImage[i][j],
-                                MinValue,
-                                Range);
-            }
-            else if(BottomImage.DoesIndexPointToPixelInImageROI(i + BottomImageOffsetToDstImage.y,j + BottomImageOffsetToDstImage.x))
+            for(int j = DstROI.x + tile.m_col; j < DstROI.x + tile.m_col + tile.m_numOfCols; ++j)
             {
-                // In this case, only the
-                // bottom image is being indexed
-                // therefore, we simply assign
-                // its pixel to the destination
-                // image
-                DstImage[i][j] = BottomImage[i + BottomImageOffsetToDstImage.y][j + BottomImageOffsetToDstImage.x];
+                if(BottomImage.doesIndexPointToPixelInImageROI(i + BottomImageOffsetToDstImage.y,j + BottomImageOffsetToDstImage.x) &&
+                   TopImage.doesIndexPointToPixelInImageROI(i + TopImageOffsetToDstImage.y,j + TopImageOffsetToDstImage.x))
+                {
+                    // In this case, the current
+                    // index is pointing at pixels
+                    // from both the top and bottom
+                    // images, therefore we calculate
+                    // the blended pixel
+                    BlendingFunctor(BottomImage[i + BottomImageOffsetToDstImage.y][j + BottomImageOffsetToDstImage.x],
+                                    TopImage[i + TopImageOffsetToDstImage.y][j + TopImageOffsetToDstImage.x],
+                                    DstImage[i][j],
+                                    MinValue,
+                                    Range);
+                }
+                else if(BottomImage.doesIndexPointToPixelInImageROI(i + BottomImageOffsetToDstImage.y,j + BottomImageOffsetToDstImage.x))
+                {
+                    // In this case, only the
+                    // bottom image is being indexed
+                    // therefore, we simply assign
+                    // its pixel to the destination
+                    // image
+                    DstImage[i][j] = BottomImage[i + BottomImageOffsetToDstImage.y][j + BottomImageOffsetToDstImage.x];
+                }
+                else if(TopImage.doesIndexPointToPixelInImageROI(i + TopImageOffsetToDstImage.y,j + TopImageOffsetToDstImage.x))
+                {
+                    // In this case, only the
+                    // top image is being indexed
+                    // therefore, we simply assign
+                    // its pixel to the destination
+                    // image
+                    DstImage[i][j] = TopImage[i + TopImageOffsetToDstImage.y][j + TopImageOffsetToDstImage.x];
+                }
+
+                // If none of the above cases is
+                // true, we simply leave the
+                // destination image pixel as is
             }
-            else if(BottomImage.DoesIndexPointToPixelInImageROI(i + BottomImageOffsetToDstImage.y,j + BottomImageOffsetToDstImage.x))
-            {
-                // In this case, only the
-                // top image is being indexed
-                // therefore, we simply assign
-                // its pixel to the destination
-                // image
-                DstImage[i][j] = TopImage[i + TopImageOffsetToDstImage.y][j + TopImageOffsetToDstImage.x];
-            }
-
-            // If none of the above cases is
-            // true, we simply leave the
-            // destination image pixel as is
         }
-    }
+    },0,0,maxNumOfThreads);
 }
 //-------------------------------------------------------------------
 
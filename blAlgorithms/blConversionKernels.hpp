@@ -0,0 +1,1218 @@
+#ifndef BL_CONVERSIONKERNELS_HPP
+#define BL_CONVERSIONKERNELS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blConversionKernels.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         - A conversion engine used to convert an image
+//                    into an image of a different depth and/or a
+//                    different number of channels
+//                  - The source depth, the destination depth and
+//                    the channel mapping are resolved only once
+//                    per image into a templated row kernel, which
+//                    is then run over bands of rows using the
+//                    shared thread pool (parallelForTiles)
+//                  - The generic row kernels are templated on the
+//                    source type and channel mapping and write
+//                    blocks of double values through a function
+//                    picked for the destination depth, which keeps
+//                    the number of kernels (and compile times) low
+//                  - Unsigned char to unsigned char conversions
+//                    as well as unsigned char to/from float
+//                    conversions use vectorized (SSE2/AVX2)
+//                    row kernels
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blConversions (rangeMax and the scale/shift
+//                    parameters)
+//                  - blParallelForTiles
+//                  - blSimdKernels (instruction set detection)
+//
+// NOTES:           - The channel mappings are the same ones used by
+//                    the per-pixel functions in blConversions:
+//                    - 3 or 4 channels to 1 or 2 channels uses the
+//                      gray value 0.114*B + 0.587*G + 0.299*R
+//                    - 2 channels (complex) to 1, 3 or 4 channels
+//                      uses the real part, the imaginary part or
+//                      the magnitude
+//                    - 1 channel to 2, 3 or 4 channels replicates
+//                      the value
+//                    - The alpha channel is set to the max value
+//                      of the destination depth
+//                  - Integer destinations are rounded and saturated
+//                    (like cvConvertScale does), while the old
+//                    per-pixel functions truncated the values
+//                  - Unsigned char gray values use 14 bit fixed
+//                    point weights so that the vectorized kernels
+//                    and the scalar tails give the same results
+//                  - Unsigned char/float conversions are carried
+//                    out in single precision
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The parameters shared by all
+// the row kernels
+//-------------------------------------------------------------------
+typedef void (*blWriteConvertedValuesFunction)(const double* values,
+                                               char* dstRow,
+                                               const int& numOfValues);
+
+
+struct blConversionParameters
+{
+    double                                      m_scale;
+    double                                      m_shift;
+    double                                      m_alphaValue;
+    int                                         m_complexMode;
+
+    // Function used by the generic
+    // row kernels to write their
+    // values in the destination row
+
+    blWriteConvertedValuesFunction              m_writeConvertedValues;
+    int                                         m_dstElementSize;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the row kernels
+// - The number of columns is the
+//   number of pixels in the row
+//-------------------------------------------------------------------
+typedef void (*blConvertRowFunction)(const char* srcRow,
+                                     char* dstRow,
+                                     const int& numOfCols,
+                                     const blConversionParameters& parameters);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to convert a value to
+// the destination type, rounding and
+// saturating it for integer types
+//-------------------------------------------------------------------
+template<typename blDstType>
+
+inline blDstType convertAndSaturateValue(const double& value,std::true_type)
+{
+    if(!(value > double(std::numeric_limits<blDstType>::min())))
+        return std::numeric_limits<blDstType>::min();
+
+    if(!(value < double(std::numeric_limits<blDstType>::max())))
+        return std::numeric_limits<blDstType>::max();
+
+    return static_cast<blDstType>( (value >= 0) ? (value + 0.5) : (value - 0.5) );
+}
+
+
+template<typename blDstType>
+
+inline blDstType convertAndSaturateValue(const double& value,std::false_type)
+{
+    return static_cast<blDstType>(value);
+}
+
+
+template<typename blDstType>
+
+inline blDstType convertAndSaturate(const double& value)
+{
+    return convertAndSaturateValue<blDstType>(value,
+                                              std::integral_constant<bool,
+                                                                     std::is_integral<blDstType>::value &&
+                                                                     !std::is_same<blDstType,bool>::value>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to read the single
+// value that a 1, 2 (complex) or 3/4
+// channel pixel is converted into
+// when the destination has a different
+// number of channels
+//-------------------------------------------------------------------
+template<typename blSrcType,int srcChannels>
+
+inline double getConversionValue(const blSrcType* src,
+                                 const blConversionParameters& parameters)
+{
+    if(srcChannels == 1)
+        return double(src[0]) * parameters.m_scale + parameters.m_shift;
+
+    if(srcChannels == 2)
+    {
+        if(parameters.m_complexMode == 1)
+            return double(src[1]) * parameters.m_scale + parameters.m_shift;
+
+        double realPart = double(src[0]) * parameters.m_scale + parameters.m_shift;
+
+        if(parameters.m_complexMode == 2)
+        {
+            double imaginaryPart = double(src[1]) * parameters.m_scale + parameters.m_shift;
+
+            return std::sqrt(realPart * realPart + imaginaryPart * imaginaryPart);
+        }
+
+        return realPart;
+    }
+
+    return ( 0.114 * double(src[0]) +
+             0.587 * double(src[1]) +
+             0.299 * double(src[2]) ) * parameters.m_scale + parameters.m_shift;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to compute the unsigned
+// char gray value of a 3/4 channel pixel
+// with fixed point weights
+// (1868 + 9617 + 4899 = 2^14)
+//-------------------------------------------------------------------
+inline unsigned char getUnsignedCharGrayValue(const unsigned char* src)
+{
+    return static_cast<unsigned char>( (1868 * int(src[0]) +
+                                        9617 * int(src[1]) +
+                                        4899 * int(src[2]) +
+                                        8192) >> 14 );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following helpers are used by
+// the vectorized unsigned char kernels
+// - Four bgr pixels are loaded as four
+//   32 bit lanes (the highest byte of
+//   each lane is garbage and reads two
+//   pixels past the fourth one)
+// - Eight bgrx lanes are converted to
+//   eight 16 bit gray values
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+inline __m128i loadFourBGRPixelsSSE2(const unsigned char* src)
+{
+    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    __m128i pixels01 = _mm_unpacklo_epi32(values,_mm_srli_si128(values,3));
+    __m128i pixels23 = _mm_unpacklo_epi32(_mm_srli_si128(values,6),_mm_srli_si128(values,9));
+
+    return _mm_unpacklo_epi64(pixels01,pixels23);
+}
+
+
+inline __m128i getGrayValuesSSE2(const __m128i& pixels0,
+                                 const __m128i& pixels1)
+{
+    __m128i byteMask = _mm_set1_epi32(0xFF);
+    __m128i ones = _mm_set1_epi16(1);
+    __m128i weightsBG = _mm_set1_epi32((9617 << 16) | 1868);
+    __m128i weightsR1 = _mm_set1_epi32((8192 << 16) | 4899);
+
+    __m128i b = _mm_packs_epi32(_mm_and_si128(pixels0,byteMask),
+                                _mm_and_si128(pixels1,byteMask));
+    __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(pixels0,8),byteMask),
+                                _mm_and_si128(_mm_srli_epi32(pixels1,8),byteMask));
+    __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(pixels0,16),byteMask),
+                                _mm_and_si128(_mm_srli_epi32(pixels1,16),byteMask));
+
+    __m128i grayLow = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(b,g),weightsBG),
+                                    _mm_madd_epi16(_mm_unpacklo_epi16(r,ones),weightsR1));
+    __m128i grayHigh = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(b,g),weightsBG),
+                                     _mm_madd_epi16(_mm_unpackhi_epi16(r,ones),weightsR1));
+
+    return _mm_packs_epi32(_mm_srli_epi32(grayLow,14),
+                           _mm_srli_epi32(grayHigh,14));
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following vectorized kernels
+// process sixteen pixels at a time,
+// they return the number of pixels
+// processed, leaving the tail to
+// the caller
+// - Apart from the gray values, which
+//   are compute bound, conversions are
+//   memory bound, so 128 bit vectors are
+//   used even when avx2 is available
+// - The kernels that need byte shuffles
+//   use ssse3, so they are only called
+//   when avx2 (which implies ssse3) is
+//   the instruction set in use
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+template<int srcChannels,int dstChannels>
+
+inline int convertRowToGraySSE2(const unsigned char* src,
+                                unsigned char* dst,
+                                const int& numOfCols)
+{
+    // Bgr rows read two pixels
+    // past the ones converted
+
+    int numOfExtraCols = (srcChannels == 3) ? 2 : 0;
+
+    int j = 0;
+
+    for(; j + 16 + numOfExtraCols <= numOfCols; j += 16)
+    {
+        __m128i pixels[4];
+
+        for(int k = 0; k < 4; ++k)
+        {
+            if(srcChannels == 3)
+                pixels[k] = loadFourBGRPixelsSSE2(src + 3 * (j + 4 * k));
+            else
+                pixels[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * (j + 4 * k)));
+        }
+
+        __m128i grayValues = _mm_packus_epi16(getGrayValuesSSE2(pixels[0],pixels[1]),
+                                              getGrayValuesSSE2(pixels[2],pixels[3]));
+
+        if(dstChannels == 1)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j),grayValues);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j),_mm_unpacklo_epi8(grayValues,grayValues));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j + 16),_mm_unpackhi_epi8(grayValues,grayValues));
+        }
+    }
+
+    return j;
+}
+
+
+template<int srcChannels,int dstChannels>
+
+BL_SIMD_TARGET_AVX2 inline int convertRowToGrayAVX2(const unsigned char* src,
+                                                    unsigned char* dst,
+                                                    const int& numOfCols)
+{
+    // The shuffles spread the colors of
+    // two pixels per 128 bit lane into
+    // 16 bit values, so that one madd
+    // and one hadd give the gray values
+
+    __m256i shuffle01;
+    __m256i shuffle23;
+
+    if(srcChannels == 3)
+    {
+        shuffle01 = _mm256_setr_epi8(0,-1,1,-1,2,-1,-1,-1,3,-1,4,-1,5,-1,-1,-1,
+                                     0,-1,1,-1,2,-1,-1,-1,3,-1,4,-1,5,-1,-1,-1);
+        shuffle23 = _mm256_setr_epi8(6,-1,7,-1,8,-1,-1,-1,9,-1,10,-1,11,-1,-1,-1,
+                                     6,-1,7,-1,8,-1,-1,-1,9,-1,10,-1,11,-1,-1,-1);
+    }
+    else
+    {
+        shuffle01 = _mm256_setr_epi8(0,-1,1,-1,2,-1,-1,-1,4,-1,5,-1,6,-1,-1,-1,
+                                     0,-1,1,-1,2,-1,-1,-1,4,-1,5,-1,6,-1,-1,-1);
+        shuffle23 = _mm256_setr_epi8(8,-1,9,-1,10,-1,-1,-1,12,-1,13,-1,14,-1,-1,-1,
+                                     8,-1,9,-1,10,-1,-1,-1,12,-1,13,-1,14,-1,-1,-1);
+    }
+
+    __m256i weights = _mm256_setr_epi16(1868,9617,4899,0,1868,9617,4899,0,
+                                        1868,9617,4899,0,1868,9617,4899,0);
+    __m256i rounding = _mm256_set1_epi32(8192);
+
+    // Bgr rows read two pixels
+    // past the ones converted
+
+    int numOfExtraCols = (srcChannels == 3) ? 2 : 0;
+
+    int j = 0;
+
+    for(; j + 16 + numOfExtraCols <= numOfCols; j += 16)
+    {
+        __m256i grayValues[2];
+
+        for(int k = 0; k < 2; ++k)
+        {
+            // Eight pixels, four
+            // per 128 bit lane
+
+            const unsigned char* pixels = src + srcChannels * (j + 8 * k);
+
+            __m256i values = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels))),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 4 * srcChannels)),
+                                                     1);
+
+            __m256i sums = _mm256_hadd_epi32(_mm256_madd_epi16(_mm256_shuffle_epi8(values,shuffle01),weights),
+                                             _mm256_madd_epi16(_mm256_shuffle_epi8(values,shuffle23),weights));
+
+            grayValues[k] = _mm256_srli_epi32(_mm256_add_epi32(sums,rounding),14);
+        }
+
+        // Put the 16 bit values
+        // back in order before
+        // packing them to bytes
+
+        __m256i grayValues16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(grayValues[0],grayValues[1]),0xD8);
+
+        __m128i grayValues8 = _mm_packus_epi16(_mm256_castsi256_si128(grayValues16),
+                                               _mm256_extracti128_si256(grayValues16,1));
+
+        if(dstChannels == 1)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j),grayValues8);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j),_mm_unpacklo_epi8(grayValues8,grayValues8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j + 16),_mm_unpackhi_epi8(grayValues8,grayValues8));
+        }
+    }
+
+    return j;
+}
+
+
+inline int convertRowFrom1To2ChannelsSSE2(const unsigned char* src,
+                                          unsigned char* dst,
+                                          const int& numOfCols)
+{
+    int j = 0;
+
+    for(; j + 16 <= numOfCols; j += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j),_mm_unpacklo_epi8(values,values));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * j + 16),_mm_unpackhi_epi8(values,values));
+    }
+
+    return j;
+}
+
+
+inline int convertRowFrom1To4ChannelsSSE2(const unsigned char* src,
+                                          unsigned char* dst,
+                                          const int& numOfCols,
+                                          const unsigned char& alphaValue)
+{
+    __m128i alphaValues = _mm_set1_epi8(char(alphaValue));
+
+    int j = 0;
+
+    for(; j + 16 <= numOfCols; j += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j));
+
+        __m128i valueValueLow = _mm_unpacklo_epi8(values,values);
+        __m128i valueValueHigh = _mm_unpackhi_epi8(values,values);
+        __m128i valueAlphaLow = _mm_unpacklo_epi8(values,alphaValues);
+        __m128i valueAlphaHigh = _mm_unpackhi_epi8(values,alphaValues);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j),_mm_unpacklo_epi16(valueValueLow,valueAlphaLow));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j + 16),_mm_unpackhi_epi16(valueValueLow,valueAlphaLow));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j + 32),_mm_unpacklo_epi16(valueValueHigh,valueAlphaHigh));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j + 48),_mm_unpackhi_epi16(valueValueHigh,valueAlphaHigh));
+    }
+
+    return j;
+}
+
+
+inline int convertRowFrom3To4ChannelsSSE2(const unsigned char* src,
+                                          unsigned char* dst,
+                                          const int& numOfCols,
+                                          const unsigned char& alphaValue)
+{
+    __m128i colorMask = _mm_set1_epi32(0x00FFFFFF);
+    __m128i alphaValues = _mm_set1_epi32(int(unsigned(alphaValue) << 24));
+
+    int j = 0;
+
+    for(; j + 16 + 2 <= numOfCols; j += 16)
+    {
+        for(int k = 0; k < 4; ++k)
+        {
+            __m128i pixels = loadFourBGRPixelsSSE2(src + 3 * (j + 4 * k));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * (j + 4 * k)),
+                             _mm_or_si128(_mm_and_si128(pixels,colorMask),alphaValues));
+        }
+    }
+
+    return j;
+}
+
+
+inline int convertRowFromUnsignedCharToFloatSSE2(const unsigned char* src,
+                                                 float* dst,
+                                                 const int& numOfElements,
+                                                 const float& scale,
+                                                 const float& shift)
+{
+    __m128 scaleValues = _mm_set1_ps(scale);
+    __m128 shiftValues = _mm_set1_ps(shift);
+
+    int i = 0;
+
+    for(; i + 16 <= numOfElements; i += 16)
+    {
+        __m128 values[4];
+
+        unpackUnsignedCharToFloatSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),values);
+
+        for(int k = 0; k < 4; ++k)
+            _mm_storeu_ps(dst + i + 4 * k,_mm_add_ps(_mm_mul_ps(values[k],scaleValues),shiftValues));
+    }
+
+    return i;
+}
+
+
+inline int convertRowFromFloatToUnsignedCharSSE2(const float* src,
+                                                 unsigned char* dst,
+                                                 const int& numOfElements,
+                                                 const float& scale,
+                                                 const float& shift)
+{
+    // The min (which also turns NaN
+    // into 255) and max saturate the
+    // values before rounding them
+
+    __m128 scaleValues = _mm_set1_ps(scale);
+    __m128 shiftValues = _mm_set1_ps(shift);
+    __m128 minValue = _mm_setzero_ps();
+    __m128 maxValue = _mm_set1_ps(255.0f);
+
+    int i = 0;
+
+    for(; i + 16 <= numOfElements; i += 16)
+    {
+        __m128i values[4];
+
+        for(int k = 0; k < 4; ++k)
+        {
+            __m128 floatValues = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4 * k),scaleValues),shiftValues);
+
+            values[k] = _mm_cvtps_epi32(_mm_max_ps(_mm_min_ps(floatValues,maxValue),minValue));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_packus_epi16(_mm_packs_epi32(values[0],values[1]),
+                                          _mm_packs_epi32(values[2],values[3])));
+    }
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int convertRowFrom1To3ChannelsSSSE3(const unsigned char* src,
+                                                               unsigned char* dst,
+                                                               const int& numOfCols)
+{
+    __m128i shuffle0 = _mm_setr_epi8(0,0,0,1,1,1,2,2,2,3,3,3,4,4,4,5);
+    __m128i shuffle1 = _mm_setr_epi8(5,5,6,6,6,7,7,7,8,8,8,9,9,9,10,10);
+    __m128i shuffle2 = _mm_setr_epi8(10,11,11,11,12,12,12,13,13,13,14,14,14,15,15,15);
+
+    int j = 0;
+
+    for(; j + 16 <= numOfCols; j += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j),_mm_shuffle_epi8(values,shuffle0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j + 16),_mm_shuffle_epi8(values,shuffle1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j + 32),_mm_shuffle_epi8(values,shuffle2));
+    }
+
+    return j;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int convertRowFrom4To3ChannelsSSSE3(const unsigned char* src,
+                                                               unsigned char* dst,
+                                                               const int& numOfCols)
+{
+    // Each shuffle packs the colors
+    // of four pixels in the lowest
+    // twelve bytes
+
+    __m128i shuffle = _mm_setr_epi8(0,1,2,4,5,6,8,9,10,12,13,14,-1,-1,-1,-1);
+
+    int j = 0;
+
+    for(; j + 16 <= numOfCols; j += 16)
+    {
+        __m128i colors0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * j)),shuffle);
+        __m128i colors1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * j + 16)),shuffle);
+        __m128i colors2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * j + 32)),shuffle);
+        __m128i colors3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * j + 48)),shuffle);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j),
+                         _mm_or_si128(colors0,_mm_slli_si128(colors1,12)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j + 16),
+                         _mm_or_si128(_mm_srli_si128(colors1,4),_mm_slli_si128(colors2,8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * j + 32),
+                         _mm_or_si128(_mm_srli_si128(colors2,8),_mm_slli_si128(colors3,4)));
+    }
+
+    return j;
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures are used by
+// the row kernels to find out whether
+// a conversion has a vectorized kernel
+// and to run it
+// - They return the number of pixels
+//   converted, leaving the rest of the
+//   row to the scalar loops
+// - The vectorized kernels assume a unit
+//   scale and no shift, which is always
+//   the case between equal depths
+//-------------------------------------------------------------------
+template<typename blSrcType,typename blDstType,int srcChannels,int dstChannels>
+struct blSimdConversionKernel
+{
+    static int convert(const blSrcType*,blDstType*,const int&,const blConversionParameters&){return 0;}
+};
+
+
+template<int srcChannels,int dstChannels>
+struct blSimdGrayConversionKernel
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                j = convertRowToGrayAVX2<srcChannels,dstChannels>(src,dst,numOfCols);
+            else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = convertRowToGraySSE2<srcChannels,dstChannels>(src,dst,numOfCols);
+
+        #endif
+
+        // We finish the row here so
+        // that the tail also uses the
+        // fixed point weights
+
+        for(; j < numOfCols; ++j)
+        {
+            unsigned char grayValue = getUnsignedCharGrayValue(src + srcChannels * j);
+
+            dst[dstChannels * j] = grayValue;
+
+            if(dstChannels == 2)
+                dst[dstChannels * j + 1] = grayValue;
+        }
+
+        return numOfCols;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,3,1> : public blSimdGrayConversionKernel<3,1>{};
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,4,1> : public blSimdGrayConversionKernel<4,1>{};
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,3,2> : public blSimdGrayConversionKernel<3,2>{};
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,4,2> : public blSimdGrayConversionKernel<4,2>{};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,1,2>
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                return convertRowFrom1To2ChannelsSSE2(src,dst,numOfCols);
+
+        #endif
+
+        return 0;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,1,3>
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                return convertRowFrom1To3ChannelsSSSE3(src,dst,numOfCols);
+
+        #endif
+
+        return 0;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,1,4>
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                return convertRowFrom1To4ChannelsSSE2(src,dst,numOfCols,convertAndSaturate<unsigned char>(parameters.m_alphaValue));
+
+        #endif
+
+        return 0;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,3,4>
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                return convertRowFrom3To4ChannelsSSE2(src,dst,numOfCols,convertAndSaturate<unsigned char>(parameters.m_alphaValue));
+
+        #endif
+
+        return 0;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<unsigned char,unsigned char,4,3>
+{
+    static int convert(const unsigned char* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        if(parameters.m_scale != 1.0 || parameters.m_shift != 0.0)
+            return 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                return convertRowFrom4To3ChannelsSSSE3(src,dst,numOfCols);
+
+        #endif
+
+        return 0;
+    }
+};
+
+
+// The unsigned char/float kernels
+// finish the rows themselves, so that
+// the tails also use single precision
+// and the same rounding (to nearest
+// even) as the vectorized loops
+
+template<>
+struct blSimdConversionKernel<unsigned char,float,1,1>
+{
+    static int convert(const unsigned char* src,
+                       float* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        float scale = float(parameters.m_scale);
+        float shift = float(parameters.m_shift);
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = convertRowFromUnsignedCharToFloatSSE2(src,dst,numOfCols,scale,shift);
+
+        #endif
+
+        for(; j < numOfCols; ++j)
+            dst[j] = float(src[j]) * scale + shift;
+
+        return numOfCols;
+    }
+};
+
+
+template<>
+struct blSimdConversionKernel<float,unsigned char,1,1>
+{
+    static int convert(const float* src,
+                       unsigned char* dst,
+                       const int& numOfCols,
+                       const blConversionParameters& parameters)
+    {
+        float scale = float(parameters.m_scale);
+        float shift = float(parameters.m_shift);
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = convertRowFromFloatToUnsignedCharSSE2(src,dst,numOfCols,scale,shift);
+
+        #endif
+
+        for(; j < numOfCols; ++j)
+        {
+            float value = float(src[j]) * scale + shift;
+
+            if(!(value < 255.0f))
+                value = 255.0f;
+            else if(value < 0.0f)
+                value = 0.0f;
+
+            dst[j] = static_cast<unsigned char>(std::nearbyint(value));
+        }
+
+        return numOfCols;
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to write the values
+// produced by the row kernels into a
+// destination row
+//-------------------------------------------------------------------
+template<typename blDstType>
+
+inline void writeConvertedValues(const double* values,
+                                 char* dstRow,
+                                 const int& numOfValues)
+{
+    blDstType* dst = reinterpret_cast<blDstType*>(dstRow);
+
+    for(int i = 0; i < numOfValues; ++i)
+        dst[i] = convertAndSaturate<blDstType>(values[i]);
+}
+
+
+inline blWriteConvertedValuesFunction getWriteConvertedValuesFunction(const int& dstDepth)
+{
+    switch(dstDepth)
+    {
+    case IPL_DEPTH_1U: return &writeConvertedValues<bool>;
+    case IPL_DEPTH_8U: return &writeConvertedValues<unsigned char>;
+    case IPL_DEPTH_8S: return &writeConvertedValues<char>;
+    case IPL_DEPTH_16U: return &writeConvertedValues<unsigned short>;
+    case IPL_DEPTH_16S: return &writeConvertedValues<short>;
+    case IPL_DEPTH_32S: return &writeConvertedValues<int>;
+    case IPL_DEPTH_32F: return &writeConvertedValues<float>;
+    case IPL_DEPTH_64F: return &writeConvertedValues<double>;
+    }
+
+    return NULL;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The generic row kernel, templated on
+// the source type and on the channel
+// mapping
+// - It converts the pixels into a small
+//   buffer of double values (which stays
+//   in the cache) and lets the function
+//   picked for the destination depth
+//   write them, so that we don't need a
+//   kernel for each pair of depths
+// - Equal numbers of channels are
+//   converted as 1 channel rows that
+//   are numOfChannels times longer
+//-------------------------------------------------------------------
+template<typename blSrcType,int srcChannels,int dstChannels>
+
+inline void convertRowOfPixels(const char* srcRow,
+                               char* dstRow,
+                               const int& numOfCols,
+                               const blConversionParameters& parameters)
+{
+    static const int                            numOfPixelsPerBlock = 64;
+
+    double values[numOfPixelsPerBlock * dstChannels];
+
+    const blSrcType* src = reinterpret_cast<const blSrcType*>(srcRow);
+
+    int numOfColorChannels = (dstChannels < 3) ? dstChannels : 3;
+
+    for(int j = 0; j < numOfCols; j += numOfPixelsPerBlock)
+    {
+        int numOfPixels = std::min(numOfPixelsPerBlock,numOfCols - j);
+
+        double* value = values;
+
+        if(srcChannels == dstChannels)
+        {
+            // Same number of channels
+
+            for(int k = 0; k < numOfPixels * dstChannels; ++k, ++src, ++value)
+                (*value) = double(*src) * parameters.m_scale + parameters.m_shift;
+        }
+        else if(srcChannels >= 3 && dstChannels >= 3)
+        {
+            // From 3 to 4 channels
+            // and viceversa
+
+            for(int k = 0; k < numOfPixels; ++k, src += srcChannels, value += dstChannels)
+            {
+                value[0] = double(src[0]) * parameters.m_scale + parameters.m_shift;
+                value[1] = double(src[1]) * parameters.m_scale + parameters.m_shift;
+                value[2] = double(src[2]) * parameters.m_scale + parameters.m_shift;
+
+                if(dstChannels == 4)
+                    value[3] = parameters.m_alphaValue;
+            }
+        }
+        else
+        {
+            // The source pixel becomes
+            // a single value that gets
+            // replicated in the color
+            // channels of the destination
+
+            for(int k = 0; k < numOfPixels; ++k, src += srcChannels, value += dstChannels)
+            {
+                double pixelValue = getConversionValue<blSrcType,srcChannels>(src,parameters);
+
+                for(int c = 0; c < numOfColorChannels; ++c)
+                    value[c] = pixelValue;
+
+                if(dstChannels == 4)
+                    value[3] = parameters.m_alphaValue;
+            }
+        }
+
+        parameters.m_writeConvertedValues(values,
+                                          dstRow + std::ptrdiff_t(j) * dstChannels * parameters.m_dstElementSize,
+                                          numOfPixels * dstChannels);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The row kernel used for the depths
+// and channel mappings that have a
+// vectorized kernel, the pixels left
+// by the vectorized kernel are handed
+// to the generic row kernel
+//-------------------------------------------------------------------
+template<typename blSrcType,typename blDstType,int srcChannels,int dstChannels>
+
+inline void convertRowOfPixelsUsingSimd(const char* srcRow,
+                                        char* dstRow,
+                                        const int& numOfCols,
+                                        const blConversionParameters& parameters)
+{
+    int j = blSimdConversionKernel<blSrcType,blDstType,srcChannels,dstChannels>::convert(reinterpret_cast<const blSrcType*>(srcRow),
+                                                                                        reinterpret_cast<blDstType*>(dstRow),
+                                                                                        numOfCols,
+                                                                                        parameters);
+
+    if(j < numOfCols)
+    {
+        convertRowOfPixels<blSrcType,srcChannels,dstChannels>(srcRow + std::ptrdiff_t(j) * srcChannels * sizeof(blSrcType),
+                                                              dstRow + std::ptrdiff_t(j) * dstChannels * sizeof(blDstType),
+                                                              numOfCols - j,
+                                                              parameters);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions resolve the
+// row kernel for a specific combination
+// of depths and channels
+// - They return NULL for unsupported
+//   depths or numbers of channels
+//-------------------------------------------------------------------
+template<typename blSrcType>
+
+inline blConvertRowFunction getConvertRowFunction(const int& srcNumOfChannels,
+                                                  const int& dstNumOfChannels)
+{
+    if(srcNumOfChannels < 1 || srcNumOfChannels > 4 ||
+       dstNumOfChannels < 1 || dstNumOfChannels > 4)
+    {
+        return NULL;
+    }
+
+    if(srcNumOfChannels == dstNumOfChannels)
+        return &convertRowOfPixels<blSrcType,1,1>;
+
+    switch(srcNumOfChannels * 10 + dstNumOfChannels)
+    {
+    case 12: return &convertRowOfPixels<blSrcType,1,2>;
+    case 13: return &convertRowOfPixels<blSrcType,1,3>;
+    case 14: return &convertRowOfPixels<blSrcType,1,4>;
+    case 21: return &convertRowOfPixels<blSrcType,2,1>;
+    case 23: return &convertRowOfPixels<blSrcType,2,3>;
+    case 24: return &convertRowOfPixels<blSrcType,2,4>;
+    case 31: return &convertRowOfPixels<blSrcType,3,1>;
+    case 32: return &convertRowOfPixels<blSrcType,3,2>;
+    case 34: return &convertRowOfPixels<blSrcType,3,4>;
+    case 41: return &convertRowOfPixels<blSrcType,4,1>;
+    case 42: return &convertRowOfPixels<blSrcType,4,2>;
+    case 43: return &convertRowOfPixels<blSrcType,4,3>;
+    }
+
+    return NULL;
+}
+
+
+inline blConvertRowFunction getSimdConvertRowFunction(const int& srcDepth,
+                                                      const int& dstDepth,
+                                                      const int& srcNumOfChannels,
+                                                      const int& dstNumOfChannels)
+{
+    typedef unsigned char                       uchar;
+
+    if(srcDepth == IPL_DEPTH_8U && dstDepth == IPL_DEPTH_8U)
+    {
+        switch(srcNumOfChannels * 10 + dstNumOfChannels)
+        {
+        case 12: return &convertRowOfPixelsUsingSimd<uchar,uchar,1,2>;
+        case 13: return &convertRowOfPixelsUsingSimd<uchar,uchar,1,3>;
+        case 14: return &convertRowOfPixelsUsingSimd<uchar,uchar,1,4>;
+        case 31: return &convertRowOfPixelsUsingSimd<uchar,uchar,3,1>;
+        case 32: return &convertRowOfPixelsUsingSimd<uchar,uchar,3,2>;
+        case 34: return &convertRowOfPixelsUsingSimd<uchar,uchar,3,4>;
+        case 41: return &convertRowOfPixelsUsingSimd<uchar,uchar,4,1>;
+        case 42: return &convertRowOfPixelsUsingSimd<uchar,uchar,4,2>;
+        case 43: return &convertRowOfPixelsUsingSimd<uchar,uchar,4,3>;
+        }
+    }
+
+    if(srcNumOfChannels == dstNumOfChannels)
+    {
+        if(srcDepth == IPL_DEPTH_8U && dstDepth == IPL_DEPTH_32F)
+            return &convertRowOfPixelsUsingSimd<uchar,float,1,1>;
+
+        if(srcDepth == IPL_DEPTH_32F && dstDepth == IPL_DEPTH_8U)
+            return &convertRowOfPixelsUsingSimd<float,uchar,1,1>;
+    }
+
+    return NULL;
+}
+
+
+inline blConvertRowFunction getConvertRowFunction(const int& srcDepth,
+                                                  const int& dstDepth,
+                                                  const int& srcNumOfChannels,
+                                                  const int& dstNumOfChannels)
+{
+    blConvertRowFunction convertRow = getSimdConvertRowFunction(srcDepth,
+                                                                dstDepth,
+                                                                srcNumOfChannels,
+                                                                dstNumOfChannels);
+
+    if(convertRow != NULL)
+        return convertRow;
+
+    switch(srcDepth)
+    {
+    case IPL_DEPTH_1U: return getConvertRowFunction<bool>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_8U: return getConvertRowFunction<unsigned char>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_8S: return getConvertRowFunction<char>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_16U: return getConvertRowFunction<unsigned short>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_16S: return getConvertRowFunction<short>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_32S: return getConvertRowFunction<int>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_32F: return getConvertRowFunction<float>(srcNumOfChannels,dstNumOfChannels);
+    case IPL_DEPTH_64F: return getConvertRowFunction<double>(srcNumOfChannels,dstNumOfChannels);
+    }
+
+    return NULL;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to convert a whole
+// image (ignoring its ROI) into an
+// already allocated image of the same
+// size but with a different depth
+// and/or number of channels
+// - The rows are converted in parallel
+//   over bands of rows
+//-------------------------------------------------------------------
+inline bool convertImage(const IplImage* srcImage,
+                         IplImage* dstImage,
+                         const int& inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2 = 0)
+{
+    // Check for NULL pointers
+    // and mismatched sizes
+
+    if(srcImage == NULL ||
+       dstImage == NULL ||
+       srcImage->width != dstImage->width ||
+       srcImage->height != dstImage->height)
+    {
+        return false;
+    }
+
+    int srcNumOfChannels = srcImage->nChannels;
+    int dstNumOfChannels = dstImage->nChannels;
+
+    int numOfCols = srcImage->width;
+
+    // Images of the same type
+    // are simply copied row
+    // by row
+
+    if(srcImage->depth == dstImage->depth &&
+       srcNumOfChannels == dstNumOfChannels)
+    {
+        int rowSizeInBytes = std::min(srcImage->widthStep,dstImage->widthStep);
+
+        parallelForTiles(srcImage->height,numOfCols,[&](const blImageTile& tile)
+        {
+            for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+            {
+                std::copy(srcImage->imageData + srcImage->widthStep * i,
+                          srcImage->imageData + srcImage->widthStep * i + rowSizeInBytes,
+                          dstImage->imageData + dstImage->widthStep * i);
+            }
+        },0,numOfCols);
+
+        return true;
+    }
+
+    // Resolve the row kernel
+    // only once for the whole
+    // image
+
+    blConvertRowFunction convertRow = getConvertRowFunction(srcImage->depth,
+                                                            dstImage->depth,
+                                                            srcNumOfChannels,
+                                                            dstNumOfChannels);
+
+    blConversionParameters parameters;
+
+    parameters.m_writeConvertedValues = getWriteConvertedValuesFunction(dstImage->depth);
+
+    if(convertRow == NULL || parameters.m_writeConvertedValues == NULL)
+        return false;
+
+    getScaleShiftConversionParameters(srcImage->depth,
+                                      dstImage->depth,
+                                      parameters.m_scale,
+                                      parameters.m_shift);
+
+    parameters.m_alphaValue = rangeMax(dstImage->depth);
+    parameters.m_complexMode = inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2;
+    parameters.m_dstElementSize = (dstImage->depth & 255) / 8;
+
+    if(dstImage->depth == IPL_DEPTH_1U)
+        parameters.m_dstElementSize = int(sizeof(bool));
+
+    // Equal numbers of channels
+    // are converted as longer
+    // 1 channel rows
+
+    int numOfPixelsPerRow = (srcNumOfChannels == dstNumOfChannels) ? (numOfCols * srcNumOfChannels) : numOfCols;
+
+    // The tiles are always full
+    // width bands of rows, so the
+    // kernels get whole rows
+
+    parallelForTiles(srcImage->height,numOfCols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            convertRow(srcImage->imageData + srcImage->widthStep * i,
+                       dstImage->imageData + dstImage->widthStep * i,
+                       numOfPixelsPerRow,
+                       parameters);
+        }
+    },0,numOfCols);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_CONVERSIONKERNELS_HPP
@@ -0,0 +1,715 @@
+#ifndef BL_FFTCONVOLUTION_HPP
+#define BL_FFTCONVOLUTION_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFFTConvolution.hpp
+// CLASS:           blFFTConvolver
+// BASE CLASS:      None
+//
+// PURPOSE:         A convolution/correlation engine for real images,
+//                  which picks between a spatial loop (small kernels)
+//                  and an fft based product of half spectra (large
+//                  kernels), and which keeps its fft plan, buffers
+//                  and kernel spectrum from call to call
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blFFTPlan -- Used to compute the half spectra
+//                  parallelForTiles -- Used by the spatial loop
+//
+// NOTES:           - The convolution is linear (the image is zero
+//                    padded), and its output can be:
+//                    BL_CONVOLUTION_FULL  -- (rows + kRows - 1) x
+//                                            (cols + kCols - 1)
+//                    BL_CONVOLUTION_SAME  -- rows x cols, with the
+//                                            kernel anchored at its
+//                                            center (kRows/2,kCols/2)
+//                    BL_CONVOLUTION_VALID -- (rows - kRows + 1) x
+//                                            (cols - kCols + 1), only
+//                                            where the kernel fits in
+//                                            the image (template
+//                                            matching)
+//                  - The correlation is the convolution with the
+//                    kernel flipped in both directions
+//                  - The ffts are zero padded to the optimal dft
+//                    size, and very large images are split into
+//                    blocks whose results are added together
+//                    (overlap-add), so that the ffts stay small
+//                  - The spectrum of the last kernel is kept, so
+//                    filtering frame after frame with the same
+//                    kernel only transforms the frames
+//                  - A convolver should only be used by one thread
+//                    at a time (getFFTConvolver keeps one per thread)
+//                  - The data type has to be float or double, since
+//                    the ffts (cvDFT) only take floating point data
+//                    and the spatial loop accumulates in the data
+//                    type (integer images would overflow), so integer
+//                    images have to be converted before filtering
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:    Oct/17/2026
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blConvolutionShapeEnum {BL_CONVOLUTION_FULL,
+                             BL_CONVOLUTION_SAME,
+                             BL_CONVOLUTION_VALID};
+
+enum blConvolutionMethodEnum {BL_CONVOLUTION_AUTOMATIC,
+                              BL_CONVOLUTION_SPATIAL,
+                              BL_CONVOLUTION_FFT};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blFFTConvolver
+{
+    static_assert(std::is_floating_point<blDataType>::value,
+                  "blFFTConvolver only works with float or double images");
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blFFTConvolver(const int& overlapAddBlockSize = 512);
+
+    // Destructor
+
+    ~blFFTConvolver()
+    {
+    }
+
+public: // Public functions
+
+    // Functions used to convolve/correlate
+    // the ROI of an image with the ROI of
+    // a kernel
+    // - They return false when the output
+    //   would be empty (when the kernel
+    //   doesn't fit in the image for a
+    //   valid output, or when either one
+    //   is empty)
+    // - The output image is (re)created
+    //   only when its size changes
+
+    bool                                        convolve(const blImage<blDataType>& srcImage,
+                                                         const blImage<blDataType>& kernelImage,
+                                                         blImage<blDataType>& dstImage,
+                                                         const blConvolutionShapeEnum& shape = BL_CONVOLUTION_SAME,
+                                                         const blConvolutionMethodEnum& method = BL_CONVOLUTION_AUTOMATIC);
+
+    bool                                        correlate(const blImage<blDataType>& srcImage,
+                                                          const blImage<blDataType>& kernelImage,
+                                                          blImage<blDataType>& dstImage,
+                                                          const blConvolutionShapeEnum& shape = BL_CONVOLUTION_SAME,
+                                                          const blConvolutionMethodEnum& method = BL_CONVOLUTION_AUTOMATIC);
+
+    // Function used to get the method
+    // picked automatically for an image
+    // and kernel size, which compares
+    // the rough number of operations
+    // of both methods
+
+    blConvolutionMethodEnum                     getAutomaticMethod(const int& numOfRows,
+                                                                   const int& numOfCols,
+                                                                   const int& numOfKernelRows,
+                                                                   const int& numOfKernelCols,
+                                                                   const blConvolutionShapeEnum& shape = BL_CONVOLUTION_SAME)const;
+
+    // Functions used to set/get the
+    // size of the ffts above which
+    // images are split into blocks
+
+    void                                        setOverlapAddBlockSize(const int& overlapAddBlockSize);
+    int                                         getOverlapAddBlockSize()const;
+
+private: // Private functions
+
+    // Function used by both convolve
+    // and correlate
+
+    bool                                        filter(const blImage<blDataType>& srcImage,
+                                                       const blImage<blDataType>& kernelImage,
+                                                       blImage<blDataType>& dstImage,
+                                                       const blConvolutionShapeEnum& shape,
+                                                       const blConvolutionMethodEnum& method,
+                                                       const bool& isCorrelation);
+
+    // Function used to get the block
+    // size and fft size used along
+    // one dimension
+
+    void                                        getBlockSize(const int& size,
+                                                             const int& kernelSize,
+                                                             int& blockSize,
+                                                             int& fftSize)const;
+
+    // The two methods, which
+    // compute the output at the
+    // given offset into the full
+    // convolution
+
+    void                                        convolveSpatially(const blImage<blDataType>& srcImage,
+                                                                  blImage<blDataType>& dstImage,
+                                                                  const int& rowOffset,
+                                                                  const int& colOffset);
+
+    void                                        convolveWithFFT(const blImage<blDataType>& srcImage,
+                                                                blImage<blDataType>& dstImage,
+                                                                const int& rowOffset,
+                                                                const int& colOffset);
+
+    // Function used to compute the
+    // spectrum of the kernel, unless
+    // it's the same as last time
+
+    void                                        updateKernelSpectrum(const int& fftRows,
+                                                                     const int& fftCols);
+
+private: // Private variables
+
+    int                                         m_overlapAddBlockSize;
+
+    // The kernel (flipped when
+    // correlating) and a copy of
+    // the source used when the
+    // source is the destination
+
+    blImage<blDataType>                         m_kernel;
+    blImage<blDataType>                         m_sourceCopy;
+
+    // The fft plan and buffers
+
+    blFFTPlan<blDataType>                       m_plan;
+
+    blImage<blDataType>                         m_paddedBlock;
+    blImage< std::complex<blDataType> >         m_productSpectrum;
+
+    // The spectrum of the kernel
+    // and the kernel it belongs to
+
+    blImage< std::complex<blDataType> >         m_kernelSpectrum;
+    blImage<blDataType>                         m_kernelOfSpectrum;
+    bool                                        m_isKernelSpectrumValid;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFFTConvolver<blDataType>::blFFTConvolver(const int& overlapAddBlockSize)
+{
+    m_overlapAddBlockSize = std::max(16,overlapAddBlockSize);
+    m_isKernelSpectrumValid = false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTConvolver<blDataType>::setOverlapAddBlockSize(const int& overlapAddBlockSize)
+{
+    m_overlapAddBlockSize = std::max(16,overlapAddBlockSize);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTConvolver<blDataType>::getOverlapAddBlockSize()const
+{
+    return m_overlapAddBlockSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blFFTConvolver<blDataType>::convolve(const blImage<blDataType>& srcImage,
+                                                 const blImage<blDataType>& kernelImage,
+                                                 blImage<blDataType>& dstImage,
+                                                 const blConvolutionShapeEnum& shape,
+                                                 const blConvolutionMethodEnum& method)
+{
+    return filter(srcImage,kernelImage,dstImage,shape,method,false);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blFFTConvolver<blDataType>::correlate(const blImage<blDataType>& srcImage,
+                                                  const blImage<blDataType>& kernelImage,
+                                                  blImage<blDataType>& dstImage,
+                                                  const blConvolutionShapeEnum& shape,
+                                                  const blConvolutionMethodEnum& method)
+{
+    return filter(srcImage,kernelImage,dstImage,shape,method,true);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTConvolver<blDataType>::getBlockSize(const int& size,
+                                                     const int& kernelSize,
+                                                     int& blockSize,
+                                                     int& fftSize)const
+{
+    // A dimension is only split
+    // when it's a lot bigger than
+    // the block size and the kernel
+    // leaves room for a useful block
+
+    if(size + kernelSize - 1 > 2 * m_overlapAddBlockSize && 2 * kernelSize <= m_overlapAddBlockSize)
+    {
+        fftSize = cvGetOptimalDFTSize(m_overlapAddBlockSize);
+        blockSize = fftSize - kernelSize + 1;
+    }
+    else
+    {
+        fftSize = cvGetOptimalDFTSize(size + kernelSize - 1);
+        blockSize = size;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blConvolutionMethodEnum blFFTConvolver<blDataType>::getAutomaticMethod(const int& numOfRows,
+                                                                              const int& numOfCols,
+                                                                              const int& numOfKernelRows,
+                                                                              const int& numOfKernelCols,
+                                                                              const blConvolutionShapeEnum& shape)const
+{
+    int outputRows = numOfRows;
+    int outputCols = numOfCols;
+
+    if(shape == BL_CONVOLUTION_FULL)
+    {
+        outputRows = numOfRows + numOfKernelRows - 1;
+        outputCols = numOfCols + numOfKernelCols - 1;
+    }
+    else if(shape == BL_CONVOLUTION_VALID)
+    {
+        outputRows = numOfRows - numOfKernelRows + 1;
+        outputCols = numOfCols - numOfKernelCols + 1;
+    }
+
+    // The spatial loop does one
+    // multiply-add per kernel
+    // element per output pixel
+
+    double spatialCost = double(outputRows) * double(outputCols) * double(numOfKernelRows) * double(numOfKernelCols);
+
+    // Each block costs a forward and
+    // an inverse real fft, plus the
+    // copies and the product, which
+    // we lump together as about
+    // 3 N log2(N) operations
+
+    int blockRows = 0;
+    int blockCols = 0;
+    int fftRows = 0;
+    int fftCols = 0;
+
+    getBlockSize(numOfRows,numOfKernelRows,blockRows,fftRows);
+    getBlockSize(numOfCols,numOfKernelCols,blockCols,fftCols);
+
+    double numOfBlocks = std::ceil(double(numOfRows) / double(blockRows)) * std::ceil(double(numOfCols) / double(blockCols));
+    double fftSize = double(fftRows) * double(fftCols);
+
+    double fftCost = numOfBlocks * 3.0 * fftSize * std::log2(std::max(2.0,fftSize));
+
+    if(spatialCost <= fftCost)
+        return BL_CONVOLUTION_SPATIAL;
+    else
+        return BL_CONVOLUTION_FFT;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blFFTConvolver<blDataType>::filter(const blImage<blDataType>& srcImage,
+                                               const blImage<blDataType>& kernelImage,
+                                               blImage<blDataType>& dstImage,
+                                               const blConvolutionShapeEnum& shape,
+                                               const blConvolutionMethodEnum& method,
+                                               const bool& isCorrelation)
+{
+    if(srcImage.empty() || kernelImage.empty())
+        return false;
+
+    int rows = srcImage.size1ROI();
+    int cols = srcImage.size2ROI();
+    int kernelRows = kernelImage.size1ROI();
+    int kernelCols = kernelImage.size2ROI();
+
+    // Figure out the size of the
+    // output and where it sits in
+    // the full convolution
+
+    int outputRows = rows + kernelRows - 1;
+    int outputCols = cols + kernelCols - 1;
+    int rowOffset = 0;
+    int colOffset = 0;
+
+    if(shape == BL_CONVOLUTION_SAME)
+    {
+        outputRows = rows;
+        outputCols = cols;
+        rowOffset = kernelRows / 2;
+        colOffset = kernelCols / 2;
+    }
+    else if(shape == BL_CONVOLUTION_VALID)
+    {
+        outputRows = rows - kernelRows + 1;
+        outputCols = cols - kernelCols + 1;
+        rowOffset = kernelRows - 1;
+        colOffset = kernelCols - 1;
+    }
+
+    if(outputRows <= 0 || outputCols <= 0)
+        return false;
+
+    // Copy the kernel (flipping it
+    // when correlating) so that the
+    // methods only ever convolve
+
+    m_kernel.create(kernelRows,kernelCols);
+
+    for(int i = 0; i < kernelRows; ++i)
+    {
+        const blDataType* kernelRow = kernelImage[kernelImage.yROI() + i] + kernelImage.xROI();
+
+        if(isCorrelation)
+            std::reverse_copy(kernelRow,kernelRow + kernelCols,m_kernel[kernelRows - 1 - i]);
+        else
+            std::copy(kernelRow,kernelRow + kernelCols,m_kernel[i]);
+    }
+
+    // When the destination is the
+    // source, the source is copied
+    // before the destination is
+    // overwritten
+
+    const blImage<blDataType>* sourceImage = &srcImage;
+
+    if(dstImage.getImagePtr() == srcImage.getImagePtr())
+    {
+        m_sourceCopy.create(rows,cols);
+
+        for(int i = 0; i < rows; ++i)
+            std::copy(srcImage[srcImage.yROI() + i] + srcImage.xROI(),
+                      srcImage[srcImage.yROI() + i] + srcImage.xROI() + cols,
+                      m_sourceCopy[i]);
+
+        sourceImage = &m_sourceCopy;
+    }
+
+    if(!dstImage.create(outputRows,outputCols))
+        return false;
+
+    dstImage.resetROI();
+
+    blConvolutionMethodEnum methodToUse = method;
+
+    if(methodToUse == BL_CONVOLUTION_AUTOMATIC)
+        methodToUse = getAutomaticMethod(rows,cols,kernelRows,kernelCols,shape);
+
+    if(methodToUse == BL_CONVOLUTION_FFT)
+        convolveWithFFT(*sourceImage,dstImage,rowOffset,colOffset);
+    else
+        convolveSpatially(*sourceImage,dstImage,rowOffset,colOffset);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTConvolver<blDataType>::convolveSpatially(const blImage<blDataType>& srcImage,
+                                                          blImage<blDataType>& dstImage,
+                                                          const int& rowOffset,
+                                                          const int& colOffset)
+{
+    int rows = srcImage.size1ROI();
+    int cols = srcImage.size2ROI();
+    int yROI = srcImage.yROI();
+    int xROI = srcImage.xROI();
+
+    int kernelRows = m_kernel.size1();
+    int kernelCols = m_kernel.size2();
+
+    int outputRows = dstImage.size1();
+    int outputCols = dstImage.size2();
+
+    // Every output row is the sum of
+    // the source rows it overlaps,
+    // each shifted and weighted by a
+    // kernel element, which keeps
+    // the inner loop contiguous
+
+    parallelForTiles(outputRows,outputCols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            blDataType* dstRow = dstImage[i];
+
+            std::fill(dstRow,dstRow + outputCols,blDataType(0));
+
+            int fullRow = i + rowOffset;
+
+            for(int m = 0; m < kernelRows; ++m)
+            {
+                int srcRowIndex = fullRow - m;
+
+                if(srcRowIndex < 0 || srcRowIndex >= rows)
+                    continue;
+
+                const blDataType* srcRow = srcImage[yROI + srcRowIndex] + xROI;
+                const blDataType* kernelRow = m_kernel[m];
+
+                for(int n = 0; n < kernelCols; ++n)
+                {
+                    // The output columns j for
+                    // which 0 <= j + colOffset - n < cols
+
+                    int jBegin = std::max(0,n - colOffset);
+                    int jEnd = std::min(outputCols,cols + n - colOffset);
+
+                    blDataType weight = kernelRow[n];
+                    const blDataType* shiftedSrcRow = srcRow + colOffset - n;
+
+                    for(int j = jBegin; j < jEnd; ++j)
+                        dstRow[j] += weight * shiftedSrcRow[j];
+                }
+            }
+        }
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTConvolver<blDataType>::updateKernelSpectrum(const int& fftRows,
+                                                             const int& fftCols)
+{
+    int kernelRows = m_kernel.size1();
+    int kernelCols = m_kernel.size2();
+
+    // Check whether the spectrum we
+    // have belongs to the same kernel
+    // and fft size
+
+    if(m_isKernelSpectrumValid &&
+       m_kernelSpectrum.size1() == fftRows &&
+       m_kernelSpectrum.size2() == fftCols / 2 + 1 &&
+       m_kernelOfSpectrum.size1() == kernelRows &&
+       m_kernelOfSpectrum.size2() == kernelCols)
+    {
+        bool isSameKernel = true;
+
+        for(int i = 0; i < kernelRows && isSameKernel; ++i)
+            isSameKernel = std::equal(m_kernel[i],m_kernel[i] + kernelCols,m_kernelOfSpectrum[i]);
+
+        if(isSameKernel)
+            return;
+    }
+
+    m_kernelOfSpectrum.create(kernelRows,kernelCols);
+
+    for(int i = 0; i < kernelRows; ++i)
+        std::copy(m_kernel[i],m_kernel[i] + kernelCols,m_kernelOfSpectrum[i]);
+
+    // Zero pad the kernel and
+    // take its half spectrum
+
+    for(int i = 0; i < fftRows; ++i)
+        std::fill(m_paddedBlock[i],m_paddedBlock[i] + fftCols,blDataType(0));
+
+    for(int i = 0; i < kernelRows; ++i)
+        std::copy(m_kernel[i],m_kernel[i] + kernelCols,m_paddedBlock[i]);
+
+    const blImage< std::complex<blDataType> >& halfSpectrum = rfft2(m_paddedBlock,m_plan);
+
+    m_kernelSpectrum.create(halfSpectrum.size1(),halfSpectrum.size2());
+
+    for(int i = 0; i < halfSpectrum.size1(); ++i)
+        std::copy(halfSpectrum[i],halfSpectrum[i] + halfSpectrum.size2(),m_kernelSpectrum[i]);
+
+    m_isKernelSpectrumValid = true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTConvolver<blDataType>::convolveWithFFT(const blImage<blDataType>& srcImage,
+                                                        blImage<blDataType>& dstImage,
+                                                        const int& rowOffset,
+                                                        const int& colOffset)
+{
+    int rows = srcImage.size1ROI();
+    int cols = srcImage.size2ROI();
+    int yROI = srcImage.yROI();
+    int xROI = srcImage.xROI();
+
+    int kernelRows = m_kernel.size1();
+    int kernelCols = m_kernel.size2();
+
+    int outputRows = dstImage.size1();
+    int outputCols = dstImage.size2();
+
+    int blockRows = 0;
+    int blockCols = 0;
+    int fftRows = 0;
+    int fftCols = 0;
+
+    getBlockSize(rows,kernelRows,blockRows,fftRows);
+    getBlockSize(cols,kernelCols,blockCols,fftCols);
+
+    // The fft sizes are already
+    // optimal, so the plan doesn't
+    // pad anything
+
+    m_paddedBlock.create(fftRows,fftCols);
+    m_plan.setup(fftRows,fftCols);
+
+    updateKernelSpectrum(fftRows,fftCols);
+
+    int halfCols = m_kernelSpectrum.size2();
+
+    m_productSpectrum.create(fftRows,halfCols);
+
+    for(int i = 0; i < outputRows; ++i)
+        std::fill(dstImage[i],dstImage[i] + outputCols,blDataType(0));
+
+    // Overlap-add: each block of the
+    // source is convolved on its own,
+    // and its (bigger) result is added
+    // to the output where it overlaps it
+
+    for(int blockRow = 0; blockRow < rows; blockRow += blockRows)
+    {
+        for(int blockCol = 0; blockCol < cols; blockCol += blockCols)
+        {
+            int numOfRowsInBlock = std::min(blockRows,rows - blockRow);
+            int numOfColsInBlock = std::min(blockCols,cols - blockCol);
+
+            for(int i = 0; i < fftRows; ++i)
+                std::fill(m_paddedBlock[i],m_paddedBlock[i] + fftCols,blDataType(0));
+
+            for(int i = 0; i < numOfRowsInBlock; ++i)
+            {
+                const blDataType* srcRow = srcImage[yROI + blockRow + i] + xROI + blockCol;
+
+                std::copy(srcRow,srcRow + numOfColsInBlock,m_paddedBlock[i]);
+            }
+
+            const blImage< std::complex<blDataType> >& blockSpectrum = rfft2(m_paddedBlock,m_plan);
+
+            for(int i = 0; i < fftRows; ++i)
+            {
+                const std::complex<blDataType>* blockRow = blockSpectrum[i];
+                const std::complex<blDataType>* kernelRow = m_kernelSpectrum[i];
+                std::complex<blDataType>* productRow = m_productSpectrum[i];
+
+                for(int j = 0; j < halfCols; ++j)
+                    productRow[j] = blockRow[j] * kernelRow[j];
+            }
+
+            const blImage<blDataType>& blockResult = irfft2(m_productSpectrum,m_plan);
+
+            // The block result covers the
+            // full convolution indices
+            // [blockRow, blockRow + numOfRowsInBlock + kernelRows - 1)
+
+            int iBegin = std::max(0,blockRow - rowOffset);
+            int iEnd = std::min(outputRows,blockRow + numOfRowsInBlock + kernelRows - 1 - rowOffset);
+            int jBegin = std::max(0,blockCol - colOffset);
+            int jEnd = std::min(outputCols,blockCol + numOfColsInBlock + kernelCols - 1 - colOffset);
+
+            for(int i = iBegin; i < iEnd; ++i)
+            {
+                const blDataType* resultRow = blockResult[i + rowOffset - blockRow] + colOffset - blockCol;
+                blDataType* dstRow = dstImage[i];
+
+                for(int j = jBegin; j < jEnd; ++j)
+                    dstRow[j] += resultRow[j];
+            }
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the
+// convolver kept by the
+// calling thread
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFFTConvolver<blDataType>& getFFTConvolver()
+{
+    static thread_local blFFTConvolver<blDataType> convolver;
+
+    return convolver;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions convolve and
+// correlate an image with a kernel
+// using the calling thread's convolver
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool convolveFFT(const blImage<blDataType>& srcImage,
+                        const blImage<blDataType>& kernelImage,
+                        blImage<blDataType>& dstImage,
+                        const blConvolutionShapeEnum& shape = BL_CONVOLUTION_SAME,
+                        const blConvolutionMethodEnum& method = BL_CONVOLUTION_AUTOMATIC)
+{
+    return getFFTConvolver<blDataType>().convolve(srcImage,kernelImage,dstImage,shape,method);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool correlateFFT(const blImage<blDataType>& srcImage,
+                         const blImage<blDataType>& kernelImage,
+                         blImage<blDataType>& dstImage,
+                         const blConvolutionShapeEnum& shape = BL_CONVOLUTION_SAME,
+                         const blConvolutionMethodEnum& method = BL_CONVOLUTION_AUTOMATIC)
+{
+    return getFFTConvolver<blDataType>().correlate(srcImage,kernelImage,dstImage,shape,method);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FFTCONVOLUTION_HPP
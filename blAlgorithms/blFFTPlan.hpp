@@ -0,0 +1,693 @@
+#ifndef BL_FFTPLAN_HPP
+#define BL_FFTPLAN_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFFTPlan.hpp
+// CLASS:           blFFTPlan
+// BASE CLASS:      None
+//
+// PURPOSE:         A reusable fft context that keeps the optimal
+//                  padded size, the scratch buffers and the output
+//                  images of an fft of a given size, type and mode,
+//                  so that transforming frame after frame of the
+//                  same size never allocates anything
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    cvDFT -- Used to compute the transforms
+//                  cvGetOptimalDFTSize -- Used to pad the input
+//                  blImage -- Used to hold the buffers
+//
+// NOTES:           - The plan is keyed on the size of the input
+//                    (rows,cols), its data type (float or double,
+//                    the template parameter), whether the transform
+//                    is done on individual rows, and whether the
+//                    input is zero-padded to the optimal dft size
+//                  - The buffers only get reallocated when a plan
+//                    is used with a different input size
+//                  - A real input only needs the Hermitian half of
+//                    its spectrum, so rfft2 returns a compact
+//                    (rows) x (cols/2 + 1) complex image, computed
+//                    from opencv's packed (CCS) real transform,
+//                    while irfft2 goes back from that half spectrum
+//                    to the real image
+//                  - The images returned by the plan are owned by
+//                    it and get overwritten by the next transform
+//                  - A plan should only be used by one thread at a
+//                    time (getCachedFFTPlan keeps one per thread)
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blFFTPlan
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blFFTPlan(const bool& shouldfftBeDoneOnIndividualRows = false,
+              const bool& shouldInputBePaddedToOptimalSize = false);
+
+    // Destructor
+
+    ~blFFTPlan()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to set the
+    // plan up for an input size
+    // (it does nothing when the
+    // plan is already set up for it)
+
+    void                                        setup(const int& numOfRows,
+                                                      const int& numOfCols);
+
+    // Functions used to get
+    // the settings of the plan
+
+    bool                                        isfftDoneOnIndividualRows()const;
+    bool                                        isInputPaddedToOptimalSize()const;
+
+    int                                         getNumOfRows()const;
+    int                                         getNumOfCols()const;
+    int                                         getNumOfPaddedRows()const;
+    int                                         getNumOfPaddedCols()const;
+    int                                         getNumOfHalfSpectrumCols()const;
+
+    // Function used to take the
+    // fft of a real image and get
+    // its half spectrum
+    // - The half spectrum has
+    //   (padded rows) x (padded
+    //   cols/2 + 1) elements
+
+    const blImage< std::complex<blDataType> >&  forwardRealToHalfSpectrum(const blImage<blDataType>& srcImage);
+
+    // Function used to take the
+    // inverse fft of a half spectrum
+    // and get the real image
+    // - The half spectrum has to
+    //   match the plan's size, and
+    //   the ROI of the returned
+    //   image is the unpadded size
+    // - A half spectrum that doesn't
+    //   match the plan's size (or a
+    //   plan that was never set up)
+    //   gives back an empty image
+
+    const blImage<blDataType>&                  inverseHalfSpectrumToReal(const blImage< std::complex<blDataType> >& halfSpectrum);
+
+    // Functions used to take the
+    // full complex forward fft of
+    // a real image and the inverse
+    // fft of a full complex spectrum
+    // back into a real image
+    // - The spectrum has to match the
+    //   plan's padded size, otherwise
+    //   inverse gives back an empty
+    //   image
+
+    const blImage< std::complex<blDataType> >&  forward(const blImage<blDataType>& srcImage);
+    const blImage<blDataType>&                  inverse(const blImage< std::complex<blDataType> >& spectrum);
+
+    // Function used to get
+    // the packed (CCS) spectrum
+    // computed by the last real
+    // forward transform
+
+    const blImage<blDataType>&                  getPackedSpectrum()const;
+
+private: // Private functions
+
+    // Function used to get the
+    // image actually transformed,
+    // which is the source image
+    // itself when no padding is
+    // needed, or the zero padded
+    // copy of it otherwise
+
+    const IplImage*                             getInputImage(const blImage<blDataType>& srcImage);
+
+    // Functions used to convert
+    // between the packed spectrum
+    // and the half spectrum
+
+    void                                        unpackSpectrum();
+    void                                        packSpectrum(const blImage< std::complex<blDataType> >& halfSpectrum);
+
+    // Function used to get the
+    // flags passed to cvDFT
+
+    int                                         getDFTFlags(const int& directionFlags)const;
+
+private: // Private variables
+
+    // The settings
+
+    bool                                        m_isfftDoneOnIndividualRows;
+    bool                                        m_isInputPaddedToOptimalSize;
+
+    int                                         m_numOfRows;
+    int                                         m_numOfCols;
+    int                                         m_numOfPaddedRows;
+    int                                         m_numOfPaddedCols;
+
+    // The scratch buffers
+    // and output images
+
+    blImage<blDataType>                         m_paddedInput;
+    blImage<blDataType>                         m_packedSpectrum;
+    blImage< std::complex<blDataType> >         m_halfSpectrum;
+    blImage< std::complex<blDataType> >         m_fullSpectrum;
+    blImage<blDataType>                         m_realOutput;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFFTPlan<blDataType>::blFFTPlan(const bool& shouldfftBeDoneOnIndividualRows,
+                                        const bool& shouldInputBePaddedToOptimalSize)
+{
+    m_isfftDoneOnIndividualRows = shouldfftBeDoneOnIndividualRows;
+    m_isInputPaddedToOptimalSize = shouldInputBePaddedToOptimalSize;
+
+    m_numOfRows = 0;
+    m_numOfCols = 0;
+    m_numOfPaddedRows = 0;
+    m_numOfPaddedCols = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTPlan<blDataType>::setup(const int& numOfRows,
+                                         const int& numOfCols)
+{
+    if(numOfRows == m_numOfRows && numOfCols == m_numOfCols)
+        return;
+
+    m_numOfRows = numOfRows;
+    m_numOfCols = numOfCols;
+
+    // When transforming individual
+    // rows, only the columns get
+    // padded
+
+    if(m_isInputPaddedToOptimalSize)
+    {
+        m_numOfPaddedRows = (m_isfftDoneOnIndividualRows ? numOfRows : cvGetOptimalDFTSize(numOfRows));
+        m_numOfPaddedCols = cvGetOptimalDFTSize(numOfCols);
+    }
+    else
+    {
+        m_numOfPaddedRows = numOfRows;
+        m_numOfPaddedCols = numOfCols;
+    }
+
+    if(m_numOfPaddedRows != numOfRows || m_numOfPaddedCols != numOfCols)
+    {
+        // The padding stays
+        // zero from now on
+
+        m_paddedInput.create(m_numOfPaddedRows,m_numOfPaddedCols);
+
+        for(int i = 0; i < m_numOfPaddedRows; ++i)
+            std::fill(m_paddedInput[i],m_paddedInput[i] + m_numOfPaddedCols,blDataType(0));
+    }
+
+    m_packedSpectrum.create(m_numOfPaddedRows,m_numOfPaddedCols);
+    m_halfSpectrum.create(m_numOfPaddedRows,getNumOfHalfSpectrumCols());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blFFTPlan<blDataType>::isfftDoneOnIndividualRows()const
+{
+    return m_isfftDoneOnIndividualRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blFFTPlan<blDataType>::isInputPaddedToOptimalSize()const
+{
+    return m_isInputPaddedToOptimalSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getNumOfRows()const
+{
+    return m_numOfRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getNumOfCols()const
+{
+    return m_numOfCols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getNumOfPaddedRows()const
+{
+    return m_numOfPaddedRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getNumOfPaddedCols()const
+{
+    return m_numOfPaddedCols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getNumOfHalfSpectrumCols()const
+{
+    return m_numOfPaddedCols / 2 + 1;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blFFTPlan<blDataType>::getPackedSpectrum()const
+{
+    return m_packedSpectrum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFFTPlan<blDataType>::getDFTFlags(const int& directionFlags)const
+{
+    if(m_isfftDoneOnIndividualRows)
+        return (directionFlags | CV_DXT_ROWS);
+    else
+        return directionFlags;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const IplImage* blFFTPlan<blDataType>::getInputImage(const blImage<blDataType>& srcImage)
+{
+    setup(srcImage.size1ROI(),srcImage.size2ROI());
+
+    // Without padding, cvDFT reads
+    // the source ROI directly
+
+    if(m_numOfPaddedRows == m_numOfRows && m_numOfPaddedCols == m_numOfCols)
+        return srcImage.getImagePtr();
+
+    // Otherwise we copy the ROI
+    // into the top left corner of
+    // the zero padded input
+
+    int yROI = srcImage.yROI();
+    int xROI = srcImage.xROI();
+
+    parallelForTiles(m_numOfRows,m_numOfCols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            std::copy(srcImage[i + yROI] + xROI,
+                      srcImage[i + yROI] + xROI + m_numOfCols,
+                      m_paddedInput[i]);
+        }
+    });
+
+    return m_paddedInput.getImagePtr();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage< std::complex<blDataType> >& blFFTPlan<blDataType>::forwardRealToHalfSpectrum(const blImage<blDataType>& srcImage)
+{
+    // A real input and output
+    // makes cvDFT compute the
+    // packed (CCS) spectrum,
+    // which we then unpack
+
+    const IplImage* inputImage = getInputImage(srcImage);
+
+    cvDFT(inputImage,m_packedSpectrum,getDFTFlags(CV_DXT_FORWARD));
+
+    unpackSpectrum();
+
+    return m_halfSpectrum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blFFTPlan<blDataType>::inverseHalfSpectrumToReal(const blImage< std::complex<blDataType> >& halfSpectrum)
+{
+    if(m_numOfPaddedRows <= 0 ||
+       m_numOfPaddedCols <= 0 ||
+       halfSpectrum.size1ROI() != m_numOfPaddedRows ||
+       halfSpectrum.size2ROI() != getNumOfHalfSpectrumCols())
+    {
+        // Error -- The half spectrum doesn't
+        //          match the plan (or the plan
+        //          was never set up), and
+        //          packing it would read out
+        //          of its bounds
+
+        m_realOutput = blImage<blDataType>();
+
+        return m_realOutput;
+    }
+
+    m_realOutput.create(m_numOfPaddedRows,m_numOfPaddedCols);
+    m_realOutput.resetROI();
+
+    packSpectrum(halfSpectrum);
+
+    cvDFT(m_packedSpectrum,m_realOutput,getDFTFlags(CV_DXT_INV_SCALE));
+
+    // The padding is
+    // left out of the ROI
+
+    m_realOutput.setROI(cvRect(0,0,m_numOfCols,m_numOfRows));
+
+    return m_realOutput;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage< std::complex<blDataType> >& blFFTPlan<blDataType>::forward(const blImage<blDataType>& srcImage)
+{
+    const IplImage* inputImage = getInputImage(srcImage);
+
+    m_fullSpectrum.create(m_numOfPaddedRows,m_numOfPaddedCols);
+
+    cvDFT(inputImage,m_fullSpectrum,getDFTFlags(CV_DXT_FORWARD));
+
+    return m_fullSpectrum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blFFTPlan<blDataType>::inverse(const blImage< std::complex<blDataType> >& spectrum)
+{
+    if(m_numOfPaddedRows <= 0 ||
+       m_numOfPaddedCols <= 0 ||
+       spectrum.size1ROI() != m_numOfPaddedRows ||
+       spectrum.size2ROI() != m_numOfPaddedCols)
+    {
+        // Error -- The spectrum doesn't
+        //          match the plan (or the
+        //          plan was never set up)
+
+        m_realOutput = blImage<blDataType>();
+
+        return m_realOutput;
+    }
+
+    m_realOutput.create(m_numOfPaddedRows,m_numOfPaddedCols);
+    m_realOutput.resetROI();
+
+    cvDFT(spectrum,m_realOutput,getDFTFlags(CV_DXT_INV_SCALE));
+
+    m_realOutput.setROI(cvRect(0,0,m_numOfCols,m_numOfRows));
+
+    return m_realOutput;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTPlan<blDataType>::unpackSpectrum()
+{
+    // The CCS layout (for N columns
+    // and M rows) is as follows:
+    // - Columns 2k-1 and 2k hold the
+    //   real and imaginary parts of
+    //   the spectrum column k, for
+    //   0 < k < N/2
+    // - Column 0 (and column N-1 when
+    //   N is even) hold the spectrum
+    //   columns 0 (and N/2), which are
+    //   Hermitian along the rows, packed
+    //   the same way along the rows
+    // - When transforming individual
+    //   rows, every row is packed the
+    //   same way along the columns
+
+    int rows = m_numOfPaddedRows;
+    int cols = m_numOfPaddedCols;
+    int halfCols = getNumOfHalfSpectrumCols();
+
+    bool hasNyquistCol = (cols % 2 == 0 && cols > 1);
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            const blDataType* packedRow = m_packedSpectrum[i];
+            std::complex<blDataType>* halfRow = m_halfSpectrum[i];
+
+            for(int k = 1; 2 * k < cols; ++k)
+                halfRow[k] = std::complex<blDataType>(packedRow[2 * k - 1],packedRow[2 * k]);
+
+            if(m_isfftDoneOnIndividualRows)
+            {
+                halfRow[0] = std::complex<blDataType>(packedRow[0],0);
+
+                if(hasNyquistCol)
+                    halfRow[halfCols - 1] = std::complex<blDataType>(packedRow[cols - 1],0);
+            }
+        }
+    });
+
+    if(m_isfftDoneOnIndividualRows)
+        return;
+
+    // Unpack the first (and Nyquist)
+    // columns, filling in their
+    // conjugate symmetric halves
+
+    int numOfPackedCols = (hasNyquistCol ? 2 : 1);
+
+    for(int c = 0; c < numOfPackedCols; ++c)
+    {
+        int packedCol = (c == 0 ? 0 : cols - 1);
+        int halfCol = (c == 0 ? 0 : halfCols - 1);
+
+        m_halfSpectrum[0][halfCol] = std::complex<blDataType>(m_packedSpectrum[0][packedCol],0);
+
+        for(int j = 1; 2 * j < rows; ++j)
+        {
+            std::complex<blDataType> value(m_packedSpectrum[2 * j - 1][packedCol],m_packedSpectrum[2 * j][packedCol]);
+
+            m_halfSpectrum[j][halfCol] = value;
+            m_halfSpectrum[rows - j][halfCol] = std::conj(value);
+        }
+
+        if(rows % 2 == 0 && rows > 1)
+            m_halfSpectrum[rows / 2][halfCol] = std::complex<blDataType>(m_packedSpectrum[rows - 1][packedCol],0);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFFTPlan<blDataType>::packSpectrum(const blImage< std::complex<blDataType> >& halfSpectrum)
+{
+    // This is the exact reverse of
+    // unpackSpectrum, where the
+    // conjugate symmetric halves of
+    // the first (and Nyquist) columns
+    // are simply left out
+
+    int rows = m_numOfPaddedRows;
+    int cols = m_numOfPaddedCols;
+    int halfCols = getNumOfHalfSpectrumCols();
+
+    int yROI = halfSpectrum.yROI();
+    int xROI = halfSpectrum.xROI();
+
+    bool hasNyquistCol = (cols % 2 == 0 && cols > 1);
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            blDataType* packedRow = m_packedSpectrum[i];
+            const std::complex<blDataType>* halfRow = halfSpectrum[i + yROI] + xROI;
+
+            for(int k = 1; 2 * k < cols; ++k)
+            {
+                packedRow[2 * k - 1] = halfRow[k].real();
+                packedRow[2 * k] = halfRow[k].imag();
+            }
+
+            if(m_isfftDoneOnIndividualRows)
+            {
+                packedRow[0] = halfRow[0].real();
+
+                if(hasNyquistCol)
+                    packedRow[cols - 1] = halfRow[halfCols - 1].real();
+            }
+        }
+    });
+
+    if(m_isfftDoneOnIndividualRows)
+        return;
+
+    int numOfPackedCols = (hasNyquistCol ? 2 : 1);
+
+    for(int c = 0; c < numOfPackedCols; ++c)
+    {
+        int packedCol = (c == 0 ? 0 : cols - 1);
+        int halfCol = xROI + (c == 0 ? 0 : halfCols - 1);
+
+        m_packedSpectrum[0][packedCol] = halfSpectrum[yROI][halfCol].real();
+
+        for(int j = 1; 2 * j < rows; ++j)
+        {
+            m_packedSpectrum[2 * j - 1][packedCol] = halfSpectrum[yROI + j][halfCol].real();
+            m_packedSpectrum[2 * j][packedCol] = halfSpectrum[yROI + j][halfCol].imag();
+        }
+
+        if(rows % 2 == 0 && rows > 1)
+            m_packedSpectrum[rows - 1][packedCol] = halfSpectrum[yROI + rows / 2][halfCol].real();
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get a plan kept
+// by the calling thread for the given
+// settings, so that functions can
+// reuse plans across calls without
+// the caller keeping them around
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFFTPlan<blDataType>& getCachedFFTPlan(const bool& shouldfftBeDoneOnIndividualRows,
+                                               const bool& shouldInputBePaddedToOptimalSize)
+{
+    // One plan per mode, whose
+    // buffers follow the size
+    // of the last input
+
+    static thread_local blFFTPlan<blDataType> plans[4] = {blFFTPlan<blDataType>(false,false),
+                                                          blFFTPlan<blDataType>(false,true),
+                                                          blFFTPlan<blDataType>(true,false),
+                                                          blFFTPlan<blDataType>(true,true)};
+
+    return plans[(shouldfftBeDoneOnIndividualRows ? 2 : 0) + (shouldInputBePaddedToOptimalSize ? 1 : 0)];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions take the
+// fft of a real image into its half
+// spectrum and back using a plan
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline const blImage< std::complex<blDataType> >& rfft2(const blImage<blDataType>& srcImage,
+                                                        blFFTPlan<blDataType>& plan)
+{
+    return plan.forwardRealToHalfSpectrum(srcImage);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline const blImage<blDataType>& irfft2(const blImage< std::complex<blDataType> >& halfSpectrum,
+                                         blFFTPlan<blDataType>& plan)
+{
+    return plan.inverseHalfSpectrumToReal(halfSpectrum);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following functions take the
+// full complex fft of a real image
+// and back using a plan
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline const blImage< std::complex<blDataType> >& fft2(const blImage<blDataType>& srcImage,
+                                                       blFFTPlan<blDataType>& plan)
+{
+    return plan.forward(srcImage);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline const blImage<blDataType>& ifft2(const blImage< std::complex<blDataType> >& spectrum,
+                                        blFFTPlan<blDataType>& plan)
+{
+    return plan.inverse(spectrum);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FFTPLAN_HPP
@@ -0,0 +1,320 @@
+#ifndef BL_FFTSHIFT_HPP
+#define BL_FFTSHIFT_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFFTShift.hpp
+// CLASS:           blShiftedImageView
+// BASE CLASS:      None
+//
+// PURPOSE:         - The fftshift/ifftshift functions, which move
+//                    the zero frequency of an fft image to the
+//                    middle of the image and back
+//                  - A view of an image that reads it as if it had
+//                    been shifted, without moving any data
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImage -- The images shifted
+//                  shiftImageByNRowsAndMCols -- Used to move the
+//                                               quadrants
+//
+// NOTES:           - Just like numpy/matlab, fftshift moves element 0
+//                    to element n/2 along each dimension and ifftshift
+//                    undoes it, which makes a difference only for odd
+//                    sizes
+//                  - The rows are moved as (at most) two contiguous
+//                    segments each, so the shifts are plain block
+//                    copies (or block swaps in place)
+//                  - Unlike shiftImageForFourierTransform, which
+//                    modulates the image before the transform, these
+//                    work on the transform itself
+//                  - The shifts work on the ROI of the images, and
+//                    in place when the source is the destination
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions move the
+// zero frequency of an fft image to
+// the middle of the image (fftshift)
+// and back (ifftshift)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void fftshift(blImage<blDataType>& img)
+{
+    shiftImageByNRowsAndMCols(img,img.size1ROI() / 2,img.size2ROI() / 2);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void fftshift(const blImage<blDataType>& srcImg,
+                     blImage<blDataType>& dstImg)
+{
+    // The destination gets the
+    // size of the source ROI
+    // unless its ROI already has it
+
+    if(srcImg.getImageSharedPtr() != dstImg.getImageSharedPtr() &&
+       (dstImg.empty() ||
+        dstImg.size1ROI() != srcImg.size1ROI() ||
+        dstImg.size2ROI() != srcImg.size2ROI()))
+    {
+        dstImg.create(srcImg.size1ROI(),srcImg.size2ROI());
+        dstImg.resetROI();
+    }
+
+    shiftImageByNRowsAndMCols(srcImg,dstImg,srcImg.size1ROI() / 2,srcImg.size2ROI() / 2);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void ifftshift(blImage<blDataType>& img)
+{
+    shiftImageByNRowsAndMCols(img,-(img.size1ROI() / 2),-(img.size2ROI() / 2));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void ifftshift(const blImage<blDataType>& srcImg,
+                      blImage<blDataType>& dstImg)
+{
+    // The destination gets the
+    // size of the source ROI
+    // unless its ROI already has it
+
+    if(srcImg.getImageSharedPtr() != dstImg.getImageSharedPtr() &&
+       (dstImg.empty() ||
+        dstImg.size1ROI() != srcImg.size1ROI() ||
+        dstImg.size2ROI() != srcImg.size2ROI()))
+    {
+        dstImg.create(srcImg.size1ROI(),srcImg.size2ROI());
+        dstImg.resetROI();
+    }
+
+    shiftImageByNRowsAndMCols(srcImg,dstImg,-(srcImg.size1ROI() / 2),-(srcImg.size2ROI() / 2));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following class is a view of the
+// ROI of an image as if it had been
+// fftshifted (or ifftshifted), so that
+// (i,j) of the view reads the element
+// that the shift would have moved to
+// (i,j), without moving any data
+//
+// - The view keeps a reference to the
+//   image, which has to outlive it
+// - Every row of the view is made of
+//   (at most) two contiguous segments
+//   of one row of the image
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blShiftedImageView
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blShiftedImageView(blImage<blDataType>& img,
+                       const bool& isInverseShift = false);
+
+    // Destructor
+
+    ~blShiftedImageView()
+    {
+    }
+
+public: // Public functions
+
+    // Functions used to
+    // access the elements
+
+    blDataType&                                 operator()(const int& rowIndex,const int& colIndex);
+    const blDataType&                           operator()(const int& rowIndex,const int& colIndex)const;
+
+    // Functions used to get
+    // the size of the view
+
+    int                                         size1()const;
+    int                                         size2()const;
+
+    // Functions used to map view
+    // indices to the ROI indices
+    // of the image
+
+    int                                         getImageRowIndex(const int& rowIndex)const;
+    int                                         getImageColIndex(const int& colIndex)const;
+
+    // Function used to get the
+    // two segments of a row of
+    // the view, the first one
+    // holding the view's columns
+    // [0,firstSegmentLength)
+
+    void                                        getRowSegments(const int& rowIndex,
+                                                               blDataType*& firstSegment,
+                                                               int& firstSegmentLength,
+                                                               blDataType*& secondSegment,
+                                                               int& secondSegmentLength)const;
+
+private: // Private variables
+
+    blImage<blDataType>&                        m_image;
+
+    int                                         m_rows;
+    int                                         m_cols;
+
+    // The view index i reads the
+    // image index (i + offset) % size
+
+    int                                         m_rowOffset;
+    int                                         m_colOffset;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blShiftedImageView<blDataType>::blShiftedImageView(blImage<blDataType>& img,
+                                                          const bool& isInverseShift)
+                                                          : m_image(img)
+{
+    m_rows = img.size1ROI();
+    m_cols = img.size2ROI();
+
+    // fftshift moves index k to
+    // (k + n/2) % n, so the view
+    // reads (i - n/2) % n, while
+    // ifftshift does the opposite
+
+    if(isInverseShift)
+    {
+        m_rowOffset = m_rows / 2;
+        m_colOffset = m_cols / 2;
+    }
+    else
+    {
+        m_rowOffset = m_rows - m_rows / 2;
+        m_colOffset = m_cols - m_cols / 2;
+    }
+
+    if(m_rows > 0)
+        m_rowOffset %= m_rows;
+
+    if(m_cols > 0)
+        m_colOffset %= m_cols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blShiftedImageView<blDataType>::size1()const
+{
+    return m_rows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blShiftedImageView<blDataType>::size2()const
+{
+    return m_cols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blShiftedImageView<blDataType>::getImageRowIndex(const int& rowIndex)const
+{
+    int imageRowIndex = rowIndex + m_rowOffset;
+
+    return (imageRowIndex < m_rows ? imageRowIndex : imageRowIndex - m_rows);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blShiftedImageView<blDataType>::getImageColIndex(const int& colIndex)const
+{
+    int imageColIndex = colIndex + m_colOffset;
+
+    return (imageColIndex < m_cols ? imageColIndex : imageColIndex - m_cols);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blDataType& blShiftedImageView<blDataType>::operator()(const int& rowIndex,const int& colIndex)
+{
+    return m_image[m_image.yROI() + getImageRowIndex(rowIndex)][m_image.xROI() + getImageColIndex(colIndex)];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blDataType& blShiftedImageView<blDataType>::operator()(const int& rowIndex,const int& colIndex)const
+{
+    return m_image[m_image.yROI() + getImageRowIndex(rowIndex)][m_image.xROI() + getImageColIndex(colIndex)];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blShiftedImageView<blDataType>::getRowSegments(const int& rowIndex,
+                                                           blDataType*& firstSegment,
+                                                           int& firstSegmentLength,
+                                                           blDataType*& secondSegment,
+                                                           int& secondSegmentLength)const
+{
+    blDataType* imageRow = m_image[m_image.yROI() + getImageRowIndex(rowIndex)] + m_image.xROI();
+
+    firstSegment = imageRow + m_colOffset;
+    firstSegmentLength = m_cols - m_colOffset;
+
+    secondSegment = imageRow;
+    secondSegmentLength = m_colOffset;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FFTSHIFT_HPP
@@ -0,0 +1,343 @@
+#ifndef BL_FILTERMASKCACHE_HPP
+#define BL_FILTERMASKCACHE_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFilterMaskCache.hpp
+// CLASS:           blFilterMaskCache
+// BASE CLASS:      None
+//
+// PURPOSE:         A cache of the frequency domain filter masks
+//                  drawn by filterMask, so that filtering frame
+//                  after frame with the same settings only pays
+//                  for the mask once
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    filterMask -- Used to draw the masks
+//                  blImage -- Used to hold the masks
+//                  std::map -- Used to look the masks up
+//
+// NOTES:           - The masks are keyed on their size, filter
+//                    order, cutoff, bandwidth, filter type and
+//                    filter function type
+//                  - When the cache is full, the least recently
+//                    used mask is dropped
+//                  - The masks have the zero frequency in the
+//                    middle, just like filterMask
+//                  - A cache should only be used by one thread at
+//                    a time (getFilterMaskCache keeps one per thread)
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blFilterMaskCache
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blFilterMaskCache(const int& maxNumOfMasks = 8);
+
+    // Destructor
+
+    ~blFilterMaskCache()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to get a mask,
+    // which is drawn the first time
+    // it's asked for
+    // - The returned mask stays valid
+    //   until it gets dropped from the
+    //   cache
+
+    const blImage<blDataType>&                  getMask(const int& numOfRows,
+                                                        const int& numOfCols,
+                                                        const int& filterOrder,
+                                                        const double& cutoffFrequencyAsARatioOfImageRadius,
+                                                        const double& bandwidthAsARatioOfImageRadius,
+                                                        const blFilterTypeEnum& filterType = BL_LOWPASS,
+                                                        const blFilterFunctionTypeEnum& filterFunctionType = BL_BUTTERWORTH);
+
+    // Function used to filter a
+    // (shifted) spectrum in place
+    // using a cached mask of the
+    // spectrum's ROI size
+
+    void                                        applyMask(blImage< std::complex<blDataType> >& spectrumImage,
+                                                          const int& filterOrder,
+                                                          const double& cutoffFrequencyAsARatioOfImageRadius,
+                                                          const double& bandwidthAsARatioOfImageRadius,
+                                                          const blFilterTypeEnum& filterType = BL_LOWPASS,
+                                                          const blFilterFunctionTypeEnum& filterFunctionType = BL_BUTTERWORTH);
+
+    // Functions used to set/get
+    // the maximum number of masks
+    // kept in the cache
+
+    void                                        setMaxNumOfMasks(const int& maxNumOfMasks);
+    int                                         getMaxNumOfMasks()const;
+
+    // Function used to get the
+    // number of masks in the cache
+
+    int                                         getNumOfMasks()const;
+
+    // Function used to
+    // empty the cache
+
+    void                                        clear();
+
+private: // Private types
+
+    typedef std::tuple<int,int,int,double,double,int,int> blFilterMaskKey;
+
+    struct blCachedFilterMask
+    {
+        blImage<blDataType>                     m_mask;
+        unsigned long long                      m_lastUseTime = 0;
+    };
+
+private: // Private functions
+
+    // Function used to drop the least
+    // recently used masks until there
+    // are at most the given number left
+
+    void                                        dropLeastRecentlyUsedMasks(const int& maxNumOfMasksLeft);
+
+private: // Private variables
+
+    std::map<blFilterMaskKey,blCachedFilterMask> m_masks;
+
+    int                                         m_maxNumOfMasks;
+
+    // Counter used to keep
+    // track of when the masks
+    // were last used
+
+    unsigned long long                          m_useTime;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFilterMaskCache<blDataType>::blFilterMaskCache(const int& maxNumOfMasks)
+{
+    m_maxNumOfMasks = std::max(1,maxNumOfMasks);
+    m_useTime = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blFilterMaskCache<blDataType>::getMask(const int& numOfRows,
+                                                                        const int& numOfCols,
+                                                                        const int& filterOrder,
+                                                                        const double& cutoffFrequencyAsARatioOfImageRadius,
+                                                                        const double& bandwidthAsARatioOfImageRadius,
+                                                                        const blFilterTypeEnum& filterType,
+                                                                        const blFilterFunctionTypeEnum& filterFunctionType)
+{
+    blFilterMaskKey key(numOfRows,
+                        numOfCols,
+                        filterOrder,
+                        cutoffFrequencyAsARatioOfImageRadius,
+                        bandwidthAsARatioOfImageRadius,
+                        int(filterType),
+                        int(filterFunctionType));
+
+    ++m_useTime;
+
+    auto maskIterator = m_masks.find(key);
+
+    if(maskIterator != m_masks.end())
+    {
+        maskIterator->second.m_lastUseTime = m_useTime;
+
+        return maskIterator->second.m_mask;
+    }
+
+    // The mask is not in the
+    // cache, so we make room
+    // for it and draw it
+
+    dropLeastRecentlyUsedMasks(m_maxNumOfMasks - 1);
+
+    blCachedFilterMask& cachedMask = m_masks[key];
+
+    cachedMask.m_lastUseTime = m_useTime;
+    cachedMask.m_mask.create(numOfRows,numOfCols);
+
+    filterMask(cachedMask.m_mask,
+               filterOrder,
+               cutoffFrequencyAsARatioOfImageRadius,
+               bandwidthAsARatioOfImageRadius,
+               filterType,
+               filterFunctionType);
+
+    return cachedMask.m_mask;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFilterMaskCache<blDataType>::applyMask(blImage< std::complex<blDataType> >& spectrumImage,
+                                                     const int& filterOrder,
+                                                     const double& cutoffFrequencyAsARatioOfImageRadius,
+                                                     const double& bandwidthAsARatioOfImageRadius,
+                                                     const blFilterTypeEnum& filterType,
+                                                     const blFilterFunctionTypeEnum& filterFunctionType)
+{
+    int rows = spectrumImage.size1ROI();
+    int cols = spectrumImage.size2ROI();
+    int yROI = spectrumImage.yROI();
+    int xROI = spectrumImage.xROI();
+
+    const blImage<blDataType>& mask = getMask(rows,
+                                              cols,
+                                              filterOrder,
+                                              cutoffFrequencyAsARatioOfImageRadius,
+                                              bandwidthAsARatioOfImageRadius,
+                                              filterType,
+                                              filterFunctionType);
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            std::complex<blDataType>* spectrumRow = spectrumImage[i + yROI] + xROI;
+            const blDataType* maskRow = mask[i];
+
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+                spectrumRow[j] *= maskRow[j];
+        }
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFilterMaskCache<blDataType>::setMaxNumOfMasks(const int& maxNumOfMasks)
+{
+    m_maxNumOfMasks = std::max(1,maxNumOfMasks);
+
+    dropLeastRecentlyUsedMasks(m_maxNumOfMasks);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFilterMaskCache<blDataType>::getMaxNumOfMasks()const
+{
+    return m_maxNumOfMasks;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blFilterMaskCache<blDataType>::getNumOfMasks()const
+{
+    return int(m_masks.size());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFilterMaskCache<blDataType>::clear()
+{
+    m_masks.clear();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blFilterMaskCache<blDataType>::dropLeastRecentlyUsedMasks(const int& maxNumOfMasksLeft)
+{
+    while(int(m_masks.size()) > maxNumOfMasksLeft)
+    {
+        auto leastRecentlyUsedMask = m_masks.begin();
+
+        for(auto maskIterator = m_masks.begin(); maskIterator != m_masks.end(); ++maskIterator)
+        {
+            if(maskIterator->second.m_lastUseTime < leastRecentlyUsedMask->second.m_lastUseTime)
+                leastRecentlyUsedMask = maskIterator;
+        }
+
+        m_masks.erase(leastRecentlyUsedMask);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the mask
+// cache kept by the calling thread
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blFilterMaskCache<blDataType>& getFilterMaskCache()
+{
+    static thread_local blFilterMaskCache<blDataType> filterMaskCache;
+
+    return filterMaskCache;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get a mask from
+// the calling thread's cache
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& getCachedFilterMask(const int& numOfRows,
+                                                      const int& numOfCols,
+                                                      const int& filterOrder,
+                                                      const double& cutoffFrequencyAsARatioOfImageRadius,
+                                                      const double& bandwidthAsARatioOfImageRadius,
+                                                      const blFilterTypeEnum& filterType = BL_LOWPASS,
+                                                      const blFilterFunctionTypeEnum& filterFunctionType = BL_BUTTERWORTH)
+{
+    return getFilterMaskCache<blDataType>().getMask(numOfRows,
+                                                    numOfCols,
+                                                    filterOrder,
+                                                    cutoffFrequencyAsARatioOfImageRadius,
+                                                    bandwidthAsARatioOfImageRadius,
+                                                    filterType,
+                                                    filterFunctionType);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FILTERMASKCACHE_HPP
@@ -314,41 +314,50 @@ inline void FromBGRtoHSV(const blImage< blColor3<blType> >& srcImage,
     // Let's make sure that the destination image
     // is the correct size
     if(dstImage.size1() != rows || dstImage.size2() != cols)
-        dstImage.Create(rows,cols);
+        dstImage.create(rows,cols);
 
     // Get the min and max possible
     // values for the source image
-    double SrcRangeMin = srcImage.GetRangeMin();
-    double SrcRangeMax = srcImage.GetRangeMax();
+    double SrcRangeMin = rangeMin(srcImage.getDepth());
+    double SrcRangeMax = rangeMax(srcImage.getDepth());
     double SrcRange = SrcRangeMax - SrcRangeMin;
-    int srcImageDepth = srcImage.GetDepth();
+    int srcImageDepth = srcImage.getDepth();
 
     // Get the min and max possible
     // values for the destination image
-    double DstRangeMin = dstImage.GetRangeMin();
-    double DstRangeMax = dstImage.GetRangeMax();
+    double DstRangeMin = rangeMin(dstImage.getDepth());
+    double DstRangeMax = rangeMax(dstImage.getDepth());
     double DstRange = DstRangeMax - SrcRangeMin;
-    int dstImageDepth = dstImage.GetDepth();
+    int dstImageDepth = dstImage.getDepth();
+
+    // The conversion is run over
+    // the tiles of the image using
+    // the shared thread pool
 
-    // Temporary color variable
-    blColor3<double> srcColor;
-    blColor3<double> dstColor;
-    for(int i = 0; i < rows; ++i)
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int j = 0; j < cols; ++j)
+        // Temporary color variables
+
+        blColor3<double> srcColor;
+        blColor3<double> dstColor;
+
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            srcColor = srcImage[i][j];
-            FromBGRtoHSVColor(srcColor,
-                              dstColor,
-                              SrcRangeMin,
-                              SrcRange,
-                              srcImageDepth,
-                              DstRangeMin,
-                              DstRange,
-                              dstImageDepth);
-            dstImage[i][j] = dstColor;
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+            {
+                srcColor = srcImage[i][j];
+                FromBGRtoHSVColor(srcColor,
+                                  dstColor,
+                                  SrcRangeMin,
+                                  SrcRange,
+                                  srcImageDepth,
+                                  DstRangeMin,
+                                  DstRange,
+                                  dstImageDepth);
+                dstImage[i][j] = dstColor;
+            }
         }
-    }
+    });
 }
 //-------------------------------------------------------------------
 
@@ -408,45 +417,52 @@ inline void fromHSVtoBGR(const blImage< blColor3<blType> >& srcImage,
     // is the correct size
 
     if(dstImage.size1() != rows || dstImage.size2() != cols)
-        dstImage.Create(rows,cols);
+        dstImage.create(rows,cols);
 
     // Get the min and max possible
     // values for the source image
 
-    double SrcRangeMin = srcImage.GetRangeMin();
-    double SrcRangeMax = srcImage.GetRangeMax();
+    double SrcRangeMin = rangeMin(srcImage.getDepth());
+    double SrcRangeMax = rangeMax(srcImage.getDepth());
     double SrcRange = SrcRangeMax - SrcRangeMin;
-    int srcImageDepth = srcImage.GetDepth();
+    int srcImageDepth = srcImage.getDepth();
 
     // Get the min and max possible
     // values for the destination image
 
-    double DstRangeMin = dstImage.GetRangeMin();
-    double DstRangeMax = dstImage.GetRangeMax();
+    double DstRangeMin = rangeMin(dstImage.getDepth());
+    double DstRangeMax = rangeMax(dstImage.getDepth());
     double DstRange = DstRangeMax - SrcRangeMin;
-    int dstImageDepth = dstImage.GetDepth();
-
-    // Temporary color variable
+    int dstImageDepth = dstImage.getDepth();
 
-    blColor3<double> srcColor;
-    blColor3<double> dstColor;
+    // The conversion is run over
+    // the tiles of the image using
+    // the shared thread pool
 
-    for(int i = 0; i < rows; ++i)
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int j = 0; j < cols; ++j)
+        // Temporary color variables
+
+        blColor3<double> srcColor;
+        blColor3<double> dstColor;
+
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            srcColor = srcImage[i][j];
-            FromHSVtoBGRColor(srcColor,
-                              dstColor,
-                              SrcRangeMin,
-                              SrcRange,
-                              srcImageDepth,
-                              DstRangeMin,
-                              DstRange,
-                              dstImageDepth);
-            dstImage[i][j] = dstColor;
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+            {
+                srcColor = srcImage[i][j];
+                FromHSVtoBGRColor(srcColor,
+                                  dstColor,
+                                  SrcRangeMin,
+                                  SrcRange,
+                                  srcImageDepth,
+                                  DstRangeMin,
+                                  DstRange,
+                                  dstImageDepth);
+                dstImage[i][j] = dstColor;
+            }
         }
-    }
+    });
 }
 //-------------------------------------------------------------------
 
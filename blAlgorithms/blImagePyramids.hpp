@@ -9,7 +9,8 @@
 // BASE CLASS:      None
 //
 // PURPOSE:         A collection of algorithms I wrote to facilitate
-//                  the generation of image pyramids
+//                  the generation of image pyramids, and their
+//                  collapse back into images
 //
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
@@ -405,6 +406,116 @@ inline blImage<blDataType>& buildLaplacianPyramid(const blImage<blDataType>& src
 
 
 
+//-------------------------------------------------------------------
+// This function collapses a laplacian pyramid laid out
+// like buildLaplacianPyramid lays it out (level 0 image
+// on the left side and the higher level images on the
+// right side aligned vertically), in place, so that
+// afterwards every level holds the gaussian image of
+// that level and level 0 holds the reconstructed image
+// The worker image is only (re)allocated when it's
+// smaller than level 0, so it can be reused across calls
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImage<blDataType>& collapseLaplacianPyramid(blImage<blDataType>& laplacianPyramidImage,
+                                                     blImage<blDataType>& workerImage,
+                                                     const int& srcImageRows,
+                                                     const int& srcImageCols,
+                                                     const int& filterType = CV_GAUSSIAN_5x5)
+{
+    // Count the number of
+    // pyramid levels
+
+    int maxNumberOfPyramidLevels = calculateMaxNumberOfPyramidLevels(srcImageRows,srcImageCols);
+
+
+
+    // Make sure the worker image
+    // can hold the level 0 image
+
+    if(workerImage.empty() ||
+       workerImage.size1() < srcImageRows ||
+       workerImage.size2() < srcImageCols)
+    {
+        workerImage.create(srcImageRows,srcImageCols);
+    }
+
+
+
+    // Get the starting coordinates of the
+    // pyramid image ROI
+
+    int starting_yROI = laplacianPyramidImage.yROI();
+    int starting_xROI = laplacianPyramidImage.xROI();
+
+
+
+    // The last level already holds the
+    // last gaussian image, so starting
+    // from the level below it, we add
+    // the upsampled level above to each
+    // level
+
+    for(int level = maxNumberOfPyramidLevels - 2; level >= 0; --level)
+    {
+        // First we upsample the level
+        // above into the worker image
+
+        setROIofPyramidforSpecifiedLevel(laplacianPyramidImage,
+                                         level,
+                                         starting_yROI,
+                                         starting_xROI,
+                                         srcImageRows,
+                                         srcImageCols);
+
+        workerImage.setROI(0,0,laplacianPyramidImage.size1ROI(),laplacianPyramidImage.size2ROI());
+
+        setROIofPyramidforSpecifiedLevel(laplacianPyramidImage,
+                                         level + 1,
+                                         starting_yROI,
+                                         starting_xROI,
+                                         srcImageRows,
+                                         srcImageCols);
+
+        cvPyrUp(laplacianPyramidImage,workerImage,filterType);
+
+
+
+        // Then we add it to the
+        // current level
+
+        setROIofPyramidforSpecifiedLevel(laplacianPyramidImage,
+                                         level,
+                                         starting_yROI,
+                                         starting_xROI,
+                                         srcImageRows,
+                                         srcImageCols);
+
+        cvAdd(laplacianPyramidImage,
+              workerImage,
+              laplacianPyramidImage,
+              NULL);
+    }
+
+
+
+    // Let's not forget to reset the
+    // ROI coordinates of the pyramid
+    // image
+
+    laplacianPyramidImage.setROI(starting_yROI,
+                                 starting_xROI,
+                                 srcImageRows,
+                                 srcImageCols + (srcImageCols + 1)/2,
+                                 false);
+
+    return laplacianPyramidImage;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 
@@ -599,4 +710,63 @@ inline void buildLaplacianPyramids(const blGaussianPyramidIteratorType& iterator
 
 
 
+//-------------------------------------------------------------------
+// This function is the inverse of buildLaplacianPyramids,
+// it rebuilds the gaussian images from the last gaussian
+// image and the laplacian images, so that the first
+// gaussian image is the reconstructed image
+//-------------------------------------------------------------------
+template<typename blGaussianPyramidIteratorType,
+         typename blLaplacianPyramidIteratorType>
+
+inline void collapseLaplacianPyramids(const blGaussianPyramidIteratorType& iteratorToBeginningOfGaussianPyramid,
+                                      const blGaussianPyramidIteratorType& iteratorToEndOfGaussianPyramid,
+                                      const blLaplacianPyramidIteratorType& iteratorToBeginningOfLaplacianPyramid,
+                                      const blLaplacianPyramidIteratorType& iteratorToEndOfLaplacianPyramid,
+                                      const int& filterType = CV_GAUSSIAN_5x5)
+{
+    // The number of levels that can
+    // be collapsed (each laplacian
+    // image needs a gaussian image
+    // above it)
+
+    int numberOfLevels = std::min(int(std::distance(iteratorToBeginningOfGaussianPyramid,iteratorToEndOfGaussianPyramid)),
+                                  int(std::distance(iteratorToBeginningOfLaplacianPyramid,iteratorToEndOfLaplacianPyramid)) + 1);
+
+    if(numberOfLevels < 2)
+    {
+        // There's nothing
+        // to collapse
+
+        return;
+    }
+
+    // Starting from the level below
+    // the last one, each gaussian
+    // image is the upsampled gaussian
+    // image above it plus the
+    // laplacian image
+
+    for(int level = numberOfLevels - 2; level >= 0; --level)
+    {
+        auto iteratorToCurrentGaussianImage = std::next(iteratorToBeginningOfGaussianPyramid,level);
+        auto iteratorToNextGaussianImage = std::next(iteratorToCurrentGaussianImage);
+        auto iteratorToCurrentLaplacianImage = std::next(iteratorToBeginningOfLaplacianPyramid,level);
+
+        iteratorToCurrentGaussianImage->setROI(iteratorToCurrentLaplacianImage->getROIRect(),true);
+
+        cvPyrUp(*iteratorToNextGaussianImage,
+                *iteratorToCurrentGaussianImage,
+                filterType);
+
+        cvAdd(*iteratorToCurrentLaplacianImage,
+              *iteratorToCurrentGaussianImage,
+              *iteratorToCurrentGaussianImage,
+              NULL);
+    }
+}
+//-------------------------------------------------------------------
+
+
+
 #endif // BL_IMAGEPYRAMIDS_HPP
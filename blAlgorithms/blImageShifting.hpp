@@ -39,9 +39,37 @@
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// The following function copies a row
+// circularly shifted to the right by
+// colShift elements (0 <= colShift < cols)
+// as two block copies
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void copyCircularlyShiftedRow(const blDataType* srcRow,
+                                     blDataType* dstRow,
+                                     const int& cols,
+                                     const int& colShift)
+{
+    std::copy(srcRow,srcRow + cols - colShift,dstRow + colShift);
+    std::copy(srcRow + cols - colShift,srcRow + cols,dstRow);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 // The following function shifts an
 // image by M rows and N columns
+// (circularly, within its ROI)
+//
+// - Shifting by half the ROI in both
+//   directions swaps the diagonal
+//   quadrants with block swaps
+// - Otherwise each row is rotated in
+//   place and the rows are moved along
+//   the cycles of the row permutation
+//   through a single scratch row
 //-------------------------------------------------------------------
 template<typename blDataType>
 
@@ -49,17 +77,92 @@ inline void shiftImageByNRowsAndMCols(blImage<blDataType>& img,
                                       const int& howManyRowsToShiftBy,
                                       const int& howManyColsToShiftBy)
 {
-    if(howManyRowsToShiftBy == 0 && howManyColsToShiftBy == 0)
+    int rows = img.size1ROI();
+    int cols = img.size2ROI();
+    int yROI = img.yROI();
+    int xROI = img.xROI();
+
+    if(img.empty() || rows <= 0 || cols <= 0)
         return;
 
-    blImage<blDataType> tempImg;
-    tempImg.clone(img);
+    int rowShift = ((howManyRowsToShiftBy % rows) + rows) % rows;
+    int colShift = ((howManyColsToShiftBy % cols) + cols) % cols;
+
+    if(rowShift == 0 && colShift == 0)
+        return;
 
-    for(int i = 0; i < img.size1ROI(); ++i)
+    if(2 * rowShift == rows && 2 * colShift == cols)
     {
-        for(int j = 0; j < img.size2ROI(); ++j)
+        parallelForTiles(rows / 2,cols,[&](const blImageTile& tile)
         {
-            img.circ_atROI(i+howManyRowsToShiftBy,j+howManyColsToShiftBy) = tempImg.circ_atROI(i,j);
+            for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+            {
+                blDataType* topRow = img[yROI + i] + xROI;
+                blDataType* bottomRow = img[yROI + i + rowShift] + xROI;
+
+                std::swap_ranges(topRow,topRow + colShift,bottomRow + colShift);
+                std::swap_ranges(topRow + colShift,topRow + cols,bottomRow);
+            }
+        });
+
+        return;
+    }
+
+    if(colShift != 0)
+    {
+        parallelForTiles(rows,cols,[&](const blImageTile& tile)
+        {
+            for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+            {
+                blDataType* row = img[yROI + i] + xROI;
+
+                std::rotate(row,row + cols - colShift,row + cols);
+            }
+        });
+    }
+
+    if(rowShift != 0)
+    {
+        static thread_local std::vector<blDataType> scratchRow;
+
+        scratchRow.resize(cols);
+
+        // The row permutation is made
+        // of gcd(rows,rowShift) cycles
+
+        int numOfCycles = rows;
+
+        for(int b = rowShift; b != 0; )
+        {
+            int remainder = numOfCycles % b;
+            numOfCycles = b;
+            b = remainder;
+        }
+
+        for(int cycleStart = 0; cycleStart < numOfCycles; ++cycleStart)
+        {
+            std::copy(img[yROI + cycleStart] + xROI,
+                      img[yROI + cycleStart] + xROI + cols,
+                      scratchRow.begin());
+
+            // Row i moves to row
+            // (i + rowShift) % rows, so
+            // we walk the cycle backwards
+
+            int dstRowIndex = cycleStart;
+            int srcRowIndex = (dstRowIndex + rows - rowShift) % rows;
+
+            while(srcRowIndex != cycleStart)
+            {
+                std::copy(img[yROI + srcRowIndex] + xROI,
+                          img[yROI + srcRowIndex] + xROI + cols,
+                          img[yROI + dstRowIndex] + xROI);
+
+                dstRowIndex = srcRowIndex;
+                srcRowIndex = (dstRowIndex + rows - rowShift) % rows;
+            }
+
+            std::copy(scratchRow.begin(),scratchRow.end(),img[yROI + dstRowIndex] + xROI);
         }
     }
 }
@@ -87,13 +190,49 @@ inline void shiftImageByNRowsAndMCols(const blImage<blDataType>& srcImage,
         return;
     }
 
-    for(int i = 0; i < srcImage.size1ROI(); ++i)
+    int rows = srcImage.size1ROI();
+    int cols = srcImage.size2ROI();
+
+    if(srcImage.empty() || dstImage.empty() || rows <= 0 || cols <= 0)
+        return;
+
+    // When the ROIs have different
+    // sizes the shifted image wraps
+    // around the destination ROI
+
+    if(dstImage.size1ROI() != rows || dstImage.size2ROI() != cols)
     {
-        for(int j = 0; j < srcImage.size2ROI(); ++j)
+        for(int i = 0; i < rows; ++i)
         {
-            dstImage.circ_atROI(i+howManyRowsToShiftBy,j+howManyColsToShiftBy) = srcImage.circ_atROI(i,j);
+            for(int j = 0; j < cols; ++j)
+            {
+                dstImage.circ_atROI(i+howManyRowsToShiftBy,j+howManyColsToShiftBy) = srcImage.circ_atROI(i,j);
+            }
         }
+
+        return;
     }
+
+    int srcyROI = srcImage.yROI();
+    int srcxROI = srcImage.xROI();
+    int dstyROI = dstImage.yROI();
+    int dstxROI = dstImage.xROI();
+
+    int rowShift = ((howManyRowsToShiftBy % rows) + rows) % rows;
+    int colShift = ((howManyColsToShiftBy % cols) + cols) % cols;
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            int iDst = (i + rowShift < rows) ? (i + rowShift) : (i + rowShift - rows);
+
+            copyCircularlyShiftedRow(srcImage[srcyROI + i] + srcxROI,
+                                     dstImage[dstyROI + iDst] + dstxROI,
+                                     cols,
+                                     colShift);
+        }
+    });
 }
 //-------------------------------------------------------------------
 
@@ -126,15 +265,17 @@ inline void splitImageIntoVectorOfSubImages(const blImage<blDataType>& srcImage,
     // if necessary so it can
     // hold all the images
 
-    if(vectorOfSplitImages.size() < (howManyTimesShouldTheImageBeSplitVertically * howManyTimesShouldTheImageBeSplitHorizontally) )
+    // NOTE:  Default constructed
+    //        images are empty, so
+    //        this does not allocate
+    //        any image data, each
+    //        sub image gets created
+    //        once below when its ROI
+    //        is set
+
+    if(vectorOfSplitImages.size() < std::size_t(howManyTimesShouldTheImageBeSplitVertically * howManyTimesShouldTheImageBeSplitHorizontally) )
     {
-        for(int i = int(vectorOfSplitImages.size());
-            i < (howManyTimesShouldTheImageBeSplitVertically * howManyTimesShouldTheImageBeSplitHorizontally);
-            ++i)
-        {
-            blImage<blDataType> newImage;
-            vectorOfSplitImages.push_back(newImage);
-        }
+        vectorOfSplitImages.resize(howManyTimesShouldTheImageBeSplitVertically * howManyTimesShouldTheImageBeSplitHorizontally);
     }
 
     // Now we calculate the
@@ -0,0 +1,665 @@
+#ifndef BL_INCREMENTALPYRAMID_HPP
+#define BL_INCREMENTALPYRAMID_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blIncrementalPyramid.hpp
+// CLASS:           blIncrementalPyramid
+// BASE CLASS:      None
+//
+// PURPOSE:         A gaussian pyramid for static camera video, which
+//                  is updated frame after frame by rebuilding only
+//                  the tiles of each level whose footprint changed
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blPyramid -- Holds the pyramid
+//                  blPyramidKernels -- Used to rebuild the rectangles
+//                                      of the levels
+//                  blParallelForTiles -- Used to run the tiles
+//
+// NOTES:           - Each level is split in square tiles (in the
+//                    pixels of that level)
+//                  - The tiles of level 0 that changed are found
+//                    either with a dirty region mask (any non zero
+//                    pixel in a tile marks it) or by comparing every
+//                    tile with the previous frame (a tile changed when
+//                    a value differs by more than the change threshold)
+//                    and only those tiles are copied into level 0
+//                  - The dirty tiles of a level are grown by the reach
+//                    of the 5x5 filter and halved to get the dirty
+//                    tiles of the next level, and only those are
+//                    rebuilt, so the pyramid is always exactly the
+//                    pyramid of level 0
+//                  - Runs of dirty tiles along a row of tiles are
+//                    merged into one rectangle, and getDirtyRects
+//                    gives the rectangles that changed at each level
+//                    with the last update
+//                  - The first frame, a frame of a different size and
+//                    the depths the level rectangle functions don't
+//                    support build the whole pyramid, with every
+//                    level marked as dirty
+//                  - Only the gaussian pyramid is updated incrementally,
+//                    buildLaplacianPyramid rebuilds the whole laplacian
+//                    pyramid from it
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the functions used to
+// copy a tile of a new frame over the
+// same tile of the previous frame only
+// when it changed, returning whether it
+// did
+//-------------------------------------------------------------------
+typedef bool (*blCopyChangedTileFunction)(const CvMat* srcTile,
+                                          CvMat* dstTile,
+                                          const double& changeThreshold);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function copies a tile
+// when any of its values differs from
+// the destination by more than the
+// change threshold
+//-------------------------------------------------------------------
+template<typename blChannelType>
+
+inline bool copyChangedTile(const CvMat* srcTile,
+                            CvMat* dstTile,
+                            const double& changeThreshold)
+{
+    const int rowLength = srcTile->cols * CV_MAT_CN(srcTile->type);
+
+    bool hasTileChanged = false;
+
+    for(int i = 0; i < srcTile->rows && !hasTileChanged; ++i)
+    {
+        const blChannelType* srcRow = reinterpret_cast<const blChannelType*>(srcTile->data.ptr + i * srcTile->step);
+        const blChannelType* dstRow = reinterpret_cast<const blChannelType*>(dstTile->data.ptr + i * dstTile->step);
+
+        if(changeThreshold <= 0)
+        {
+            hasTileChanged = (std::memcmp(srcRow,dstRow,rowLength * sizeof(blChannelType)) != 0);
+        }
+        else
+        {
+            for(int k = 0; k < rowLength && !hasTileChanged; ++k)
+                hasTileChanged = (std::abs(double(srcRow[k]) - double(dstRow[k])) > changeThreshold);
+        }
+    }
+
+    if(hasTileChanged)
+        cvCopy(srcTile,dstTile);
+
+    return hasTileChanged;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the copy function
+// of a (CvMat) depth, or NULL when the
+// depth is not supported
+//-------------------------------------------------------------------
+inline blCopyChangedTileFunction getCopyChangedTileFunction(const int& depth)
+{
+    switch(depth)
+    {
+    case CV_8U: return &copyChangedTile<unsigned char>;
+    case CV_8S: return &copyChangedTile<signed char>;
+    case CV_16U: return &copyChangedTile<unsigned short>;
+    case CV_16S: return &copyChangedTile<short>;
+    case CV_32S: return &copyChangedTile<int>;
+    case CV_32F: return &copyChangedTile<float>;
+    case CV_64F: return &copyChangedTile<double>;
+    default: return NULL;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blIncrementalPyramid
+{
+public: // Constructors and destructors
+
+    // Default constructor
+    // - A number of levels of zero
+    //   uses as many levels as the
+    //   frames allow
+
+    blIncrementalPyramid(const int& numOfLevels = 0,
+                         const int& tileSize = 32);
+
+    // Destructor
+
+    ~blIncrementalPyramid()
+    {
+    }
+
+public: // Public functions
+
+    // Functions used to update the
+    // pyramid with the ROI of a new
+    // frame, finding the tiles that
+    // changed with the change detector
+    // or with a dirty region mask (of
+    // the frame's ROI size)
+
+    bool                                        update(const blImage<blDataType>& frame);
+
+    bool                                        update(const blImage<blDataType>& frame,
+                                                       const blImage<unsigned char>& dirtyMask);
+
+    // Function used to force the
+    // next update to build the
+    // whole pyramid
+
+    void                                        invalidate();
+
+    // Function used to build the
+    // laplacian pyramid from the
+    // gaussian pyramid
+
+    bool                                        buildLaplacianPyramid();
+
+    // Functions used to set/get
+    // the change threshold of the
+    // change detector (0 means any
+    // change at all)
+
+    void                                        setChangeThreshold(const double& changeThreshold);
+    double                                      getChangeThreshold()const;
+
+    // Function used to get
+    // the tile size
+
+    int                                         getTileSize()const;
+
+    // Function used to get the
+    // rectangles of a level that
+    // changed with the last update
+
+    const std::vector<CvRect>&                  getDirtyRects(const int& level)const;
+
+    // Function used to get
+    // the pyramid
+
+    const blPyramid<blDataType>&                getPyramid()const;
+
+private: // Private functions
+
+    // Function used to update the
+    // pyramid with a frame and an
+    // optional dirty region mask
+
+    bool                                        updateFrame(const blImage<blDataType>& frame,
+                                                            const blImage<unsigned char>* dirtyMask);
+
+    // Function used to build the
+    // whole pyramid from a frame
+
+    bool                                        buildWholePyramid(const blImage<blDataType>& frame);
+
+    // Function used to find and
+    // copy the tiles of level 0
+    // that changed
+
+    void                                        updateLevel0(const blImage<blDataType>& frame,
+                                                             const blImage<unsigned char>* dirtyMask);
+
+    // Function used to mark the
+    // tiles of a level dirty from
+    // the dirty rectangles of the
+    // level below it
+
+    void                                        propagateDirtyRects(const int& level);
+
+    // Function used to rebuild the
+    // dirty rectangles of a level
+
+    void                                        rebuildDirtyRects(const int& level);
+
+    // Function used to merge the
+    // dirty tiles of a level into
+    // its dirty rectangles
+
+    void                                        collectDirtyRects(const int& level);
+
+    // Functions used to get the
+    // number of tile rows/cols
+    // of a level
+
+    int                                         getNumOfTileRows(const int& level)const;
+    int                                         getNumOfTileCols(const int& level)const;
+
+private: // Private variables
+
+    int                                         m_requestedNumOfLevels;
+    int                                         m_tileSize;
+    double                                      m_changeThreshold;
+
+    // Whether the pyramid can
+    // be updated incrementally
+
+    bool                                        m_isIncremental;
+
+    blPyramid<blDataType>                       m_pyramid;
+
+    // The functions for the
+    // depth of the pyramid
+
+    blBuildPyramidLevelRectFunction             m_buildLevelRectFunction;
+    blCopyChangedTileFunction                   m_copyChangedTileFunction;
+
+    // The dirty tiles of the level
+    // being updated and the dirty
+    // rectangles of every level
+
+    std::vector<unsigned char>                  m_dirtyTiles;
+    std::vector< std::vector<CvRect> >          m_dirtyRects;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blIncrementalPyramid<blDataType>::blIncrementalPyramid(const int& numOfLevels,
+                                                              const int& tileSize)
+{
+    m_requestedNumOfLevels = numOfLevels;
+    m_tileSize = std::max(1,tileSize);
+    m_changeThreshold = 0;
+
+    m_isIncremental = false;
+
+    m_buildLevelRectFunction = NULL;
+    m_copyChangedTileFunction = NULL;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blIncrementalPyramid<blDataType>::update(const blImage<blDataType>& frame)
+{
+    return updateFrame(frame,NULL);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blIncrementalPyramid<blDataType>::update(const blImage<blDataType>& frame,
+                                                     const blImage<unsigned char>& dirtyMask)
+{
+    if(dirtyMask.empty() ||
+       dirtyMask.size1ROI() != frame.size1ROI() ||
+       dirtyMask.size2ROI() != frame.size2ROI())
+    {
+        return false;
+    }
+
+    return updateFrame(frame,&dirtyMask);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blIncrementalPyramid<blDataType>::updateFrame(const blImage<blDataType>& frame,
+                                                          const blImage<unsigned char>* dirtyMask)
+{
+    if(frame.empty())
+        return false;
+
+    if(!m_isIncremental ||
+       frame.size1ROI() != m_pyramid.getNumOfRows() ||
+       frame.size2ROI() != m_pyramid.getNumOfCols())
+    {
+        return buildWholePyramid(frame);
+    }
+
+    updateLevel0(frame,dirtyMask);
+
+    // Each level only rebuilds the
+    // tiles that the dirty tiles of
+    // the level below it reach
+
+    for(int level = 1; level < m_pyramid.getNumOfLevels(); ++level)
+    {
+        propagateDirtyRects(level);
+
+        rebuildDirtyRects(level);
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blIncrementalPyramid<blDataType>::buildWholePyramid(const blImage<blDataType>& frame)
+{
+    m_isIncremental = false;
+
+    if(!m_pyramid.setup(frame.size1ROI(),frame.size2ROI(),m_requestedNumOfLevels))
+        return false;
+
+    if(!m_pyramid.buildGaussianPyramid(frame))
+        return false;
+
+    const CvMat* level0 = m_pyramid.getGaussianLevel(0);
+
+    m_buildLevelRectFunction = getBuildPyramidLevelRectFunction(CV_MAT_DEPTH(level0->type));
+    m_copyChangedTileFunction = getCopyChangedTileFunction(CV_MAT_DEPTH(level0->type));
+
+    m_isIncremental = (m_buildLevelRectFunction != NULL &&
+                       m_copyChangedTileFunction != NULL &&
+                       m_pyramid.getFilterType() == CV_GAUSSIAN_5x5);
+
+    // Every level changed
+
+    m_dirtyRects.resize(m_pyramid.getNumOfLevels());
+
+    for(int level = 0; level < m_pyramid.getNumOfLevels(); ++level)
+    {
+        const CvRect& levelRect = m_pyramid.getLevelRect(level);
+
+        m_dirtyRects[level].assign(1,cvRect(0,0,levelRect.width,levelRect.height));
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::updateLevel0(const blImage<blDataType>& frame,
+                                                           const blImage<unsigned char>* dirtyMask)
+{
+    const int numOfTileCols = getNumOfTileCols(0);
+
+    m_dirtyTiles.assign(getNumOfTileRows(0) * numOfTileCols,0);
+
+    CvMat* level0 = m_pyramid.getGaussianLevel(0);
+
+    // The region is split in
+    // whole tiles (or run as one
+    // region when it's small), so
+    // we go over the tiles of each
+    // region
+
+    parallelForTiles(m_pyramid.getNumOfRows(),m_pyramid.getNumOfCols(),[&](const blImageTile& region)
+    {
+        for(int y = region.m_row; y < region.m_row + region.m_numOfRows; y += m_tileSize)
+        {
+            for(int x = region.m_col; x < region.m_col + region.m_numOfCols; x += m_tileSize)
+            {
+                CvRect tileRect = cvRect(x,
+                                         y,
+                                         std::min(m_tileSize,region.m_col + region.m_numOfCols - x),
+                                         std::min(m_tileSize,region.m_row + region.m_numOfRows - y));
+
+                CvMat srcTile;
+                CvMat dstTile;
+
+                cvGetSubRect(frame,&srcTile,tileRect);
+                cvGetSubRect(level0,&dstTile,tileRect);
+
+                bool isTileDirty = false;
+
+                if(dirtyMask != NULL)
+                {
+                    for(int i = 0; i < tileRect.height && !isTileDirty; ++i)
+                    {
+                        const unsigned char* maskRow = (*dirtyMask)[dirtyMask->yROI() + y + i] + dirtyMask->xROI() + x;
+
+                        for(int j = 0; j < tileRect.width && !isTileDirty; ++j)
+                            isTileDirty = (maskRow[j] != 0);
+                    }
+
+                    if(isTileDirty)
+                        cvCopy(&srcTile,&dstTile);
+                }
+                else
+                {
+                    isTileDirty = m_copyChangedTileFunction(&srcTile,&dstTile,m_changeThreshold);
+                }
+
+                m_dirtyTiles[(y / m_tileSize) * numOfTileCols + x / m_tileSize] = (isTileDirty ? 1 : 0);
+            }
+        }
+    },
+    m_tileSize,
+    m_tileSize);
+
+    collectDirtyRects(0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::propagateDirtyRects(const int& level)
+{
+    const CvRect& levelRect = m_pyramid.getLevelRect(level);
+
+    const int numOfTileCols = getNumOfTileCols(level);
+
+    m_dirtyTiles.assign(getNumOfTileRows(level) * numOfTileCols,0);
+
+    // A pixel y of this level reads
+    // the rows [2y - 2,2y + 2] of the
+    // level below it (the reflected
+    // borders stay inside that range),
+    // so the rows [y0,y1) below reach
+    // the rows [(y0 - 1) / 2,(y1 + 1) / 2]
+    // of this level (and the same
+    // goes for the columns)
+
+    for(const CvRect& dirtyRect : m_dirtyRects[level - 1])
+    {
+        int firstRow = (dirtyRect.y < 2) ? 0 : (dirtyRect.y - 1) / 2;
+        int lastRow = std::min(levelRect.height,(dirtyRect.y + dirtyRect.height + 1) / 2 + 1);
+
+        int firstCol = (dirtyRect.x < 2) ? 0 : (dirtyRect.x - 1) / 2;
+        int lastCol = std::min(levelRect.width,(dirtyRect.x + dirtyRect.width + 1) / 2 + 1);
+
+        for(int tileRow = firstRow / m_tileSize; tileRow <= (lastRow - 1) / m_tileSize; ++tileRow)
+            for(int tileCol = firstCol / m_tileSize; tileCol <= (lastCol - 1) / m_tileSize; ++tileCol)
+                m_dirtyTiles[tileRow * numOfTileCols + tileCol] = 1;
+    }
+
+    collectDirtyRects(level);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::rebuildDirtyRects(const int& level)
+{
+    const std::vector<CvRect>& dirtyRects = m_dirtyRects[level];
+
+    if(dirtyRects.empty())
+        return;
+
+    const CvMat* previousLevel = m_pyramid.getGaussianLevel(level - 1);
+    CvMat* currentLevel = m_pyramid.getGaussianLevel(level);
+
+    // The rectangles don't overlap,
+    // so they can be rebuilt in any
+    // order, and when there's little
+    // to rebuild we don't wake up
+    // any threads
+
+    long long numOfDirtyPixels = 0;
+
+    for(const CvRect& dirtyRect : dirtyRects)
+        numOfDirtyPixels += (long long)(dirtyRect.width) * dirtyRect.height;
+
+    if(numOfDirtyPixels < 2LL * getTileThreadPool().getGrainSize())
+    {
+        for(const CvRect& dirtyRect : dirtyRects)
+            m_buildLevelRectFunction(previousLevel,currentLevel,dirtyRect);
+
+        return;
+    }
+
+    getTileThreadPool().runTasks(int(dirtyRects.size()),[&](int rectIndex)
+    {
+        m_buildLevelRectFunction(previousLevel,currentLevel,dirtyRects[rectIndex]);
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::collectDirtyRects(const int& level)
+{
+    const CvRect& levelRect = m_pyramid.getLevelRect(level);
+
+    const int numOfTileRows = getNumOfTileRows(level);
+    const int numOfTileCols = getNumOfTileCols(level);
+
+    std::vector<CvRect>& dirtyRects = m_dirtyRects[level];
+
+    dirtyRects.clear();
+
+    for(int tileRow = 0; tileRow < numOfTileRows; ++tileRow)
+    {
+        int y = tileRow * m_tileSize;
+        int height = std::min(m_tileSize,levelRect.height - y);
+
+        for(int tileCol = 0; tileCol < numOfTileCols; ++tileCol)
+        {
+            if(!m_dirtyTiles[tileRow * numOfTileCols + tileCol])
+                continue;
+
+            // We merge the run of dirty
+            // tiles starting at this one
+
+            int firstTileCol = tileCol;
+
+            while(tileCol + 1 < numOfTileCols && m_dirtyTiles[tileRow * numOfTileCols + tileCol + 1])
+                ++tileCol;
+
+            int x = firstTileCol * m_tileSize;
+            int width = std::min((tileCol + 1) * m_tileSize,levelRect.width) - x;
+
+            dirtyRects.push_back(cvRect(x,y,width,height));
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blIncrementalPyramid<blDataType>::getNumOfTileRows(const int& level)const
+{
+    return (m_pyramid.getLevelRect(level).height + m_tileSize - 1) / m_tileSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blIncrementalPyramid<blDataType>::getNumOfTileCols(const int& level)const
+{
+    return (m_pyramid.getLevelRect(level).width + m_tileSize - 1) / m_tileSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::invalidate()
+{
+    m_isIncremental = false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blIncrementalPyramid<blDataType>::buildLaplacianPyramid()
+{
+    return m_pyramid.buildLaplacianPyramid();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blIncrementalPyramid<blDataType>::setChangeThreshold(const double& changeThreshold)
+{
+    m_changeThreshold = changeThreshold;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline double blIncrementalPyramid<blDataType>::getChangeThreshold()const
+{
+    return m_changeThreshold;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blIncrementalPyramid<blDataType>::getTileSize()const
+{
+    return m_tileSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const std::vector<CvRect>& blIncrementalPyramid<blDataType>::getDirtyRects(const int& level)const
+{
+    return m_dirtyRects[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blPyramid<blDataType>& blIncrementalPyramid<blDataType>::getPyramid()const
+{
+    return m_pyramid;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_INCREMENTALPYRAMID_HPP
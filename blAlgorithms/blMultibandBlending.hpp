@@ -0,0 +1,396 @@
+#ifndef BL_MULTIBANDBLENDING_HPP
+#define BL_MULTIBANDBLENDING_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blMultibandBlending.hpp
+// CLASS:           blMultibandBlender
+// BASE CLASS:      None
+//
+// PURPOSE:         A multiband (laplacian pyramid) blender that
+//                  blends two images with a weights image, band by
+//                  band, so that seams are blended over a width that
+//                  matches the size of the details of each band
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blPyramid -- Holds the pyramids of the images
+//                               and of the weights
+//                  blParallelForTiles -- Used to blend the levels
+//
+// NOTES:           - The weights are the weights of the first image
+//                    (the second image gets one minus them), in the
+//                    range [0,1], one weight per pixel for all the
+//                    channels
+//                  - The gaussian pyramid of the weights is built
+//                    once when the weights are set, which suits
+//                    panorama/video blending where the seams don't
+//                    move from frame to frame
+//                  - The laplacian levels of the second image are
+//                    blended into the laplacian levels of the first
+//                    image in place (on the packed pyramid layout),
+//                    and that pyramid is then collapsed into its own
+//                    gaussian pyramid, so no other buffers are used
+//                  - All the pyramids are kept from call to call, so
+//                    blending frames of the same size never allocates
+//                    anything, and the memory used is fixed at a
+//                    packed gaussian and a packed laplacian pyramid
+//                    for each image, plus a packed gaussian pyramid
+//                    for the weights
+//                  - Laplacian levels of unsigned types lose their
+//                    negative values, so for good results the images
+//                    should be of a signed or floating point type
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the functions used to
+// blend two levels with a weights level
+// - The destination can be either one of
+//   the levels
+//-------------------------------------------------------------------
+typedef void (*blBlendPyramidLevelFunction)(const CvMat* weightsLevel,
+                                            const CvMat* level1,
+                                            const CvMat* level2,
+                                            CvMat* dstLevel);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to round and saturate
+// a blended value to a channel type
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline blChannelType saturateBlendedValue(const blWorkType& value,
+                                          const std::true_type& /*isIntegerChannel*/)
+{
+    blWorkType roundedValue = std::floor(value + blWorkType(0.5));
+
+    roundedValue = std::min<blWorkType>(std::max<blWorkType>(roundedValue,std::numeric_limits<blChannelType>::min()),
+                                        std::numeric_limits<blChannelType>::max());
+
+    return static_cast<blChannelType>(roundedValue);
+}
+
+
+template<typename blChannelType,
+         typename blWorkType>
+
+inline blChannelType saturateBlendedValue(const blWorkType& value,
+                                          const std::false_type& /*isIntegerChannel*/)
+{
+    return static_cast<blChannelType>(value);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function blends two
+// levels with a weights level, splitting
+// the rows across the thread pool
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void blendPyramidLevel(const CvMat* weightsLevel,
+                              const CvMat* level1,
+                              const CvMat* level2,
+                              CvMat* dstLevel)
+{
+    typedef std::integral_constant<bool,std::numeric_limits<blChannelType>::is_integer> isIntegerChannel;
+
+    const int numOfChannels = CV_MAT_CN(level1->type);
+    const int cols = level1->cols;
+
+    parallelForTiles(level1->rows,cols,[&](const blImageTile& tile)
+    {
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            const float* weightsRow = reinterpret_cast<const float*>(weightsLevel->data.ptr + i * weightsLevel->step);
+            const blChannelType* row1 = reinterpret_cast<const blChannelType*>(level1->data.ptr + i * level1->step);
+            const blChannelType* row2 = reinterpret_cast<const blChannelType*>(level2->data.ptr + i * level2->step);
+            blChannelType* dstRow = reinterpret_cast<blChannelType*>(dstLevel->data.ptr + i * dstLevel->step);
+
+            for(int j = 0; j < cols; ++j)
+            {
+                blWorkType weight = blWorkType(weightsRow[j]);
+
+                for(int ch = j * numOfChannels; ch < (j + 1) * numOfChannels; ++ch)
+                {
+                    dstRow[ch] = saturateBlendedValue<blChannelType>(blWorkType(row2[ch]) + weight * (blWorkType(row1[ch]) - blWorkType(row2[ch])),
+                                                                     isIntegerChannel());
+                }
+            }
+        }
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the blend
+// function of a (CvMat) depth, or NULL
+// when the depth is not supported
+//-------------------------------------------------------------------
+inline blBlendPyramidLevelFunction getBlendPyramidLevelFunction(const int& depth)
+{
+    switch(depth)
+    {
+    case CV_8U: return &blendPyramidLevel<unsigned char,float>;
+    case CV_8S: return &blendPyramidLevel<signed char,float>;
+    case CV_16U: return &blendPyramidLevel<unsigned short,float>;
+    case CV_16S: return &blendPyramidLevel<short,float>;
+    case CV_32S: return &blendPyramidLevel<int,double>;
+    case CV_32F: return &blendPyramidLevel<float,float>;
+    case CV_64F: return &blendPyramidLevel<double,double>;
+    default: return NULL;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blMultibandBlender
+{
+public: // Constructors and destructors
+
+    // Default constructor
+    // - A number of levels of zero
+    //   uses as many levels as the
+    //   images allow
+
+    blMultibandBlender(const int& numOfLevels = 0);
+
+    // Destructor
+
+    ~blMultibandBlender()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to set the
+    // weights of the first image,
+    // which also sets the size of
+    // the images to blend
+
+    bool                                        setWeights(const blImage<float>& weightsImage);
+
+    // Functions used to blend the
+    // ROIs of two images, which have
+    // to be the size of the weights,
+    // keeping the blended image in
+    // the blender and/or copying it
+    // into a destination image
+
+    bool                                        blend(const blImage<blDataType>& image1,
+                                                      const blImage<blDataType>& image2);
+
+    bool                                        blend(const blImage<blDataType>& image1,
+                                                      const blImage<blDataType>& image2,
+                                                      blImage<blDataType>& dstImage);
+
+    // Function used to get the last
+    // blended image (a view that's
+    // valid until the next blend)
+
+    const blPyramidLevel<blDataType>&           getBlendedImage()const;
+
+    // Functions used to get
+    // the settings of the blender
+
+    int                                         getNumOfRows()const;
+    int                                         getNumOfCols()const;
+    int                                         getNumOfLevels()const;
+
+private: // Private variables
+
+    int                                         m_requestedNumOfLevels;
+
+    // The pyramids of the weights
+    // and of the two images (the
+    // blended pyramid is kept in
+    // the first one)
+
+    blPyramid<float>                            m_weightsPyramid;
+
+    blPyramid<blDataType>                       m_pyramid1;
+    blPyramid<blDataType>                       m_pyramid2;
+
+    // The blend function for
+    // the depth of the images
+
+    blBlendPyramidLevelFunction                 m_blendLevelFunction;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blMultibandBlender<blDataType>::blMultibandBlender(const int& numOfLevels)
+{
+    m_requestedNumOfLevels = numOfLevels;
+
+    m_blendLevelFunction = NULL;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blMultibandBlender<blDataType>::setWeights(const blImage<float>& weightsImage)
+{
+    if(weightsImage.empty())
+        return false;
+
+    if(!m_weightsPyramid.setup(weightsImage.size1ROI(),weightsImage.size2ROI(),m_requestedNumOfLevels))
+        return false;
+
+    if(!m_weightsPyramid.buildGaussianPyramid(weightsImage))
+        return false;
+
+    // The image pyramids get
+    // the size of the weights
+
+    m_pyramid1.setup(m_weightsPyramid.getNumOfRows(),m_weightsPyramid.getNumOfCols(),m_requestedNumOfLevels);
+    m_pyramid2.setup(m_weightsPyramid.getNumOfRows(),m_weightsPyramid.getNumOfCols(),m_requestedNumOfLevels);
+
+    const CvMat* level0 = m_pyramid1.getGaussianLevel(0);
+
+    m_blendLevelFunction = getBlendPyramidLevelFunction(CV_MAT_DEPTH(level0->type));
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blMultibandBlender<blDataType>::blend(const blImage<blDataType>& image1,
+                                                  const blImage<blDataType>& image2)
+{
+    if(m_blendLevelFunction == NULL ||
+       image1.empty() ||
+       image2.empty())
+    {
+        return false;
+    }
+
+    if(image1.size1ROI() != getNumOfRows() || image1.size2ROI() != getNumOfCols() ||
+       image2.size1ROI() != getNumOfRows() || image2.size2ROI() != getNumOfCols())
+    {
+        return false;
+    }
+
+    if(!m_pyramid1.buildLaplacianPyramid(image1) ||
+       !m_pyramid2.buildLaplacianPyramid(image2))
+    {
+        return false;
+    }
+
+    // Each laplacian level of the
+    // second image is blended into
+    // the first one with the weights
+    // of that level
+
+    for(int level = 0; level < getNumOfLevels(); ++level)
+    {
+        m_blendLevelFunction(m_weightsPyramid.getGaussianLevel(level),
+                             m_pyramid1.getLaplacianLevel(level),
+                             m_pyramid2.getLaplacianLevel(level),
+                             m_pyramid1.getLaplacianLevel(level));
+    }
+
+    return m_pyramid1.collapseLaplacianPyramid();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blMultibandBlender<blDataType>::blend(const blImage<blDataType>& image1,
+                                                  const blImage<blDataType>& image2,
+                                                  blImage<blDataType>& dstImage)
+{
+    if(!blend(image1,image2))
+        return false;
+
+    // The destination gets the
+    // size of the images unless
+    // its ROI already has it
+
+    if(dstImage.empty() ||
+       dstImage.size1ROI() != getNumOfRows() ||
+       dstImage.size2ROI() != getNumOfCols())
+    {
+        dstImage.create(getNumOfRows(),getNumOfCols());
+        dstImage.resetROI();
+    }
+
+    cvCopy(getBlendedImage(),dstImage);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blPyramidLevel<blDataType>& blMultibandBlender<blDataType>::getBlendedImage()const
+{
+    return m_pyramid1.getGaussianLevel(0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blMultibandBlender<blDataType>::getNumOfRows()const
+{
+    return m_weightsPyramid.getNumOfRows();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blMultibandBlender<blDataType>::getNumOfCols()const
+{
+    return m_weightsPyramid.getNumOfCols();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blMultibandBlender<blDataType>::getNumOfLevels()const
+{
+    return m_weightsPyramid.getNumOfLevels();
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_MULTIBANDBLENDING_HPP
@@ -0,0 +1,892 @@
+#ifndef BL_PYRAMID_HPP
+#define BL_PYRAMID_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blPyramid.hpp
+// CLASS:           blPyramidLevel
+//                  blPyramid
+// BASE CLASS:      None
+//
+// PURPOSE:         - A reusable pyramid builder that keeps the
+//                    gaussian and laplacian pyramids of a given
+//                    frame size preallocated, so that building the
+//                    pyramids of frame after frame of the same size
+//                    never allocates anything
+//                  - Collapsing the laplacian pyramid back into the
+//                    gaussian pyramid, so the laplacian levels can be
+//                    edited (blended) in place and turned back into
+//                    an image
+//                  - A zero-copy view of one level of a pyramid
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blPyramidKernels -- Used to build and collapse
+//                                      the levels
+//                  cvPyrDown/cvPyrUp/cvSub/cvAdd -- Used for the
+//                                                   levels the kernels
+//                                                   don't support
+//                  cvGetSubRect -- Used to make the level views
+//                  blImage -- Used to hold the pyramids
+//
+// NOTES:           - The pyramids use the same packed layout as
+//                    buildGaussianPyramid/buildLaplacianPyramid, with
+//                    the level 0 image on the left side and all the
+//                    higher levels on the right side aligned
+//                    vertically, so getGaussianPyramidImage and
+//                    getLaplacianPyramidImage can be used wherever
+//                    those packed images were used
+//                  - The level rectangles and views are computed once
+//                    per frame size, and each level is built straight
+//                    from the level below it (no worker image and no
+//                    per-level copies)
+//                  - With the 5x5 gaussian filter and the depths
+//                    blPyramidKernels supports, each level is built
+//                    by the fused, parallel level functions, which
+//                    compute the next gaussian level and the laplacian
+//                    residual of the current one in the same sweep,
+//                    otherwise the levels are built with cvPyrDown,
+//                    cvPyrUp and cvSub
+//                  - The laplacian pyramid is only allocated the first
+//                    time it is built
+//                  - The last level of the laplacian pyramid is the
+//                    last level of the gaussian pyramid
+//                  - Collapsing writes every gaussian level from the
+//                    laplacian pyramid (level 0 being the image), and
+//                    leaves the laplacian pyramid untouched
+//                  - Laplacian levels of unsigned types lose their
+//                    negative values, so a pyramid that is collapsed
+//                    should use a signed or floating point type
+//                  - A pyramid should only be used by one thread at a
+//                    time
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following class is a view of one
+// level of a packed pyramid image
+//
+// - The view does not own the data, which
+//   belongs to the pyramid image
+// - It converts to a CvMat pointer, so it
+//   can be passed to the opencv functions
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blPyramidLevel
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blPyramidLevel();
+
+    // Constructor used to view
+    // a rectangle of an image
+
+    blPyramidLevel(const blImage<blDataType>& pyramidImage,
+                   const CvRect& levelRect);
+
+    // Destructor
+
+    ~blPyramidLevel()
+    {
+    }
+
+public: // Overloaded operators
+
+    // Access operators
+
+    blDataType*                                 operator[](const int& rowIndex);
+    const blDataType*                           operator[](const int& rowIndex)const;
+
+    blDataType&                                 operator()(const int& rowIndex,const int& colIndex);
+    const blDataType&                           operator()(const int& rowIndex,const int& colIndex)const;
+
+    // Operators used to convert
+    // the view to a CvMat pointer
+
+    operator CvMat*()
+    {
+        return &m_header;
+    }
+
+    operator const CvMat*()const
+    {
+        return &m_header;
+    }
+
+public: // Public functions
+
+    // Functions used to get
+    // the size of the level
+
+    int                                         size1()const;
+    int                                         size2()const;
+
+    // Function used to get the
+    // rectangle of the level in
+    // the pyramid image
+
+    const CvRect&                               getRect()const;
+
+    // Function used to get the
+    // number of bytes between
+    // the rows of the level
+
+    int                                         getWidthStep()const;
+
+private: // Private variables
+
+    CvMat                                       m_header;
+
+    CvRect                                      m_rect;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blPyramidLevel<blDataType>::blPyramidLevel()
+{
+    std::memset(&m_header,0,sizeof(CvMat));
+
+    m_rect = cvRect(0,0,0,0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blPyramidLevel<blDataType>::blPyramidLevel(const blImage<blDataType>& pyramidImage,
+                                                  const CvRect& levelRect)
+{
+    m_rect = levelRect;
+
+    cvGetSubRect(pyramidImage,&m_header,levelRect);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blDataType* blPyramidLevel<blDataType>::operator[](const int& rowIndex)
+{
+    return reinterpret_cast<blDataType*>(m_header.data.ptr + rowIndex * m_header.step);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blDataType* blPyramidLevel<blDataType>::operator[](const int& rowIndex)const
+{
+    return reinterpret_cast<const blDataType*>(m_header.data.ptr + rowIndex * m_header.step);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blDataType& blPyramidLevel<blDataType>::operator()(const int& rowIndex,const int& colIndex)
+{
+    return (*this)[rowIndex][colIndex];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blDataType& blPyramidLevel<blDataType>::operator()(const int& rowIndex,const int& colIndex)const
+{
+    return (*this)[rowIndex][colIndex];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramidLevel<blDataType>::size1()const
+{
+    return m_rect.height;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramidLevel<blDataType>::size2()const
+{
+    return m_rect.width;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const CvRect& blPyramidLevel<blDataType>::getRect()const
+{
+    return m_rect;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramidLevel<blDataType>::getWidthStep()const
+{
+    return m_header.step;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blPyramid
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blPyramid(const int& filterType = CV_GAUSSIAN_5x5);
+
+    // Destructor
+
+    ~blPyramid()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to set the
+    // pyramid up for a frame size
+    // (it does nothing when the
+    // pyramid is already set up
+    // for it)
+    // - A number of levels of zero
+    //   (or more than the frame
+    //   allows) uses as many levels
+    //   as the frame allows
+
+    bool                                        setup(const int& numOfRows,
+                                                      const int& numOfCols,
+                                                      const int& numOfLevels = 0);
+
+    // Functions used to build
+    // the pyramids of the ROI of
+    // a source image, which set
+    // the pyramid up for its size
+    // if needed (keeping the number
+    // of levels of the last setup)
+    // - Building the laplacian
+    //   pyramid builds the gaussian
+    //   pyramid first
+
+    bool                                        buildGaussianPyramid(const blImage<blDataType>& srcImage);
+    bool                                        buildLaplacianPyramid(const blImage<blDataType>& srcImage);
+
+    // Function used to build the
+    // laplacian pyramid from the
+    // current gaussian pyramid
+
+    bool                                        buildLaplacianPyramid();
+
+    // Functions used to collapse
+    // the laplacian pyramid into
+    // the gaussian pyramid, and
+    // to copy the collapsed image
+    // into a destination image
+
+    bool                                        collapseLaplacianPyramid();
+    bool                                        collapseLaplacianPyramid(blImage<blDataType>& dstImage);
+
+    // Functions used to set/get
+    // whether the fused level
+    // functions are used (when
+    // they support the pyramid)
+
+    void                                        useFusedKernels(const bool& shouldFusedKernelsBeUsed);
+    bool                                        areFusedKernelsUsed()const;
+
+    // Functions used to get
+    // the settings of the pyramid
+
+    int                                         getFilterType()const;
+    int                                         getNumOfRows()const;
+    int                                         getNumOfCols()const;
+    int                                         getNumOfLevels()const;
+
+    // Function used to get the
+    // rectangle of a level in the
+    // packed pyramid images
+
+    const CvRect&                               getLevelRect(const int& level)const;
+
+    // Functions used to get
+    // the levels of the pyramids
+
+    blPyramidLevel<blDataType>&                 getGaussianLevel(const int& level);
+    const blPyramidLevel<blDataType>&           getGaussianLevel(const int& level)const;
+
+    blPyramidLevel<blDataType>&                 getLaplacianLevel(const int& level);
+    const blPyramidLevel<blDataType>&           getLaplacianLevel(const int& level)const;
+
+    // Functions used to get
+    // the packed pyramid images
+
+    const blImage<blDataType>&                  getGaussianPyramidImage()const;
+    const blImage<blDataType>&                  getLaplacianPyramidImage()const;
+
+private: // Private functions
+
+    // Function used to allocate
+    // the laplacian pyramid the
+    // first time it's needed
+
+    void                                        setupLaplacianPyramid();
+
+    // Function used to set the
+    // pyramid up for the ROI size
+    // of a source image and copy
+    // it into level 0
+
+    bool                                        copySourceImage(const blImage<blDataType>& srcImage);
+
+    // Function used to get the
+    // fused level function, or NULL
+    // when it can't be used
+
+    blBuildPyramidLevelFunction                 getBuildLevelFunction()const;
+    blCollapsePyramidLevelFunction              getCollapseLevelFunction()const;
+
+private: // Private variables
+
+    int                                         m_filterType;
+
+    // The fused level functions
+    // for the depth of the pyramid
+
+    bool                                        m_shouldFusedKernelsBeUsed;
+    blBuildPyramidLevelFunction                 m_buildLevelFunction;
+    blCollapsePyramidLevelFunction              m_collapseLevelFunction;
+
+    int                                         m_numOfRows;
+    int                                         m_numOfCols;
+    int                                         m_numOfLevels;
+
+    // The number of levels asked
+    // for by the last setup, which
+    // is kept for the next frames
+
+    int                                         m_requestedNumOfLevels;
+
+    // The packed pyramid images
+
+    blImage<blDataType>                         m_gaussianPyramidImage;
+    blImage<blDataType>                         m_laplacianPyramidImage;
+
+    // The level rectangles
+    // and the level views
+
+    std::vector<CvRect>                         m_levelRects;
+
+    std::vector< blPyramidLevel<blDataType> >   m_gaussianLevels;
+    std::vector< blPyramidLevel<blDataType> >   m_laplacianLevels;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blPyramid<blDataType>::blPyramid(const int& filterType)
+{
+    m_filterType = filterType;
+
+    m_shouldFusedKernelsBeUsed = true;
+    m_buildLevelFunction = NULL;
+    m_collapseLevelFunction = NULL;
+
+    m_numOfRows = 0;
+    m_numOfCols = 0;
+    m_numOfLevels = 0;
+    m_requestedNumOfLevels = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::setup(const int& numOfRows,
+                                         const int& numOfCols,
+                                         const int& numOfLevels)
+{
+    if(numOfRows <= 0 || numOfCols <= 0)
+        return false;
+
+    m_requestedNumOfLevels = numOfLevels;
+
+    int maxNumOfLevels = std::max(1,calculateMaxNumberOfPyramidLevels(numOfRows,numOfCols));
+
+    int newNumOfLevels = maxNumOfLevels;
+
+    if(numOfLevels > 0)
+        newNumOfLevels = std::min(numOfLevels,maxNumOfLevels);
+
+    if(numOfRows == m_numOfRows &&
+       numOfCols == m_numOfCols &&
+       newNumOfLevels == m_numOfLevels)
+    {
+        return true;
+    }
+
+    m_numOfRows = numOfRows;
+    m_numOfCols = numOfCols;
+    m_numOfLevels = newNumOfLevels;
+
+    // We lay the levels out just
+    // like setROIofPyramidforSpecifiedLevel
+    // does, level 0 on the left and
+    // the higher levels stacked on
+    // the right
+
+    m_levelRects.resize(m_numOfLevels);
+
+    m_levelRects[0] = cvRect(0,0,numOfCols,numOfRows);
+
+    int levelRows = numOfRows;
+    int levelCols = numOfCols;
+    int yROI = 0;
+
+    for(int level = 1; level < m_numOfLevels; ++level)
+    {
+        levelRows = (levelRows + 1) / 2;
+        levelCols = (levelCols + 1) / 2;
+
+        m_levelRects[level] = cvRect(numOfCols,yROI,levelCols,levelRows);
+
+        yROI += levelRows;
+    }
+
+    int pyramidImageRows = std::max(numOfRows,yROI);
+    int pyramidImageCols = numOfCols + (m_numOfLevels > 1 ? (numOfCols + 1) / 2 : 0);
+
+    m_gaussianPyramidImage.create(pyramidImageRows,pyramidImageCols);
+    m_gaussianPyramidImage.resetROI();
+
+    m_gaussianLevels.resize(m_numOfLevels);
+
+    for(int level = 0; level < m_numOfLevels; ++level)
+        m_gaussianLevels[level] = blPyramidLevel<blDataType>(m_gaussianPyramidImage,m_levelRects[level]);
+
+    const CvMat* level0 = m_gaussianLevels[0];
+
+    m_buildLevelFunction = getBuildPyramidLevelFunction(CV_MAT_DEPTH(level0->type));
+    m_collapseLevelFunction = getCollapsePyramidLevelFunction(CV_MAT_DEPTH(level0->type));
+
+    // The laplacian pyramid gets
+    // set up again the next time
+    // it's built
+
+    m_laplacianLevels.clear();
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blPyramid<blDataType>::setupLaplacianPyramid()
+{
+    if(int(m_laplacianLevels.size()) == m_numOfLevels)
+        return;
+
+    m_laplacianPyramidImage.create(m_gaussianPyramidImage.size1(),m_gaussianPyramidImage.size2());
+    m_laplacianPyramidImage.resetROI();
+
+    m_laplacianLevels.resize(m_numOfLevels);
+
+    for(int level = 0; level < m_numOfLevels; ++level)
+        m_laplacianLevels[level] = blPyramidLevel<blDataType>(m_laplacianPyramidImage,m_levelRects[level]);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::copySourceImage(const blImage<blDataType>& srcImage)
+{
+    if(srcImage.empty())
+        return false;
+
+    if(!setup(srcImage.size1ROI(),srcImage.size2ROI(),m_requestedNumOfLevels))
+        return false;
+
+    cvCopy(srcImage,m_gaussianLevels[0]);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blBuildPyramidLevelFunction blPyramid<blDataType>::getBuildLevelFunction()const
+{
+    if(!m_shouldFusedKernelsBeUsed || m_filterType != CV_GAUSSIAN_5x5)
+        return NULL;
+
+    return m_buildLevelFunction;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blCollapsePyramidLevelFunction blPyramid<blDataType>::getCollapseLevelFunction()const
+{
+    if(!m_shouldFusedKernelsBeUsed || m_filterType != CV_GAUSSIAN_5x5)
+        return NULL;
+
+    return m_collapseLevelFunction;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::buildGaussianPyramid(const blImage<blDataType>& srcImage)
+{
+    // Level 0 is the source
+    // image, and every other level
+    // is downsampled straight from
+    // the level below it
+
+    if(!copySourceImage(srcImage))
+        return false;
+
+    blBuildPyramidLevelFunction buildLevel = getBuildLevelFunction();
+
+    for(int level = 1; level < m_numOfLevels; ++level)
+    {
+        if(buildLevel != NULL)
+        {
+            buildLevel(m_gaussianLevels[level - 1],
+                       m_gaussianLevels[level],
+                       NULL,
+                       true);
+        }
+        else
+        {
+            cvPyrDown(m_gaussianLevels[level - 1],
+                      m_gaussianLevels[level],
+                      m_filterType);
+        }
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::buildLaplacianPyramid(const blImage<blDataType>& srcImage)
+{
+    if(!copySourceImage(srcImage))
+        return false;
+
+    blBuildPyramidLevelFunction buildLevel = getBuildLevelFunction();
+
+    if(buildLevel == NULL)
+    {
+        for(int level = 1; level < m_numOfLevels; ++level)
+        {
+            cvPyrDown(m_gaussianLevels[level - 1],
+                      m_gaussianLevels[level],
+                      m_filterType);
+        }
+
+        return buildLaplacianPyramid();
+    }
+
+    setupLaplacianPyramid();
+
+    // Each sweep builds the next
+    // gaussian level and the
+    // laplacian level of the
+    // current one
+
+    for(int level = 0; level < m_numOfLevels - 1; ++level)
+    {
+        buildLevel(m_gaussianLevels[level],
+                   m_gaussianLevels[level + 1],
+                   m_laplacianLevels[level],
+                   true);
+    }
+
+    cvCopy(m_gaussianLevels[m_numOfLevels - 1],
+           m_laplacianLevels[m_numOfLevels - 1]);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::buildLaplacianPyramid()
+{
+    if(m_numOfLevels <= 0)
+        return false;
+
+    setupLaplacianPyramid();
+
+    blBuildPyramidLevelFunction buildLevel = getBuildLevelFunction();
+
+    // Each laplacian level is the
+    // gaussian level minus the
+    // upsampled gaussian level
+    // above it, where the upsampled
+    // image is written straight
+    // into the laplacian level
+
+    for(int level = 0; level < m_numOfLevels - 1; ++level)
+    {
+        if(buildLevel != NULL)
+        {
+            buildLevel(m_gaussianLevels[level],
+                       m_gaussianLevels[level + 1],
+                       m_laplacianLevels[level],
+                       false);
+
+            continue;
+        }
+
+        cvPyrUp(m_gaussianLevels[level + 1],
+                m_laplacianLevels[level],
+                m_filterType);
+
+        cvSub(m_gaussianLevels[level],
+              m_laplacianLevels[level],
+              m_laplacianLevels[level],
+              NULL);
+    }
+
+    cvCopy(m_gaussianLevels[m_numOfLevels - 1],
+           m_laplacianLevels[m_numOfLevels - 1]);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::collapseLaplacianPyramid()
+{
+    if(m_numOfLevels <= 0 || int(m_laplacianLevels.size()) != m_numOfLevels)
+        return false;
+
+    blCollapsePyramidLevelFunction collapseLevel = getCollapseLevelFunction();
+
+    // Starting from the last level,
+    // each gaussian level is its
+    // laplacian level plus the
+    // upsampled gaussian level above
+    // it, where the upsampled image
+    // is written straight into the
+    // gaussian level
+
+    cvCopy(m_laplacianLevels[m_numOfLevels - 1],
+           m_gaussianLevels[m_numOfLevels - 1]);
+
+    for(int level = m_numOfLevels - 2; level >= 0; --level)
+    {
+        if(collapseLevel != NULL)
+        {
+            collapseLevel(m_gaussianLevels[level + 1],
+                          m_laplacianLevels[level],
+                          m_gaussianLevels[level]);
+
+            continue;
+        }
+
+        cvPyrUp(m_gaussianLevels[level + 1],
+                m_gaussianLevels[level],
+                m_filterType);
+
+        cvAdd(m_laplacianLevels[level],
+              m_gaussianLevels[level],
+              m_gaussianLevels[level],
+              NULL);
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::collapseLaplacianPyramid(blImage<blDataType>& dstImage)
+{
+    if(!collapseLaplacianPyramid())
+        return false;
+
+    // The destination gets the
+    // size of level 0 unless its
+    // ROI already has it
+
+    if(dstImage.empty() ||
+       dstImage.size1ROI() != m_numOfRows ||
+       dstImage.size2ROI() != m_numOfCols)
+    {
+        dstImage.create(m_numOfRows,m_numOfCols);
+        dstImage.resetROI();
+    }
+
+    cvCopy(m_gaussianLevels[0],dstImage);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blPyramid<blDataType>::useFusedKernels(const bool& shouldFusedKernelsBeUsed)
+{
+    m_shouldFusedKernelsBeUsed = shouldFusedKernelsBeUsed;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blPyramid<blDataType>::areFusedKernelsUsed()const
+{
+    return (getBuildLevelFunction() != NULL);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramid<blDataType>::getFilterType()const
+{
+    return m_filterType;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramid<blDataType>::getNumOfRows()const
+{
+    return m_numOfRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramid<blDataType>::getNumOfCols()const
+{
+    return m_numOfCols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blPyramid<blDataType>::getNumOfLevels()const
+{
+    return m_numOfLevels;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const CvRect& blPyramid<blDataType>::getLevelRect(const int& level)const
+{
+    return m_levelRects[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blPyramidLevel<blDataType>& blPyramid<blDataType>::getGaussianLevel(const int& level)
+{
+    return m_gaussianLevels[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blPyramidLevel<blDataType>& blPyramid<blDataType>::getGaussianLevel(const int& level)const
+{
+    return m_gaussianLevels[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blPyramidLevel<blDataType>& blPyramid<blDataType>::getLaplacianLevel(const int& level)
+{
+    return m_laplacianLevels[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blPyramidLevel<blDataType>& blPyramid<blDataType>::getLaplacianLevel(const int& level)const
+{
+    return m_laplacianLevels[level];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blPyramid<blDataType>::getGaussianPyramidImage()const
+{
+    return m_gaussianPyramidImage;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blPyramid<blDataType>::getLaplacianPyramidImage()const
+{
+    return m_laplacianPyramidImage;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_PYRAMID_HPP
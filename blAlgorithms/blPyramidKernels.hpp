@@ -0,0 +1,863 @@
+#ifndef BL_PYRAMIDKERNELS_HPP
+#define BL_PYRAMIDKERNELS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blPyramidKernels.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         - A pyramid engine that builds the next (down
+//                    sampled) level of a gaussian pyramid and the
+//                    laplacian residual of the current level in the
+//                    same sweep over the rows of the current level
+//                  - The rows of the next level are split in bands
+//                    that run on the shared thread pool
+//                    (parallelForTiles), and each band computes the
+//                    one row of the next level above and below it
+//                    that its residual rows need, so the bands never
+//                    wait on each other
+//                  - A version of the downsampling that rebuilds only
+//                    a rectangle of the next level, used to update
+//                    the parts of a pyramid that changed
+//                  - The inverse sweep, which collapses a level of a
+//                    laplacian pyramid by adding the upsampled level
+//                    above it to the residual
+//                  - The depth of the levels is resolved once into
+//                    a templated level function
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blParallelForTiles
+//                  - CvMat -- The levels are passed as matrix
+//                             headers (see blPyramidLevel)
+//
+// NOTES:           - The kernels compute the same values as
+//                    cvPyrDown, cvPyrUp, cvSub and cvAdd with the 5x5
+//                    gaussian filter:
+//                    - The downsampling filter is [1 4 6 4 1]/16 in
+//                      both directions with reflected (101) borders
+//                    - The upsampling filter is [1 6 1]/8 and
+//                      [4 4]/8 in both directions, reflecting the
+//                      top/left border and repeating the
+//                      bottom/right one
+//                    - Integer depths are computed in fixed point
+//                      with the same rounding, and the residuals and
+//                      the collapsed levels are saturated
+//                  - Only the unsigned char, unsigned short, short,
+//                    float and double depths (the ones cvPyrDown
+//                    supports) have level functions
+//                  - Each row of the current level is filtered
+//                    horizontally only once, and the filtered rows
+//                    are kept in small per thread rings
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the level functions
+// - The next level and the residual have
+//   to be sized like cvPyrDown/cvPyrUp
+//   expect them
+// - The residual can be NULL, in which
+//   case only the next level is built
+// - When the next level is not computed,
+//   the residual is computed from the
+//   next level already there
+//-------------------------------------------------------------------
+typedef void (*blBuildPyramidLevelFunction)(const CvMat* level,
+                                            CvMat* nextLevel,
+                                            CvMat* residualLevel,
+                                            const bool& shouldNextLevelBeComputed);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the collapse functions
+// - The level is set to the residual plus
+//   the upsampled next level, and it can
+//   be the residual itself
+//-------------------------------------------------------------------
+typedef void (*blCollapsePyramidLevelFunction)(const CvMat* nextLevel,
+                                               const CvMat* residualLevel,
+                                               CvMat* level);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Signature of the functions used to
+// rebuild only a rectangle of the next
+// level (run by the calling thread)
+//-------------------------------------------------------------------
+typedef void (*blBuildPyramidLevelRectFunction)(const CvMat* level,
+                                                CvMat* nextLevel,
+                                                const CvRect& nextLevelRect);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to reflect an index
+// around the borders of [0,n) without
+// repeating the border element (101)
+//-------------------------------------------------------------------
+inline int reflectPyramidIndex(int index,const int& n)
+{
+    if(n <= 1)
+        return 0;
+
+    while(index < 0 || index >= n)
+    {
+        if(index < 0)
+            index = -index;
+
+        if(index >= n)
+            index = 2 * n - 2 - index;
+    }
+
+    return index;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to scale the filtered
+// values back (the downsampling weights
+// add up to 256 and the upsampling ones
+// to 64), rounding the fixed point ones
+//-------------------------------------------------------------------
+inline int scaleDownsampledValue(const int& value)
+{
+    return (value + 128) >> 8;
+}
+
+inline float scaleDownsampledValue(const float& value)
+{
+    return value * (1.f / 256.f);
+}
+
+inline double scaleDownsampledValue(const double& value)
+{
+    return value * (1.0 / 256.0);
+}
+
+
+inline int scaleUpsampledValue(const int& value)
+{
+    return (value + 32) >> 6;
+}
+
+inline float scaleUpsampledValue(const float& value)
+{
+    return value * (1.f / 64.f);
+}
+
+inline double scaleUpsampledValue(const double& value)
+{
+    return value * (1.0 / 64.0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to saturate a residual
+// value to the range of the level depth
+//-------------------------------------------------------------------
+template<typename blChannelType>
+
+inline blChannelType saturateResidualValue(const int& value)
+{
+    return static_cast<blChannelType>(std::min<int>(std::max<int>(value,std::numeric_limits<blChannelType>::min()),
+                                                    std::numeric_limits<blChannelType>::max()));
+}
+
+
+template<typename blChannelType>
+
+inline blChannelType saturateResidualValue(const float& value)
+{
+    return static_cast<blChannelType>(value);
+}
+
+
+template<typename blChannelType>
+
+inline blChannelType saturateResidualValue(const double& value)
+{
+    return static_cast<blChannelType>(value);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions filter a row
+// with [1 4 6 4 1] and keep every other
+// pixel (the horizontal half of the
+// downsampling), either for the whole
+// downsampled row or for its columns
+// [firstDstCol,lastDstCol) only, in which
+// case dstRow starts at firstDstCol
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void downsamplePyramidRow(const blChannelType* srcRow,
+                                 blWorkType* dstRow,
+                                 const int& srcCols,
+                                 const int& firstDstCol,
+                                 const int& lastDstCol,
+                                 const int& numOfChannels)
+{
+    const int cn = numOfChannels;
+
+    // The pixels whose five taps
+    // are all inside the row
+
+    int firstInteriorCol = std::max(1,firstDstCol);
+    int lastInteriorCol = std::max(firstInteriorCol,std::min(lastDstCol,(srcCols - 1) / 2));
+
+    if(cn == 1)
+    {
+        for(int j = firstInteriorCol; j < lastInteriorCol; ++j)
+        {
+            const blChannelType* src = srcRow + 2 * j;
+
+            dstRow[j - firstDstCol] = blWorkType(src[0]) * 6 +
+                                      (blWorkType(src[-1]) + blWorkType(src[1])) * 4 +
+                                      blWorkType(src[-2]) +
+                                      blWorkType(src[2]);
+        }
+    }
+    else
+    {
+        for(int j = firstInteriorCol; j < lastInteriorCol; ++j)
+        {
+            const blChannelType* src = srcRow + 2 * j * cn;
+            blWorkType* dst = dstRow + (j - firstDstCol) * cn;
+
+            for(int ch = 0; ch < cn; ++ch)
+            {
+                dst[ch] = blWorkType(src[ch]) * 6 +
+                          (blWorkType(src[ch - cn]) + blWorkType(src[ch + cn])) * 4 +
+                          blWorkType(src[ch - 2 * cn]) +
+                          blWorkType(src[ch + 2 * cn]);
+            }
+        }
+    }
+
+    // The border pixels
+
+    for(int j = firstDstCol; j < lastDstCol; ++j)
+    {
+        if(j == firstInteriorCol)
+            j = lastInteriorCol;
+
+        if(j >= lastDstCol)
+            break;
+
+        int x0 = reflectPyramidIndex(2 * j - 2,srcCols) * cn;
+        int x1 = reflectPyramidIndex(2 * j - 1,srcCols) * cn;
+        int x2 = reflectPyramidIndex(2 * j,srcCols) * cn;
+        int x3 = reflectPyramidIndex(2 * j + 1,srcCols) * cn;
+        int x4 = reflectPyramidIndex(2 * j + 2,srcCols) * cn;
+
+        for(int ch = 0; ch < cn; ++ch)
+        {
+            dstRow[(j - firstDstCol) * cn + ch] = blWorkType(srcRow[x2 + ch]) * 6 +
+                                                  (blWorkType(srcRow[x1 + ch]) + blWorkType(srcRow[x3 + ch])) * 4 +
+                                                  blWorkType(srcRow[x0 + ch]) +
+                                                  blWorkType(srcRow[x4 + ch]);
+        }
+    }
+}
+
+
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void downsamplePyramidRow(const blChannelType* srcRow,
+                                 blWorkType* dstRow,
+                                 const int& srcCols,
+                                 const int& dstCols,
+                                 const int& numOfChannels)
+{
+    downsamplePyramidRow(srcRow,dstRow,srcCols,0,dstCols,numOfChannels);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function doubles the
+// width of a row with [1 6 1] on the
+// even pixels and [4 4] on the odd ones
+// (the horizontal half of the upsampling)
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void upsamplePyramidRow(const blChannelType* srcRow,
+                               blWorkType* dstRow,
+                               const int& srcCols,
+                               const int& dstCols,
+                               const int& numOfChannels)
+{
+    const int cn = numOfChannels;
+
+    if(srcCols == 1)
+    {
+        for(int x = 0; x < dstCols; ++x)
+            for(int ch = 0; ch < cn; ++ch)
+                dstRow[x * cn + ch] = blWorkType(srcRow[ch]) * 8;
+
+        return;
+    }
+
+    // The interior pixels
+
+    if(cn == 1)
+    {
+        for(int j = 1; j < srcCols - 1; ++j)
+        {
+            dstRow[2 * j] = blWorkType(srcRow[j - 1]) + blWorkType(srcRow[j]) * 6 + blWorkType(srcRow[j + 1]);
+            dstRow[2 * j + 1] = (blWorkType(srcRow[j]) + blWorkType(srcRow[j + 1])) * 4;
+        }
+    }
+    else
+    {
+        for(int j = 1; j < srcCols - 1; ++j)
+        {
+            const blChannelType* src = srcRow + j * cn;
+            blWorkType* dst = dstRow + 2 * j * cn;
+
+            for(int ch = 0; ch < cn; ++ch)
+            {
+                dst[ch] = blWorkType(src[ch - cn]) + blWorkType(src[ch]) * 6 + blWorkType(src[ch + cn]);
+                dst[ch + cn] = (blWorkType(src[ch]) + blWorkType(src[ch + cn])) * 4;
+            }
+        }
+    }
+
+    // The left border reflects
+    // and the right one repeats
+
+    int lastCol = srcCols - 1;
+
+    for(int ch = 0; ch < cn; ++ch)
+    {
+        dstRow[ch] = blWorkType(srcRow[ch]) * 6 + blWorkType(srcRow[cn + ch]) * 2;
+        dstRow[cn + ch] = (blWorkType(srcRow[ch]) + blWorkType(srcRow[cn + ch])) * 4;
+
+        dstRow[2 * lastCol * cn + ch] = blWorkType(srcRow[(lastCol - 1) * cn + ch]) + blWorkType(srcRow[lastCol * cn + ch]) * 7;
+
+        if(2 * lastCol + 1 < dstCols)
+            dstRow[(2 * lastCol + 1) * cn + ch] = blWorkType(srcRow[lastCol * cn + ch]) * 8;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function finishes the
+// vertical half of the upsampling for
+// one row of the current level, from
+// the three horizontally upsampled rows
+// of the next level around it, and
+// combines every upsampled value with
+// the value of a source row
+// - Even rows use [1 6 1] and odd rows
+//   use [4 4] (rowAbove is not used)
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType,
+         typename blCombineFunctorType>
+
+inline void combineUpsampledPyramidRow(const blWorkType* rowAbove,
+                                       const blWorkType* row,
+                                       const blWorkType* rowBelow,
+                                       const bool& isOddRow,
+                                       const blChannelType* srcRow,
+                                       blChannelType* dstRow,
+                                       const int& rowLength,
+                                       const blCombineFunctorType& combine)
+{
+    if(!isOddRow)
+    {
+        for(int k = 0; k < rowLength; ++k)
+            dstRow[k] = combine(srcRow[k],blChannelType(scaleUpsampledValue(blWorkType(rowAbove[k] + row[k] * 6 + rowBelow[k]))));
+    }
+    else
+    {
+        for(int k = 0; k < rowLength; ++k)
+            dstRow[k] = combine(srcRow[k],blChannelType(scaleUpsampledValue(blWorkType((row[k] + rowBelow[k]) * 4))));
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function builds the
+// rows [firstRow,lastRow) of the next
+// level of a pyramid and the rows
+// [2 * firstRow,2 * lastRow) of the
+// residual of the current level
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void buildPyramidLevelRows(const CvMat* level,
+                                  CvMat* nextLevel,
+                                  CvMat* residualLevel,
+                                  const bool& shouldNextLevelBeComputed,
+                                  const int& firstRow,
+                                  const int& lastRow)
+{
+    const int numOfChannels = CV_MAT_CN(level->type);
+
+    const int rows = level->rows;
+    const int cols = level->cols;
+    const int nextRows = nextLevel->rows;
+    const int nextCols = nextLevel->cols;
+
+    const int rowLength = cols * numOfChannels;
+    const int nextRowLength = nextCols * numOfChannels;
+
+    // Each row of the level is
+    // filtered horizontally once
+    // into a ring of five rows,
+    // and each row of the next
+    // level is upsampled once into
+    // a ring of three rows
+
+    static thread_local std::vector<blWorkType> downsampledRows;
+    static thread_local std::vector<blWorkType> upsampledRows;
+    static thread_local std::vector<blChannelType> haloRow;
+
+    if(int(downsampledRows.size()) < 5 * nextRowLength)
+        downsampledRows.resize(5 * nextRowLength);
+
+    if(residualLevel != NULL && int(upsampledRows.size()) < 3 * rowLength)
+        upsampledRows.resize(3 * rowLength);
+
+    if(int(haloRow.size()) < nextRowLength)
+        haloRow.resize(nextRowLength);
+
+    int downsampledRowIndices[5] = {-1,-1,-1,-1,-1};
+
+    auto getLevelRow = [&](const int& rowIndex)->const blChannelType*
+    {
+        return reinterpret_cast<const blChannelType*>(level->data.ptr + rowIndex * level->step);
+    };
+
+    auto getNextLevelRow = [&](const int& rowIndex)->blChannelType*
+    {
+        return reinterpret_cast<blChannelType*>(nextLevel->data.ptr + rowIndex * nextLevel->step);
+    };
+
+    auto getDownsampledRow = [&](int rowIndex)->const blWorkType*
+    {
+        rowIndex = reflectPyramidIndex(rowIndex,rows);
+
+        int slot = rowIndex % 5;
+
+        if(downsampledRowIndices[slot] != rowIndex)
+        {
+            downsamplePyramidRow(getLevelRow(rowIndex),
+                                 &downsampledRows[slot * nextRowLength],
+                                 cols,
+                                 nextCols,
+                                 numOfChannels);
+
+            downsampledRowIndices[slot] = rowIndex;
+        }
+
+        return &downsampledRows[slot * nextRowLength];
+    };
+
+    // Function used to get a row
+    // of the next level, computing
+    // it (into the halo row when it
+    // belongs to another band)
+
+    auto getNextRow = [&](const int& y)->const blChannelType*
+    {
+        if(!shouldNextLevelBeComputed)
+            return getNextLevelRow(y);
+
+        blChannelType* nextRow = (y >= firstRow && y < lastRow) ? getNextLevelRow(y) : &haloRow[0];
+
+        const blWorkType* row0 = getDownsampledRow(2 * y - 2);
+        const blWorkType* row1 = getDownsampledRow(2 * y - 1);
+        const blWorkType* row2 = getDownsampledRow(2 * y);
+        const blWorkType* row3 = getDownsampledRow(2 * y + 1);
+        const blWorkType* row4 = getDownsampledRow(2 * y + 2);
+
+        for(int k = 0; k < nextRowLength; ++k)
+            nextRow[k] = blChannelType(scaleDownsampledValue(blWorkType(row2[k] * 6 + (row1[k] + row3[k]) * 4 + row0[k] + row4[k])));
+
+        return nextRow;
+    };
+
+    // Function used to write the two
+    // residual rows that come from
+    // the row y of the next level
+
+    auto writeResidualRows = [&](const int& y)
+    {
+        int yAbove = (y > 0) ? (y - 1) : std::min(1,nextRows - 1);
+        int yBelow = std::min(y + 1,nextRows - 1);
+
+        const blWorkType* rowAbove = &upsampledRows[(yAbove % 3) * rowLength];
+        const blWorkType* row = &upsampledRows[(y % 3) * rowLength];
+        const blWorkType* rowBelow = &upsampledRows[(yBelow % 3) * rowLength];
+
+        auto subtract = [](const blChannelType& levelValue,const blChannelType& upsampledValue)->blChannelType
+        {
+            return saturateResidualValue<blChannelType>(blWorkType(levelValue) - blWorkType(upsampledValue));
+        };
+
+        for(int r = 2 * y; r < std::min(2 * y + 2,rows); ++r)
+        {
+            combineUpsampledPyramidRow(rowAbove,
+                                       row,
+                                       rowBelow,
+                                       (r > 2 * y),
+                                       getLevelRow(r),
+                                       reinterpret_cast<blChannelType*>(residualLevel->data.ptr + r * residualLevel->step),
+                                       rowLength,
+                                       subtract);
+        }
+    };
+
+    if(residualLevel == NULL)
+    {
+        for(int y = firstRow; y < lastRow; ++y)
+            getNextRow(y);
+
+        return;
+    }
+
+    // The residual rows of the
+    // band need the next level
+    // rows right above and below
+    // the band
+
+    int firstComputedRow = std::max(firstRow - 1,0);
+    int lastComputedRow = std::min(lastRow + 1,nextRows);
+
+    for(int y = firstComputedRow; y < lastComputedRow; ++y)
+    {
+        upsamplePyramidRow(getNextRow(y),
+                           &upsampledRows[(y % 3) * rowLength],
+                           nextCols,
+                           cols,
+                           numOfChannels);
+
+        if(y - 1 >= firstRow)
+            writeResidualRows(y - 1);
+    }
+
+    if(lastRow == nextRows)
+        writeResidualRows(nextRows - 1);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function builds the
+// next level of a pyramid and/or the
+// residual of the current level,
+// splitting the rows of the next level
+// in bands across the thread pool
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void buildPyramidLevel(const CvMat* level,
+                              CvMat* nextLevel,
+                              CvMat* residualLevel,
+                              const bool& shouldNextLevelBeComputed)
+{
+    // The bands are kept at least
+    // 16 rows tall so that the halo
+    // rows stay a small fraction of
+    // the work
+
+    int bandHeight = std::max(16,getTileThreadPool().getGrainSize() / std::max(1,level->cols));
+
+    parallelForTiles(nextLevel->rows,level->cols,[&](const blImageTile& tile)
+    {
+        buildPyramidLevelRows<blChannelType,blWorkType>(level,
+                                                        nextLevel,
+                                                        residualLevel,
+                                                        shouldNextLevelBeComputed,
+                                                        tile.m_row,
+                                                        tile.m_row + tile.m_numOfRows);
+    },
+    bandHeight);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the level
+// function of a (CvMat) depth, or
+// NULL when the depth is not supported
+//-------------------------------------------------------------------
+inline blBuildPyramidLevelFunction getBuildPyramidLevelFunction(const int& depth)
+{
+    switch(depth)
+    {
+    case CV_8U: return &buildPyramidLevel<unsigned char,int>;
+    case CV_16U: return &buildPyramidLevel<unsigned short,int>;
+    case CV_16S: return &buildPyramidLevel<short,int>;
+    case CV_32F: return &buildPyramidLevel<float,float>;
+    case CV_64F: return &buildPyramidLevel<double,double>;
+    default: return NULL;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function rebuilds a
+// rectangle of the next level of a
+// pyramid, giving the same values the
+// whole level sweep gives
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void buildPyramidLevelRect(const CvMat* level,
+                                  CvMat* nextLevel,
+                                  const CvRect& nextLevelRect)
+{
+    const int numOfChannels = CV_MAT_CN(level->type);
+
+    const int rows = level->rows;
+    const int cols = level->cols;
+
+    const int firstCol = nextLevelRect.x;
+    const int lastCol = nextLevelRect.x + nextLevelRect.width;
+
+    const int rectRowLength = nextLevelRect.width * numOfChannels;
+
+    if(rectRowLength <= 0)
+        return;
+
+    // The ring of horizontally
+    // filtered rows only holds
+    // the columns of the rectangle
+
+    static thread_local std::vector<blWorkType> downsampledRows;
+
+    if(int(downsampledRows.size()) < 5 * rectRowLength)
+        downsampledRows.resize(5 * rectRowLength);
+
+    int downsampledRowIndices[5] = {-1,-1,-1,-1,-1};
+
+    auto getDownsampledRow = [&](int rowIndex)->const blWorkType*
+    {
+        rowIndex = reflectPyramidIndex(rowIndex,rows);
+
+        int slot = rowIndex % 5;
+
+        if(downsampledRowIndices[slot] != rowIndex)
+        {
+            downsamplePyramidRow(reinterpret_cast<const blChannelType*>(level->data.ptr + rowIndex * level->step),
+                                 &downsampledRows[slot * rectRowLength],
+                                 cols,
+                                 firstCol,
+                                 lastCol,
+                                 numOfChannels);
+
+            downsampledRowIndices[slot] = rowIndex;
+        }
+
+        return &downsampledRows[slot * rectRowLength];
+    };
+
+    for(int y = nextLevelRect.y; y < nextLevelRect.y + nextLevelRect.height; ++y)
+    {
+        blChannelType* nextRow = reinterpret_cast<blChannelType*>(nextLevel->data.ptr + y * nextLevel->step) + firstCol * numOfChannels;
+
+        const blWorkType* row0 = getDownsampledRow(2 * y - 2);
+        const blWorkType* row1 = getDownsampledRow(2 * y - 1);
+        const blWorkType* row2 = getDownsampledRow(2 * y);
+        const blWorkType* row3 = getDownsampledRow(2 * y + 1);
+        const blWorkType* row4 = getDownsampledRow(2 * y + 2);
+
+        for(int k = 0; k < rectRowLength; ++k)
+            nextRow[k] = blChannelType(scaleDownsampledValue(blWorkType(row2[k] * 6 + (row1[k] + row3[k]) * 4 + row0[k] + row4[k])));
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the rectangle
+// function of a (CvMat) depth, or NULL
+// when the depth is not supported
+//-------------------------------------------------------------------
+inline blBuildPyramidLevelRectFunction getBuildPyramidLevelRectFunction(const int& depth)
+{
+    switch(depth)
+    {
+    case CV_8U: return &buildPyramidLevelRect<unsigned char,int>;
+    case CV_16U: return &buildPyramidLevelRect<unsigned short,int>;
+    case CV_16S: return &buildPyramidLevelRect<short,int>;
+    case CV_32F: return &buildPyramidLevelRect<float,float>;
+    case CV_64F: return &buildPyramidLevelRect<double,double>;
+    default: return NULL;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function collapses the
+// rows [2 * firstRow,2 * lastRow) of a
+// level from the rows [firstRow,lastRow)
+// of the next level
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void collapsePyramidLevelRows(const CvMat* nextLevel,
+                                     const CvMat* residualLevel,
+                                     CvMat* level,
+                                     const int& firstRow,
+                                     const int& lastRow)
+{
+    const int numOfChannels = CV_MAT_CN(level->type);
+
+    const int rows = level->rows;
+    const int cols = level->cols;
+    const int nextRows = nextLevel->rows;
+    const int nextCols = nextLevel->cols;
+
+    const int rowLength = cols * numOfChannels;
+
+    static thread_local std::vector<blWorkType> upsampledRows;
+
+    if(int(upsampledRows.size()) < 3 * rowLength)
+        upsampledRows.resize(3 * rowLength);
+
+    auto add = [](const blChannelType& residualValue,const blChannelType& upsampledValue)->blChannelType
+    {
+        return saturateResidualValue<blChannelType>(blWorkType(residualValue) + blWorkType(upsampledValue));
+    };
+
+    // Function used to write the two
+    // rows of the level that come
+    // from the row y of the next level
+
+    auto writeLevelRows = [&](const int& y)
+    {
+        int yAbove = (y > 0) ? (y - 1) : std::min(1,nextRows - 1);
+        int yBelow = std::min(y + 1,nextRows - 1);
+
+        for(int r = 2 * y; r < std::min(2 * y + 2,rows); ++r)
+        {
+            combineUpsampledPyramidRow(&upsampledRows[(yAbove % 3) * rowLength],
+                                       &upsampledRows[(y % 3) * rowLength],
+                                       &upsampledRows[(yBelow % 3) * rowLength],
+                                       (r > 2 * y),
+                                       reinterpret_cast<const blChannelType*>(residualLevel->data.ptr + r * residualLevel->step),
+                                       reinterpret_cast<blChannelType*>(level->data.ptr + r * level->step),
+                                       rowLength,
+                                       add);
+        }
+    };
+
+    // The rows of the band need the
+    // next level rows right above
+    // and below the band
+
+    int firstUpsampledRow = std::max(firstRow - 1,0);
+    int lastUpsampledRow = std::min(lastRow + 1,nextRows);
+
+    for(int y = firstUpsampledRow; y < lastUpsampledRow; ++y)
+    {
+        upsamplePyramidRow(reinterpret_cast<const blChannelType*>(nextLevel->data.ptr + y * nextLevel->step),
+                           &upsampledRows[(y % 3) * rowLength],
+                           nextCols,
+                           cols,
+                           numOfChannels);
+
+        if(y - 1 >= firstRow)
+            writeLevelRows(y - 1);
+    }
+
+    if(lastRow == nextRows)
+        writeLevelRows(nextRows - 1);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function collapses a
+// level of a laplacian pyramid, splitting
+// the rows of the next level in bands
+// across the thread pool
+//-------------------------------------------------------------------
+template<typename blChannelType,
+         typename blWorkType>
+
+inline void collapsePyramidLevel(const CvMat* nextLevel,
+                                 const CvMat* residualLevel,
+                                 CvMat* level)
+{
+    int bandHeight = std::max(16,getTileThreadPool().getGrainSize() / std::max(1,level->cols));
+
+    parallelForTiles(nextLevel->rows,level->cols,[&](const blImageTile& tile)
+    {
+        collapsePyramidLevelRows<blChannelType,blWorkType>(nextLevel,
+                                                           residualLevel,
+                                                           level,
+                                                           tile.m_row,
+                                                           tile.m_row + tile.m_numOfRows);
+    },
+    bandHeight);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the collapse
+// function of a (CvMat) depth, or NULL
+// when the depth is not supported
+//-------------------------------------------------------------------
+inline blCollapsePyramidLevelFunction getCollapsePyramidLevelFunction(const int& depth)
+{
+    switch(depth)
+    {
+    case CV_8U: return &collapsePyramidLevel<unsigned char,int>;
+    case CV_16U: return &collapsePyramidLevel<unsigned short,int>;
+    case CV_16S: return &collapsePyramidLevel<short,int>;
+    case CV_32F: return &collapsePyramidLevel<float,float>;
+    case CV_64F: return &collapsePyramidLevel<double,double>;
+    default: return NULL;
+    }
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_PYRAMIDKERNELS_HPP
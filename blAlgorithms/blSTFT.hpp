@@ -0,0 +1,540 @@
+#ifndef BL_STFT_HPP
+#define BL_STFT_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSTFT.hpp
+// CLASS:           blSTFT
+// BASE CLASS:      None
+//
+// PURPOSE:         A streaming short-time fourier transform, which
+//                  takes in samples as they come, keeps the last
+//                  window of them in a ring buffer, and every hop
+//                  windows them, takes their fft and writes the
+//                  spectrum as a new row of a circular spectrogram
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blFFTPlan -- Used to take the real ffts
+//                  blImage -- Used to hold the spectrogram
+//
+// NOTES:           - The first spectrogram row is emitted once a
+//                    whole window of samples has been received, and
+//                    then one row every hop samples (a hop bigger
+//                    than the window simply skips samples)
+//                  - Each spectrogram row has windowSize/2 + 1
+//                    frequency bins, bin k being the frequency
+//                    k * samplingRate / windowSize
+//                  - The spectrogram is circular, the newest row
+//                    overwrites the oldest one, and its rows can be
+//                    copied out in chronological order
+//                  - Once set up, adding samples allocates nothing,
+//                    so the memory used is bounded no matter how
+//                    long the signal is
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blWindowFunctionEnum {BL_RECTANGULAR_WINDOW,
+                           BL_HANN_WINDOW,
+                           BL_HAMMING_WINDOW,
+                           BL_BLACKMAN_WINDOW};
+
+enum blSpectrogramValueEnum {BL_SPECTROGRAM_MAGNITUDE,
+                             BL_SPECTROGRAM_POWER,
+                             BL_SPECTROGRAM_LOG_MAGNITUDE};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blSTFT
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blSTFT(const int& windowSize = 256,
+           const int& hopSize = 128,
+           const int& numOfSpectrogramRows = 256,
+           const blWindowFunctionEnum& windowFunction = BL_HANN_WINDOW,
+           const blSpectrogramValueEnum& spectrogramValue = BL_SPECTROGRAM_MAGNITUDE);
+
+    // Destructor
+
+    ~blSTFT()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to set the
+    // transform up, which also
+    // clears the samples and the
+    // spectrogram
+
+    void                                        setup(const int& windowSize,
+                                                      const int& hopSize,
+                                                      const int& numOfSpectrogramRows,
+                                                      const blWindowFunctionEnum& windowFunction = BL_HANN_WINDOW,
+                                                      const blSpectrogramValueEnum& spectrogramValue = BL_SPECTROGRAM_MAGNITUDE);
+
+    // Function used to clear
+    // the samples and the
+    // spectrogram
+
+    void                                        reset();
+
+    // Functions used to add samples,
+    // either from an array or from
+    // the ROI of a signal image (read
+    // row by row)
+    // - They return the number of
+    //   spectrogram rows emitted
+
+    int                                         addSamples(const blDataType* samples,
+                                                           const int& numOfSamples);
+
+    int                                         addSamples(const blImage<blDataType>& signal);
+
+    // Functions used to get the
+    // settings of the transform
+
+    int                                         getWindowSize()const;
+    int                                         getHopSize()const;
+    int                                         getNumOfFrequencyBins()const;
+    blWindowFunctionEnum                        getWindowFunction()const;
+    blSpectrogramValueEnum                      getSpectrogramValue()const;
+
+    // Function used to get the
+    // frequency of a bin
+
+    double                                      getFrequencyOfBin(const int& binIndex,
+                                                                  const double& samplingRate)const;
+
+    // Functions used to get the
+    // circular spectrogram, the row
+    // holding the newest spectrum
+    // (-1 when there's none yet), the
+    // number of rows emitted so far
+    // and the half spectrum of the
+    // newest window
+
+    const blImage<blDataType>&                  getSpectrogram()const;
+    int                                         getNewestRowIndex()const;
+    unsigned long long                          getNumOfEmittedRows()const;
+    const blImage< std::complex<blDataType> >&  getNewestSpectrum()const;
+
+    // Function used to copy the
+    // spectrogram rows emitted so far
+    // (at most the spectrogram size)
+    // from oldest to newest
+
+    void                                        copySpectrogramInChronologicalOrder(blImage<blDataType>& dstImage)const;
+
+private: // Private functions
+
+    // Function used to compute
+    // the window coefficients
+
+    void                                        computeWindow();
+
+    // Function used to transform
+    // the samples in the ring and
+    // emit a spectrogram row
+
+    void                                        emitSpectrogramRow();
+
+private: // Private variables
+
+    // The settings
+
+    int                                         m_windowSize;
+    int                                         m_hopSize;
+    blWindowFunctionEnum                        m_windowFunction;
+    blSpectrogramValueEnum                      m_spectrogramValue;
+
+    // The ring of samples, where the
+    // write index points to the oldest
+    // sample once the ring is full
+
+    std::vector<blDataType>                     m_samples;
+    int                                         m_writeIndex;
+    int                                         m_numOfSamplesUntilNextRow;
+
+    // The window coefficients
+    // and the windowed frame
+
+    std::vector<blDataType>                     m_window;
+    blImage<blDataType>                         m_frame;
+
+    // The fft plan and the
+    // latest half spectrum
+
+    blFFTPlan<blDataType>                       m_plan;
+    blImage< std::complex<blDataType> >         m_newestSpectrum;
+
+    // The circular spectrogram
+
+    blImage<blDataType>                         m_spectrogram;
+    int                                         m_newestRowIndex;
+    unsigned long long                          m_numOfEmittedRows;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blSTFT<blDataType>::blSTFT(const int& windowSize,
+                                  const int& hopSize,
+                                  const int& numOfSpectrogramRows,
+                                  const blWindowFunctionEnum& windowFunction,
+                                  const blSpectrogramValueEnum& spectrogramValue)
+                                  : m_plan(true,false)
+{
+    setup(windowSize,hopSize,numOfSpectrogramRows,windowFunction,spectrogramValue);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blSTFT<blDataType>::setup(const int& windowSize,
+                                      const int& hopSize,
+                                      const int& numOfSpectrogramRows,
+                                      const blWindowFunctionEnum& windowFunction,
+                                      const blSpectrogramValueEnum& spectrogramValue)
+{
+    m_windowSize = std::max(1,windowSize);
+    m_hopSize = std::max(1,hopSize);
+    m_windowFunction = windowFunction;
+    m_spectrogramValue = spectrogramValue;
+
+    m_samples.assign(m_windowSize,blDataType(0));
+    m_window.resize(m_windowSize);
+
+    computeWindow();
+
+    m_frame.create(1,m_windowSize);
+    m_frame.resetROI();
+
+    m_plan.setup(1,m_windowSize);
+
+    m_newestSpectrum.create(1,getNumOfFrequencyBins());
+
+    m_spectrogram.create(std::max(1,numOfSpectrogramRows),getNumOfFrequencyBins());
+    m_spectrogram.resetROI();
+
+    reset();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blSTFT<blDataType>::reset()
+{
+    std::fill(m_samples.begin(),m_samples.end(),blDataType(0));
+
+    m_writeIndex = 0;
+    m_numOfSamplesUntilNextRow = m_windowSize;
+
+    for(int i = 0; i < m_spectrogram.size1(); ++i)
+        std::fill(m_spectrogram[i],m_spectrogram[i] + m_spectrogram.size2(),blDataType(0));
+
+    std::fill(m_newestSpectrum[0],m_newestSpectrum[0] + m_newestSpectrum.size2(),std::complex<blDataType>(0,0));
+
+    m_newestRowIndex = -1;
+    m_numOfEmittedRows = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blSTFT<blDataType>::computeWindow()
+{
+    // The windows are periodic
+    // (the "DFT-even" form), which
+    // is the usual choice for
+    // spectral analysis
+
+    const double pi = 3.14159265358979323846;
+
+    for(int i = 0; i < m_windowSize; ++i)
+    {
+        double phase = 2.0 * pi * double(i) / double(m_windowSize);
+
+        switch(m_windowFunction)
+        {
+        case BL_HANN_WINDOW:
+            m_window[i] = blDataType(0.5 - 0.5 * std::cos(phase));
+            break;
+
+        case BL_HAMMING_WINDOW:
+            m_window[i] = blDataType(0.54 - 0.46 * std::cos(phase));
+            break;
+
+        case BL_BLACKMAN_WINDOW:
+            m_window[i] = blDataType(0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase));
+            break;
+
+        default:
+        case BL_RECTANGULAR_WINDOW:
+            m_window[i] = blDataType(1);
+            break;
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::addSamples(const blDataType* samples,
+                                          const int& numOfSamples)
+{
+    int numOfEmittedRows = 0;
+    int sampleIndex = 0;
+
+    while(sampleIndex < numOfSamples)
+    {
+        // Copy the samples up to the
+        // next row into the ring, or
+        // only the last window of them
+        // when the hop skips samples
+
+        int numOfSamplesToAdd = std::min(numOfSamples - sampleIndex,m_numOfSamplesUntilNextRow);
+        int numOfSamplesToSkip = std::max(0,numOfSamplesToAdd - m_windowSize);
+
+        for(int i = sampleIndex + numOfSamplesToSkip; i < sampleIndex + numOfSamplesToAdd; )
+        {
+            int numOfSamplesBeforeWrapping = std::min(sampleIndex + numOfSamplesToAdd - i,m_windowSize - m_writeIndex);
+
+            std::copy(samples + i,samples + i + numOfSamplesBeforeWrapping,m_samples.begin() + m_writeIndex);
+
+            i += numOfSamplesBeforeWrapping;
+            m_writeIndex = (m_writeIndex + numOfSamplesBeforeWrapping) % m_windowSize;
+        }
+
+        sampleIndex += numOfSamplesToAdd;
+        m_numOfSamplesUntilNextRow -= numOfSamplesToAdd;
+
+        if(m_numOfSamplesUntilNextRow == 0)
+        {
+            emitSpectrogramRow();
+
+            ++numOfEmittedRows;
+
+            m_numOfSamplesUntilNextRow = m_hopSize;
+        }
+    }
+
+    return numOfEmittedRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::addSamples(const blImage<blDataType>& signal)
+{
+    int numOfEmittedRows = 0;
+
+    for(int i = 0; i < signal.size1ROI(); ++i)
+        numOfEmittedRows += addSamples(signal[signal.yROI() + i] + signal.xROI(),signal.size2ROI());
+
+    return numOfEmittedRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blSTFT<blDataType>::emitSpectrogramRow()
+{
+    // Window the samples from
+    // oldest to newest
+
+    blDataType* frame = m_frame[0];
+
+    int numOfOldestSamples = m_windowSize - m_writeIndex;
+
+    for(int i = 0; i < numOfOldestSamples; ++i)
+        frame[i] = m_samples[m_writeIndex + i] * m_window[i];
+
+    for(int i = numOfOldestSamples; i < m_windowSize; ++i)
+        frame[i] = m_samples[i - numOfOldestSamples] * m_window[i];
+
+    const blImage< std::complex<blDataType> >& halfSpectrum = rfft2(m_frame,m_plan);
+
+    int numOfBins = getNumOfFrequencyBins();
+
+    std::copy(halfSpectrum[0],halfSpectrum[0] + numOfBins,m_newestSpectrum[0]);
+
+    // Write the new row
+
+    m_newestRowIndex = (m_newestRowIndex + 1) % m_spectrogram.size1();
+
+    blDataType* spectrogramRow = m_spectrogram[m_newestRowIndex];
+    const std::complex<blDataType>* spectrumRow = m_newestSpectrum[0];
+
+    switch(m_spectrogramValue)
+    {
+    case BL_SPECTROGRAM_POWER:
+        for(int j = 0; j < numOfBins; ++j)
+            spectrogramRow[j] = std::norm(spectrumRow[j]);
+        break;
+
+    case BL_SPECTROGRAM_LOG_MAGNITUDE:
+        for(int j = 0; j < numOfBins; ++j)
+            spectrogramRow[j] = std::log(blDataType(1) + std::abs(spectrumRow[j]));
+        break;
+
+    default:
+    case BL_SPECTROGRAM_MAGNITUDE:
+        for(int j = 0; j < numOfBins; ++j)
+            spectrogramRow[j] = std::abs(spectrumRow[j]);
+        break;
+    }
+
+    ++m_numOfEmittedRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::getWindowSize()const
+{
+    return m_windowSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::getHopSize()const
+{
+    return m_hopSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::getNumOfFrequencyBins()const
+{
+    return m_windowSize / 2 + 1;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blWindowFunctionEnum blSTFT<blDataType>::getWindowFunction()const
+{
+    return m_windowFunction;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blSpectrogramValueEnum blSTFT<blDataType>::getSpectrogramValue()const
+{
+    return m_spectrogramValue;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline double blSTFT<blDataType>::getFrequencyOfBin(const int& binIndex,
+                                                    const double& samplingRate)const
+{
+    return double(binIndex) * samplingRate / double(m_windowSize);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage<blDataType>& blSTFT<blDataType>::getSpectrogram()const
+{
+    return m_spectrogram;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blSTFT<blDataType>::getNewestRowIndex()const
+{
+    return m_newestRowIndex;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline unsigned long long blSTFT<blDataType>::getNumOfEmittedRows()const
+{
+    return m_numOfEmittedRows;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline const blImage< std::complex<blDataType> >& blSTFT<blDataType>::getNewestSpectrum()const
+{
+    return m_newestSpectrum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blSTFT<blDataType>::copySpectrogramInChronologicalOrder(blImage<blDataType>& dstImage)const
+{
+    int numOfSpectrogramRows = m_spectrogram.size1();
+    int numOfBins = m_spectrogram.size2();
+
+    int numOfRows = int(std::min<unsigned long long>(m_numOfEmittedRows,(unsigned long long)(numOfSpectrogramRows)));
+
+    if(numOfRows == 0)
+        return;
+
+    dstImage.create(numOfRows,numOfBins);
+    dstImage.resetROI();
+
+    int oldestRowIndex = (m_newestRowIndex - numOfRows + 1 + numOfSpectrogramRows) % numOfSpectrogramRows;
+
+    for(int i = 0; i < numOfRows; ++i)
+    {
+        const blDataType* spectrogramRow = m_spectrogram[(oldestRowIndex + i) % numOfSpectrogramRows];
+
+        std::copy(spectrogramRow,spectrogramRow + numOfBins,dstImage[i]);
+    }
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_STFT_HPP
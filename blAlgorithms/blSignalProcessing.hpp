@@ -139,27 +139,37 @@ inline void generateFrequencyAxis(blImage<blDataType>& frequencyAxis,
 // DC frequency in the middle of
 // the image by multiplying the
 // image by (-1)^(rows + cols)
+//
+// NOTE: The image has to be modulated
+//       before the transform, the
+//       parity being taken from the
+//       top left corner of the ROI
+//       (to shift the output of a
+//       transform use fftshift)
 //-------------------------------------------------------------------
 template<typename blDataType>
 
 inline void shiftImageForFourierTransform(blImage<blDataType>& img)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-
     int yROI = img.yROI();
     int xROI = img.xROI();
 
-    for(int i = yROI; i < rows + yROI; ++i)
+    parallelForTiles(img,[&](const blImageTile& tile)
     {
-        for(int j = xROI; j < cols + xROI; ++j)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            if((i + j) % 2)
-            {
-                img(i,j) *= static_cast<blDataType>(-1);
-            }
+            blDataType* row = img[yROI + i] + xROI;
+
+            // We start from the first
+            // odd pixel of the row and
+            // step over the even ones
+
+            int jLimit = tile.m_col + tile.m_numOfCols;
+
+            for(int j = tile.m_col + ((i + tile.m_col + 1) & 1); j < jLimit; j += 2)
+                row[j] *= static_cast<blDataType>(-1);
         }
-    }
+    });
 }
 //-------------------------------------------------------------------
 
@@ -183,18 +193,39 @@ inline void shiftImageForFourierTransform(const blImage<blDataType>& srcImg,
 
 
 
-    for(int iSrc = srcyROI, iDst = dstyROI;
-        iSrc < srcRows + srcyROI && iDst < dstRows + dstyROI;
-        ++iSrc, ++iDst)
+    int rows = std::min(srcRows,dstRows);
+    int cols = std::min(srcCols,dstCols);
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int jSrc = srcxROI, jDst = dstxROI;
-            jSrc < srcCols + srcxROI && jDst < dstCols + dstxROI;
-            ++jSrc, ++jDst)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            if((iSrc + jSrc) % 2)
-                dstImg(iDst,jDst) = srcImg(iSrc,jSrc) * blDataType(-1);
+            const blDataType* srcRow = srcImg[i + srcyROI] + srcxROI;
+            blDataType* dstRow = dstImg[i + dstyROI] + dstxROI;
+
+            int jLimit = tile.m_col + tile.m_numOfCols;
+
+            // The even pixels are copied
+            // and the odd ones negated
+
+            int j = tile.m_col;
+
+            if((i + j) & 1)
+            {
+                dstRow[j] = srcRow[j] * blDataType(-1);
+                ++j;
+            }
+
+            for(; j + 1 < jLimit; j += 2)
+            {
+                dstRow[j] = srcRow[j];
+                dstRow[j + 1] = srcRow[j + 1] * blDataType(-1);
+            }
+
+            if(j < jLimit)
+                dstRow[j] = srcRow[j];
         }
-    }
+    });
 }
 //-------------------------------------------------------------------
 
@@ -281,9 +312,23 @@ inline blImage<blDataType> ifft2(const blImage< std::complex<blDataType> >& srcI
 
 
 //-------------------------------------------------------------------
-// The following functions calculate
-// the power spectrum in the frequency
-// domain
+// The following function is the kernel
+// used by the spectrum functions below,
+// it calculates the power spectrum, the
+// fourier spectrum and the phase angle
+// of an fft image (any of them can be
+// skipped by passing a NULL pointer)
+//
+// - Every row of the fft image is read
+//   once, and the row's power, magnitude,
+//   phase and log are calculated in tight
+//   loops while the row is in cache, also
+//   keeping track of the maximum values
+//   needed for the normalization
+// - The normalization is then done in a
+//   second pass, tile by tile
+// - Both passes are split across threads
+//   by rows
 //
 // NOTE:    This function works well if
 //          the images are floating point
@@ -291,57 +336,207 @@ inline blImage<blDataType> ifft2(const blImage< std::complex<blDataType> >& srcI
 //-------------------------------------------------------------------
 template<typename blDataType>
 
-inline void fftPowerSpectrum(const blImage< std::complex<blDataType> >& srcImage,
-                             blImage<blDataType>& dstImage,
-                             const bool& shouldResultsBePlottedOnALogScale,
-                             const bool& shouldResultsBeNormalized)
+inline void fftSpectrumComponents(const blImage< std::complex<blDataType> >& fftComplexImage,
+                                  blImage<blDataType>* powerSpectrumImage,
+                                  blImage<blDataType>* fourierSpectrumImage,
+                                  blImage<blDataType>* phaseAngleImage,
+                                  const bool& shouldResultsBePlottedOnALogScale,
+                                  const bool& shouldPowerSpectrumResultsBeNormalized,
+                                  const bool& shouldFourierSpectrumResultsBeNormalized,
+                                  const bool& shouldPhaseAngleResultsBeNormalized)
 {
-    // We step through the source
-    // image, calculate the power
-    // and save it into the destination
-    // image, therefore the images
-    // don't have to have the same
-    // ROI, we just stop whenever
-    // we encounter the end of either
-    // image's ROI
-
-    int srcRows = srcImage.size1ROI();
-    int srcCols = srcImage.size2ROI();
-    int srcyROI = srcImage.yROI();
-    int srcxROI = srcImage.xROI();
-
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
-
-    for(int iSrc = srcyROI, iDst = dstyROI; iSrc < (srcRows + srcyROI) && iDst < (dstRows + dstyROI); ++iSrc, ++iDst)
+    // Just like the functions below,
+    // the images don't have to have
+    // the same ROI, we just stop
+    // whenever we encounter the end
+    // of either image's ROI
+
+    blImage<blDataType>* componentImages[3] = {powerSpectrumImage,
+                                               fourierSpectrumImage,
+                                               phaseAngleImage};
+
+    bool shouldComponentsBeNormalized[3] = {shouldPowerSpectrumResultsBeNormalized,
+                                            shouldFourierSpectrumResultsBeNormalized,
+                                            shouldPhaseAngleResultsBeNormalized};
+
+    int rows = fftComplexImage.size1ROI();
+    int cols = fftComplexImage.size2ROI();
+
+    for(int c = 0; c < 3; ++c)
     {
-        for(int jSrc = srcxROI, jDst = dstxROI; jSrc < (srcCols + srcxROI) && jDst < (dstCols + dstxROI); ++jSrc, ++jDst)
+        if(componentImages[c] != NULL)
         {
-            // Calculate the magnitude
+            rows = std::min(rows,componentImages[c]->size1ROI());
+            cols = std::min(cols,componentImages[c]->size2ROI());
+        }
+        else
+            shouldComponentsBeNormalized[c] = false;
+    }
 
-            dstImage(iDst,jDst) = (srcImage(iSrc,jSrc).real() * srcImage(iSrc,jSrc).real() +
-                                   srcImage(iSrc,jSrc).imag() * srcImage(iSrc,jSrc).imag());
+    if(rows <= 0 || cols <= 0)
+        return;
+
+    int fftyROI = fftComplexImage.yROI();
+    int fftxROI = fftComplexImage.xROI();
 
-            // Calculate the log if
-            // we need to
+    // The maximum absolute values
+    // of the components, merged
+    // from the maxima of each tile
+
+    blDataType maxValues[3] = {0,0,0};
+    std::mutex maxValuesMutex;
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        blDataType tileMaxValues[3] = {0,0,0};
+
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+        {
+            const std::complex<blDataType>* fftRow = fftComplexImage[fftyROI + i] + fftxROI;
 
-            if(shouldResultsBePlottedOnALogScale)
+            blDataType* componentRows[3];
+
+            for(int c = 0; c < 3; ++c)
+            {
+                if(componentImages[c] != NULL)
+                    componentRows[c] = (*componentImages[c])[componentImages[c]->yROI() + i] + componentImages[c]->xROI();
+                else
+                    componentRows[c] = NULL;
+            }
+
+            blDataType* powerRow = componentRows[0];
+            blDataType* magnitudeRow = componentRows[1];
+            blDataType* phaseRow = componentRows[2];
+
+            // The magnitude is the square
+            // root of the power, so when
+            // the power is not wanted we
+            // calculate it in place in the
+            // magnitude row
+
+            blDataType* squaredMagnitudeRow = (powerRow != NULL ? powerRow : magnitudeRow);
+
+            if(squaredMagnitudeRow != NULL)
+            {
+                for(int j = 0; j < cols; ++j)
+                    squaredMagnitudeRow[j] = fftRow[j].real() * fftRow[j].real() + fftRow[j].imag() * fftRow[j].imag();
+
+                if(magnitudeRow != NULL)
+                {
+                    for(int j = 0; j < cols; ++j)
+                        magnitudeRow[j] = std::sqrt(squaredMagnitudeRow[j]);
+                }
+            }
+
+            if(phaseRow != NULL)
             {
-                dstImage(iDst,jDst) = std::log(blDataType(1) + dstImage(iDst,jDst));
+                for(int j = 0; j < cols; ++j)
+                    phaseRow[j] = std::atan2(fftRow[j].imag(),fftRow[j].real());
+            }
+
+            // Take the log and keep
+            // track of the maxima
+
+            for(int c = 0; c < 3; ++c)
+            {
+                if(componentRows[c] == NULL)
+                    continue;
+
+                blDataType* componentRow = componentRows[c];
+                blDataType maxValue = tileMaxValues[c];
+
+                if(shouldResultsBePlottedOnALogScale && shouldComponentsBeNormalized[c])
+                {
+                    for(int j = 0; j < cols; ++j)
+                    {
+                        componentRow[j] = std::log(blDataType(1) + componentRow[j]);
+                        maxValue = std::max(maxValue,std::abs(componentRow[j]));
+                    }
+                }
+                else if(shouldResultsBePlottedOnALogScale)
+                {
+                    for(int j = 0; j < cols; ++j)
+                        componentRow[j] = std::log(blDataType(1) + componentRow[j]);
+                }
+                else if(shouldComponentsBeNormalized[c])
+                {
+                    for(int j = 0; j < cols; ++j)
+                        maxValue = std::max(maxValue,std::abs(componentRow[j]));
+                }
+
+                tileMaxValues[c] = maxValue;
             }
         }
-    }
+
+        std::lock_guard<std::mutex> lock(maxValuesMutex);
+
+        for(int c = 0; c < 3; ++c)
+            maxValues[c] = std::max(maxValues[c],tileMaxValues[c]);
+    });
 
     // Normalize the results
-    // if we need to
+    // if we need to (an all zero
+    // component is left as is)
 
-    if(shouldResultsBeNormalized)
+    for(int c = 0; c < 3; ++c)
     {
-        auto normValueFS = norm(dstImage,cv::NORM_INF);
-        perElementDivision(dstImage,normValueFS);
+        if(maxValues[c] == blDataType(0))
+            shouldComponentsBeNormalized[c] = false;
     }
+
+    if(!shouldComponentsBeNormalized[0] &&
+       !shouldComponentsBeNormalized[1] &&
+       !shouldComponentsBeNormalized[2])
+    {
+        return;
+    }
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
+    {
+        for(int c = 0; c < 3; ++c)
+        {
+            if(!shouldComponentsBeNormalized[c])
+                continue;
+
+            blImage<blDataType>& componentImage = (*componentImages[c]);
+
+            for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
+            {
+                blDataType* componentRow = componentImage[componentImage.yROI() + i] + componentImage.xROI() + tile.m_col;
+
+                perElementRowOperation<blSimdDivide>(componentRow,maxValues[c],componentRow,tile.m_numOfCols);
+            }
+        }
+    });
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following functions calculate
+// the power spectrum in the frequency
+// domain
+//
+// NOTE:    This function works well if
+//          the images are floating point
+//          (float or double)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void fftPowerSpectrum(const blImage< std::complex<blDataType> >& srcImage,
+                             blImage<blDataType>& dstImage,
+                             const bool& shouldResultsBePlottedOnALogScale,
+                             const bool& shouldResultsBeNormalized)
+{
+    fftSpectrumComponents(srcImage,
+                          &dstImage,
+                          (blImage<blDataType>*)NULL,
+                          (blImage<blDataType>*)NULL,
+                          shouldResultsBePlottedOnALogScale,
+                          shouldResultsBeNormalized,
+                          false,
+                          false);
 }
 //-------------------------------------------------------------------
 
@@ -383,55 +578,14 @@ inline void fftFourierSpectrum(const blImage< std::complex<blDataType> >& fftCom
                                const bool& shouldResultsBePlottedOnALogScale,
                                const bool& shouldResultsBeNormalized)
 {
-    // We step through the source
-    // image, calculate the fourier
-    // spectrum and save it into
-    // the destination image,
-    // therefore the images
-    // don't have to have the same
-    // ROI, we just stop whenever
-    // we encounter the end of either
-    // image's ROI
-
-    int fsRows = fourierSpectrumImage.size1ROI();
-    int fsCols = fourierSpectrumImage.size2ROI();
-    int fsyROI = fourierSpectrumImage.yROI();
-    int fsxROI = fourierSpectrumImage.xROI();
-
-    int fftRows = fftComplexImage.size1ROI();
-    int fftCols = fftComplexImage.size2ROI();
-    int fftyROI = fftComplexImage.yROI();
-    int fftxROI = fftComplexImage.xROI();
-
-    for(int iFS = fsyROI, iFFT = fftyROI;
-        iFS < (fsRows + fsyROI) && iFFT < (fftRows + fftyROI);
-        ++iFS, ++iFFT)
-    {
-        for(int jFS = fsxROI, jFFT = fftxROI;
-            jFS < (fsCols + fsxROI) && jFFT < (fftCols + fftxROI);
-            ++jFS, ++jFFT)
-        {
-            fourierSpectrumImage(iFS,jFS) = std::sqrt(fftComplexImage(iFFT,jFFT).real() * fftComplexImage(iFFT,jFFT).real() +
-                                                      fftComplexImage(iFFT,jFFT).imag() * fftComplexImage(iFFT,jFFT).imag());
-
-            // Calculate the log if
-            // we need to
-
-            if(shouldResultsBePlottedOnALogScale)
-            {
-                fourierSpectrumImage(iFS,jFS) = std::log(blDataType(1) + fourierSpectrumImage(iFS,jFS));
-            }
-        }
-    }
-
-    // Normalize the results
-    // if we need to
-
-    if(shouldResultsBeNormalized)
-    {
-        auto normValueFS = norm(fourierSpectrumImage,cv::NORM_INF);
-        perElementDivision(fourierSpectrumImage,normValueFS);
-    }
+    fftSpectrumComponents(fftComplexImage,
+                          (blImage<blDataType>*)NULL,
+                          &fourierSpectrumImage,
+                          (blImage<blDataType>*)NULL,
+                          shouldResultsBePlottedOnALogScale,
+                          false,
+                          shouldResultsBeNormalized,
+                          false);
 }
 //-------------------------------------------------------------------
 
@@ -473,54 +627,14 @@ inline void fftPhaseAngle(const blImage< std::complex<blDataType> >& fftComplexI
                           const bool& shouldResultsBePlottedOnALogScale,
                           const bool& shouldResultsBeNormalized)
 {
-    // We step through the source
-    // image, calculate the phase
-    // angle and save it into
-    // the destination image,
-    // therefore the images
-    // don't have to have the same
-    // ROI, we just stop whenever
-    // we encounter the end of either
-    // image's ROI
-
-    int paRows = phaseAngleImage.size1ROI();
-    int paCols = phaseAngleImage.size2ROI();
-    int payROI = phaseAngleImage.yROI();
-    int paxROI = phaseAngleImage.xROI();
-
-    int fftRows = fftComplexImage.size1ROI();
-    int fftCols = fftComplexImage.size2ROI();
-    int fftyROI = fftComplexImage.yROI();
-    int fftxROI = fftComplexImage.xROI();
-
-    for(int iPA = payROI, iFFT = fftyROI;
-        iPA < (paRows + payROI) && iFFT < (fftRows + fftyROI);
-        ++iPA, ++iFFT)
-    {
-        for(int jPA = paxROI, jFFT = fftxROI;
-            jPA < (paCols + paxROI) && jFFT < (fftCols + fftxROI);
-            ++jPA, ++jFFT)
-        {
-            phaseAngleImage(iPA,jPA) = std::atan2(fftComplexImage(iFFT,jFFT).imag(),fftComplexImage(iFFT,jFFT).real());
-
-            // Calculate the log if
-            // we need to
-
-            if(shouldResultsBePlottedOnALogScale)
-            {
-                phaseAngleImage(iPA,jPA) = std::log(blDataType(1) + phaseAngleImage(iPA,jPA));
-            }
-        }
-    }
-
-    // Normalize the results
-    // if we need to
-
-    if(shouldResultsBeNormalized)
-    {
-        auto normValueFS = norm(phaseAngleImage,cv::NORM_INF);
-        perElementDivision(phaseAngleImage,normValueFS);
-    }
+    fftSpectrumComponents(fftComplexImage,
+                          (blImage<blDataType>*)NULL,
+                          (blImage<blDataType>*)NULL,
+                          &phaseAngleImage,
+                          shouldResultsBePlottedOnALogScale,
+                          false,
+                          false,
+                          shouldResultsBeNormalized);
 }
 //-------------------------------------------------------------------
 
@@ -565,78 +679,17 @@ inline void fftFourierSpectrumAndPhaseAngle(const blImage< std::complex<blDataTy
                                             const bool& shouldFourierSpectrumResultsBeNormalized,
                                             const bool& shouldPhaseAngleResultsBeNormalized)
 {
-    // We step through the source
-    // image, calculate the fourier
-    // spectrum and phase angle
-    // and save them into their appropriate
-    // images, therefore the images
-    // don't have to have the same
-    // ROI, we just stop whenever
-    // we encounter the end of either
-    // image's ROI
-
-    int fsRows = fourierSpectrumImage.size1ROI();
-    int fsCols = fourierSpectrumImage.size2ROI();
-    int fsyROI = fourierSpectrumImage.yROI();
-    int fsxROI = fourierSpectrumImage.xROI();
-
-    int paRows = phaseAngleImage.size1ROI();
-    int paCols = phaseAngleImage.size2ROI();
-    int payROI = phaseAngleImage.yROI();
-    int paxROI = phaseAngleImage.xROI();
-
-    int fftRows = fftComplexImage.size1ROI();
-    int fftCols = fftComplexImage.size2ROI();
-    int fftyROI = fftComplexImage.yROI();
-    int fftxROI = fftComplexImage.xROI();
-
-    for(int iFS = fsyROI, iPA = payROI, iFFT = fftyROI;
-        iFS < (fsRows + fsyROI) && iPA < (paRows + payROI) && iFFT < (fftRows + fftyROI);
-        ++iFS, ++iPA, ++iFFT)
-    {
-        for(int jFS = fsxROI, jPA = paxROI, jFFT = fftxROI;
-            jFS < (fsCols + fsxROI) && jPA < (paCols + paxROI) && jFFT < (fftCols + fftxROI);
-            ++jFS, ++jPA, ++jFFT)
-        {
-            // Calculate the magnitude
-
-            fourierSpectrumImage(iFS,jFS) = std::sqrt(fftComplexImage(iFFT,jFFT).real() * fftComplexImage(iFFT,jFFT).real() +
-                                                      fftComplexImage(iFFT,jFFT).imag() * fftComplexImage(iFFT,jFFT).imag());
-
-            // Calculate the phase
-
-            phaseAngleImage(iPA,jPA) = std::atan2(fftComplexImage(iFFT,jFFT).imag(),fftComplexImage(iFFT,jFFT).real());
-
-            // Let's take the log
-            // if we need to
-
-            if(shouldResultsBePlottedOnALogScale)
-            {
-                fourierSpectrumImage(iFS,jFS) = std::log(blDataType(1) + fourierSpectrumImage(iFS,jFS));
-                phaseAngleImage(iPA,jPA) = std::log(blDataType(1) + phaseAngleImage(iPA,jPA));
-            }
-        }
-    }
-
-    // Normalize the fourier
-    // spectrum results
-    // if we need to
-
-    if(shouldFourierSpectrumResultsBeNormalized)
-    {
-        auto normValueFS = norm(fourierSpectrumImage,cv::NORM_INF);
-        perElementDivision(fourierSpectrumImage,normValueFS);
-    }
-
-    // Normalize the phase
-    // angle results
-    // if we need to
-
-    if(shouldPhaseAngleResultsBeNormalized)
-    {
-        auto normValuePA = norm(fourierSpectrumImage,cv::NORM_INF);
-        perElementDivision(phaseAngleImage,normValuePA);
-    }
+    // The phase angle is normalized
+    // by its own maximum
+
+    fftSpectrumComponents(fftComplexImage,
+                          (blImage<blDataType>*)NULL,
+                          &fourierSpectrumImage,
+                          &phaseAngleImage,
+                          shouldResultsBePlottedOnALogScale,
+                          false,
+                          shouldFourierSpectrumResultsBeNormalized,
+                          shouldPhaseAngleResultsBeNormalized);
 }
 //-------------------------------------------------------------------
 
@@ -718,6 +771,282 @@ inline blImage< std::complex<blDataType> > fftComplexImageFromFourierSpectrumAnd
 
 
 
+//-------------------------------------------------------------------
+// The following structure holds the
+// terms used to compute the filter
+// masks, which are separable into a
+// row part and a column part
+//
+// - For a pixel at (dy,dx) from the
+//   zero frequency, the (squared)
+//   distance relative to the elliptical
+//   cutoff radius is the sum of the
+//   row term dy^2/yR^2 and the column
+//   term dx^2/xR^2, and the same goes
+//   for the bandwidth
+// - The gaussian lowpass/highpass masks
+//   are products of a row factor and a
+//   column factor
+// - The terms are indexed by the rows
+//   and columns of the image the mask
+//   is used on, so they're rotated when
+//   the zero frequency is in the corner
+//   (unshifted spectrum)
+//-------------------------------------------------------------------
+struct blFilterMaskTerms
+{
+    int                                     m_numOfRows = 0;
+    int                                     m_numOfCols = 0;
+    bool                                    m_isZeroFrequencyInTheMiddle = true;
+
+    std::vector<double>                     m_rowRadiusTerms;
+    std::vector<double>                     m_colRadiusTerms;
+    std::vector<double>                     m_rowBandwidthTerms;
+    std::vector<double>                     m_colBandwidthTerms;
+    std::vector<double>                     m_rowGaussianFactors;
+    std::vector<double>                     m_colGaussianFactors;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to map a row/col index
+// of a mask with the zero frequency in
+// the middle to the index of an image
+// with the zero frequency either in the
+// middle or in the corner
+//-------------------------------------------------------------------
+inline int filterMaskIndexToImageIndex(const int& maskIndex,
+                                       const int& size,
+                                       const bool& isZeroFrequencyInTheMiddle)
+{
+    if(isZeroFrequencyInTheMiddle)
+        return maskIndex;
+    else
+        return (maskIndex - size/2 + size) % size;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to compute the
+// separable terms of a filter mask
+//-------------------------------------------------------------------
+inline void computeFilterMaskTerms(blFilterMaskTerms& terms,
+                                   const int& rows,
+                                   const int& cols,
+                                   const double& cutoffFrequencyAsARatioOfImageRadius,
+                                   const double& bandwidthAsARatioOfImageRadius,
+                                   const bool& isZeroFrequencyInTheMiddle = true)
+{
+    terms.m_numOfRows = rows;
+    terms.m_numOfCols = cols;
+    terms.m_isZeroFrequencyInTheMiddle = isZeroFrequencyInTheMiddle;
+
+    double yMiddle = double(rows)/2.0;
+    double xMiddle = double(cols)/2.0;
+
+    // Cutoff radii and
+    // bandwidths in the x
+    // and y directions
+
+    double yR = cutoffFrequencyAsARatioOfImageRadius * double(rows)/2.0;
+    double xR = cutoffFrequencyAsARatioOfImageRadius * double(cols)/2.0;
+
+    double yBandwidth = bandwidthAsARatioOfImageRadius * double(rows/2.0);
+    double xBandwidth = bandwidthAsARatioOfImageRadius * double(cols/2.0);
+
+    // The vectors only grow,
+    // so a thread reusing the
+    // terms doesn't allocate
+
+    terms.m_rowRadiusTerms.resize(rows);
+    terms.m_rowBandwidthTerms.resize(rows);
+    terms.m_rowGaussianFactors.resize(rows);
+
+    terms.m_colRadiusTerms.resize(cols);
+    terms.m_colBandwidthTerms.resize(cols);
+    terms.m_colGaussianFactors.resize(cols);
+
+    for(int i = 0; i < rows; ++i)
+    {
+        double dy = double(i) - yMiddle;
+        int rowIndex = filterMaskIndexToImageIndex(i,rows,isZeroFrequencyInTheMiddle);
+
+        terms.m_rowRadiusTerms[rowIndex] = (dy*dy) / (yR*yR);
+        terms.m_rowBandwidthTerms[rowIndex] = (dy*dy) / (yBandwidth*yBandwidth);
+        terms.m_rowGaussianFactors[rowIndex] = std::exp(-0.5 * terms.m_rowRadiusTerms[rowIndex]);
+    }
+
+    for(int j = 0; j < cols; ++j)
+    {
+        double dx = double(j) - xMiddle;
+        int colIndex = filterMaskIndexToImageIndex(j,cols,isZeroFrequencyInTheMiddle);
+
+        terms.m_colRadiusTerms[colIndex] = (dx*dx) / (xR*xR);
+        terms.m_colBandwidthTerms[colIndex] = (dx*dx) / (xBandwidth*xBandwidth);
+        terms.m_colGaussianFactors[colIndex] = std::exp(-0.5 * terms.m_colRadiusTerms[colIndex]);
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to raise a value to the
+// (integer) order of a Butterworth filter
+// by squaring, which is a lot cheaper
+// than std::pow
+//-------------------------------------------------------------------
+inline double filterOrderPower(const double& value,
+                               const int& filterOrder)
+{
+    if(filterOrder < 0)
+        return std::pow(value,double(filterOrder));
+
+    double result = 1.0;
+    double base = value;
+
+    for(int exponent = filterOrder; exponent > 0; exponent >>= 1)
+    {
+        if(exponent & 1)
+            result *= base;
+
+        base *= base;
+    }
+
+    return result;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to compute the value
+// of a filter mask at a pixel (in the
+// indexing of the image the terms
+// were computed for)
+//
+// - With r = (distance/cutoffRadius)^2
+//   and b = (distance/bandwidth)^2:
+//
+//   Butterworth lowpass  = 1/(1 + r^n)
+//   Butterworth highpass = 1/(1 + (1/r)^n)
+//   Gaussian lowpass     = exp(-r/2)
+//   Gaussian highpass    = 1 - exp(-r/2)
+//
+//   and with q = b*(1 - 1/r)^2, which is
+//   ((d^2 - c^2)/(d*bandwidth))^2:
+//
+//   Butterworth bandreject = 1/(1 + (1/q)^n)
+//   Gaussian bandreject    = 1 - exp(-q)
+//   bandpass               = 1 - bandreject
+//-------------------------------------------------------------------
+inline double filterMaskValue(const blFilterMaskTerms& terms,
+                              const int& i,
+                              const int& j,
+                              const int& filterOrder,
+                              const blFilterTypeEnum& filterType,
+                              const blFilterFunctionTypeEnum& filterFunctionType)
+{
+    double r = terms.m_rowRadiusTerms[i] + terms.m_colRadiusTerms[j];
+
+    switch(filterType)
+    {
+    default:
+    case BL_LOWPASS:
+
+        if(filterFunctionType == BL_GAUSSIAN)
+            return terms.m_rowGaussianFactors[i] * terms.m_colGaussianFactors[j];
+        else
+            return 1.0 / ( 1.0 + filterOrderPower(r,filterOrder) );
+
+    case BL_HIGHPASS:
+
+        if(filterFunctionType == BL_GAUSSIAN)
+            return 1.0 - terms.m_rowGaussianFactors[i] * terms.m_colGaussianFactors[j];
+        else
+            return 1.0 / ( 1.0 + filterOrderPower(1.0/r,filterOrder) );
+
+    case BL_BANDPASS:
+    case BL_BANDREJECT:
+    {
+        double b = terms.m_rowBandwidthTerms[i] + terms.m_colBandwidthTerms[j];
+        double q = b * (1.0 - 1.0/r) * (1.0 - 1.0/r);
+
+        double value = 0;
+
+        if(filterFunctionType == BL_GAUSSIAN)
+            value = 1.0 - std::exp(-q);
+        else
+            value = 1.0 / ( 1.0 + filterOrderPower(1.0/q,filterOrder) );
+
+        if(filterType == BL_BANDPASS)
+            return 1.0 - value;
+        else
+            return value;
+    }
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The value of a mask at the zero
+// frequency is not defined for every
+// filter, so we always assign it an
+// average of the four surrounding
+// pixels left, right, up and down
+// - Returns false when the image is
+//   too small to have neighbors
+//-------------------------------------------------------------------
+inline bool filterMaskCenterValue(const blFilterMaskTerms& terms,
+                                  const int& filterOrder,
+                                  const blFilterTypeEnum& filterType,
+                                  const blFilterFunctionTypeEnum& filterFunctionType,
+                                  int& centerRow,
+                                  int& centerCol,
+                                  double& centerValue)
+{
+    int rows = terms.m_numOfRows;
+    int cols = terms.m_numOfCols;
+
+    bool isShifted = terms.m_isZeroFrequencyInTheMiddle;
+
+    centerRow = filterMaskIndexToImageIndex(rows/2,rows,isShifted);
+    centerCol = filterMaskIndexToImageIndex(cols/2,cols,isShifted);
+
+    double sumOfNeighbors = 0;
+    int numOfNeighbors = 0;
+
+    if(rows >= 3)
+    {
+        sumOfNeighbors += filterMaskValue(terms,filterMaskIndexToImageIndex(rows/2 - 1,rows,isShifted),centerCol,filterOrder,filterType,filterFunctionType);     // Pixel above
+        sumOfNeighbors += filterMaskValue(terms,filterMaskIndexToImageIndex(rows/2 + 1,rows,isShifted),centerCol,filterOrder,filterType,filterFunctionType);     // Pixel below
+        numOfNeighbors += 2;
+    }
+
+    if(cols >= 3)
+    {
+        sumOfNeighbors += filterMaskValue(terms,centerRow,filterMaskIndexToImageIndex(cols/2 - 1,cols,isShifted),filterOrder,filterType,filterFunctionType);     // Pixel left
+        sumOfNeighbors += filterMaskValue(terms,centerRow,filterMaskIndexToImageIndex(cols/2 + 1,cols,isShifted),filterOrder,filterType,filterFunctionType);     // Pixel right
+        numOfNeighbors += 2;
+    }
+
+    if(numOfNeighbors == 0)
+        return false;
+
+    centerValue = sumOfNeighbors / double(numOfNeighbors);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // - The following functions draw
 //   an ellipse on a mask to create
@@ -739,121 +1068,127 @@ inline void filterMask(blImage<blDataType>& dstImage,
                        const blFilterTypeEnum& filterType = BL_LOWPASS,
                        const blFilterFunctionTypeEnum& filterFunctionType = BL_BUTTERWORTH)
 {
-    // Calculate the radial
-    // bounds of the filter
-    // mask
-
     int rows = dstImage.size1ROI();
     int cols = dstImage.size2ROI();
     int yROI = dstImage.yROI();
     int xROI = dstImage.xROI();
 
-    double yMiddle = double(rows)/2.0;
-    double xMiddle = double(cols)/2.0;
-
-    // The cutoff radii
-    // in the x and y
-    // directions
+    if(rows <= 0 || cols <= 0)
+        return;
 
-    // Cutoff radii in x
-    // and y directions
+    // The terms are reused
+    // by the calling thread
 
-    double yR = cutoffFrequencyAsARatioOfImageRadius * double(rows)/2.0;
-    double xR = cutoffFrequencyAsARatioOfImageRadius * double(cols)/2.0;
+    static thread_local blFilterMaskTerms terms;
 
-    double yBandwidth = bandwidthAsARatioOfImageRadius * double(rows/2.0);
-    double xBandwidth = bandwidthAsARatioOfImageRadius * double(cols/2.0);
-    double bandwidth = 0;
+    computeFilterMaskTerms(terms,
+                           rows,
+                           cols,
+                           cutoffFrequencyAsARatioOfImageRadius,
+                           bandwidthAsARatioOfImageRadius);
 
-    double cutoffRadius = 0;
-    double distanceRadius = 0;
+    // The mask is computed over
+    // the tiles of the ROI using
+    // the shared thread pool
+    // (a lambda doesn't capture a
+    // thread_local variable, the
+    // workers would each see their
+    // own empty terms, so they get
+    // a reference to the calling
+    // thread's terms instead)
 
-    double sinTheta = 0;
-    double cosTheta = 0;
+    const blFilterMaskTerms& callerTerms = terms;
 
-    for(int i = 0; i < rows; ++i)
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int j = 0; j < cols; ++j)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            distanceRadius = std::sqrt((double(i) - yMiddle)*(double(i) - yMiddle) + (double(j) - xMiddle)*(double(j) - xMiddle));
-
-            if(distanceRadius > 0)
-            {
-                sinTheta = std::abs(double(i) - yMiddle)/distanceRadius;
-                cosTheta = std::abs(double(j) - xMiddle)/distanceRadius;
-
-                cutoffRadius = (yR*xR) / std::sqrt( (yR*cosTheta)*(yR*cosTheta) + (xR*sinTheta)*(xR*sinTheta) );
+            blDataType* dstRow = dstImage[i + yROI] + xROI;
 
-                switch(filterType)
-                {
-                default:
-                case BL_LOWPASS:
-
-                    if(filterFunctionType == BL_BUTTERWORTH)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 / ( 1.0 + std::pow(distanceRadius/cutoffRadius,2.0*double(filterOrder)) ) );
-
-                    else if(filterFunctionType == BL_GAUSSIAN)
-                        dstImage(i + yROI,j + xROI) = blDataType( std::exp(-0.5 * (distanceRadius*distanceRadius)/(cutoffRadius*cutoffRadius)) );
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+                dstRow[j] = blDataType( filterMaskValue(callerTerms,i,j,filterOrder,filterType,filterFunctionType) );
+        }
+    });
 
-                    break;
+    int centerRow = 0;
+    int centerCol = 0;
+    double centerValue = 0;
 
-                case BL_HIGHPASS:
+    if(filterMaskCenterValue(terms,filterOrder,filterType,filterFunctionType,centerRow,centerCol,centerValue))
+        dstImage(centerRow + yROI,centerCol + xROI) = blDataType(centerValue);
+}
+//-------------------------------------------------------------------
 
-                    if(filterFunctionType == BL_BUTTERWORTH)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 / ( 1.0 + std::pow(cutoffRadius/distanceRadius,2.0*double(filterOrder)) ) );
 
-                    else if(filterFunctionType == BL_GAUSSIAN)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 - std::exp(-0.5 * (distanceRadius*distanceRadius)/(cutoffRadius*cutoffRadius)) );
 
-                    break;
+//-------------------------------------------------------------------
+// The following function filters a
+// spectrum in place, multiplying it by
+// a filter mask computed on the fly,
+// without ever creating the mask image
+//
+// - The spectrum can have its zero
+//   frequency in the middle (shifted)
+//   or in the top left corner, as it
+//   comes out of fft2
+//-------------------------------------------------------------------
+template<typename blDataType>
 
-                case BL_BANDPASS:
-                case BL_BANDREJECT:
+inline void applyFilterToSpectrum(blImage< std::complex<blDataType> >& spectrumImage,
+                                  const int& filterOrder,
+                                  const double& cutoffFrequencyAsARatioOfImageRadius,
+                                  const double& bandwidthAsARatioOfImageRadius,
+                                  const blFilterTypeEnum& filterType = BL_LOWPASS,
+                                  const blFilterFunctionTypeEnum& filterFunctionType = BL_BUTTERWORTH,
+                                  const bool& isZeroFrequencyInTheMiddle = true)
+{
+    int rows = spectrumImage.size1ROI();
+    int cols = spectrumImage.size2ROI();
+    int yROI = spectrumImage.yROI();
+    int xROI = spectrumImage.xROI();
 
-                    bandwidth = (yBandwidth*xBandwidth) / std::sqrt( (yBandwidth*cosTheta)*(yBandwidth*cosTheta) + (xBandwidth*sinTheta)*(xBandwidth*sinTheta) );
+    if(rows <= 0 || cols <= 0)
+        return;
 
-                    if(filterFunctionType == BL_BUTTERWORTH)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 / (1.0 + std::pow((distanceRadius*bandwidth)/(distanceRadius*distanceRadius - cutoffRadius*cutoffRadius),2.0*double(filterOrder))) );
+    static thread_local blFilterMaskTerms terms;
 
-                    else if(filterFunctionType == BL_GAUSSIAN)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 - std::exp( -std::pow((distanceRadius*distanceRadius - cutoffRadius*cutoffRadius)/(distanceRadius*bandwidth),2.0) ) );
+    computeFilterMaskTerms(terms,
+                           rows,
+                           cols,
+                           cutoffFrequencyAsARatioOfImageRadius,
+                           bandwidthAsARatioOfImageRadius,
+                           isZeroFrequencyInTheMiddle);
 
-                    if(filterType == BL_BANDPASS)
-                        dstImage(i + yROI,j + xROI) = blDataType( 1.0 - dstImage(i + yROI,j + xROI) );
+    int centerRow = -1;
+    int centerCol = -1;
+    double centerValue = 0;
 
-                    break;
-                }
-            }
-        }
+    if(!filterMaskCenterValue(terms,filterOrder,filterType,filterFunctionType,centerRow,centerCol,centerValue))
+    {
+        centerRow = -1;
+        centerCol = -1;
     }
 
-    // We did not set what
-    // the value in the center
-    // of the image, so we
-    // assign it an average
-    // of the four surrounding
-    // pixels left, right, up and down
+    // The workers read the calling
+    // thread's terms (see filterMask)
 
-    if(rows >= 3)
+    const blFilterMaskTerms& callerTerms = terms;
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        if(cols >= 3)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            dstImage(rows/2 + yROI,cols/2 + xROI) = ( dstImage(rows/2 + yROI - 1,cols/2 + xROI) +           // Pixel above
-                                                      dstImage(rows/2 + yROI + 1,cols/2 + xROI) +           // Pixel below
-                                                      dstImage(rows/2 + yROI,cols/2 + xROI - 1) +           // Pixel left
-                                                      dstImage(rows/2 + yROI,cols/2 + xROI + 1) ) / 4.0;    // Pixel right
-        }
-        else
-        {
-            dstImage(rows/2 + yROI,cols/2 + xROI) = ( dstImage(rows/2 + yROI - 1,cols/2 + xROI) +           // Pixel above
-                                                      dstImage(rows/2 + yROI + 1,cols/2 + xROI) ) / 2.0;    // Pixel below
+            std::complex<blDataType>* spectrumRow = spectrumImage[i + yROI] + xROI;
+
+            for(int j = tile.m_col; j < tile.m_col + tile.m_numOfCols; ++j)
+            {
+                if(i == centerRow && j == centerCol)
+                    spectrumRow[j] *= blDataType(centerValue);
+                else
+                    spectrumRow[j] *= blDataType( filterMaskValue(callerTerms,i,j,filterOrder,filterType,filterFunctionType) );
+            }
         }
-    }
-    else if(cols >= 3)
-    {
-        dstImage(rows/2 + yROI,cols/2 + xROI) = ( dstImage(rows/2 + yROI,cols/2 + xROI - 1) +               // Pixel left
-                                                  dstImage(rows/2 + yROI,cols/2 + xROI + 1) ) / 4.0;        // Pixel right
-    }
+    });
 }
 //-------------------------------------------------------------------
 
@@ -0,0 +1,63 @@
+#ifndef BL_IMAGEAPIBENCHMARKS_HPP
+#define BL_IMAGEAPIBENCHMARKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageAPIBenchmarks.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         An opt-in collection of benchmarks of the
+//                  blImageAPI library (blImageAPI.hpp does not
+//                  include it)
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageAPI.hpp
+//
+// NOTES:
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file and sub-files
+//-------------------------------------------------------------------
+
+#include <numeric>
+
+#include "../blImageAPI.hpp"
+
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+namespace blImageAPI
+{
+    // Functions used to time the pyramid
+    // construction on 1080p and 4K frames
+    // (getMillisecondsPerFrame is used by
+    // the other benchmarks too)
+
+    #include "blPyramidBenchmark.hpp"
+
+
+
+    // Functions used to time std::copy,
+    // std::accumulate and std::transform over
+    // an image ROI with the old circular iterators,
+    // the ROI iterators and a loop over the rows
+
+    #include "blImageROIIteratorBenchmark.hpp"
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEAPIBENCHMARKS_HPP
@@ -0,0 +1,255 @@
+#ifndef BL_IMAGEROIITERATORBENCHMARK_HPP
+#define BL_IMAGEROIITERATORBENCHMARK_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageROIIteratorBenchmark.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to benchmark std::copy,
+//                  std::accumulate and std::transform over an image
+//                  ROI, comparing the old circular iterator
+//                  (blImageCircularIterator) with the ROI iterator
+//                  returned by begin_ROI/end_ROI (blImageROIIterator)
+//                  and with a plain loop over the ROI rows
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageCircularIterator -- The old iterators
+//
+//                  blImageROIIterator -- The new iterators
+//
+//                  getMillisecondsPerFrame -- Used to time each run
+//                                             (blPyramidBenchmark.hpp)
+//
+// NOTES:           - The ROI is centered in the image, so its rows
+//                    are not back to back in memory
+//                  - The old iterator's difference is always zero,
+//                    so std::copy (which uses it) would copy nothing,
+//                    and its copy is timed with a (first != last)
+//                    loop instead, which is what std::accumulate and
+//                    std::transform do anyway
+//                  - Each algorithm is run once before being timed,
+//                    and the times are the average time per run
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The times of one algorithm
+//-------------------------------------------------------------------
+struct blImageROIIteratorTimes
+{
+    double                                  m_circularIteratorMilliseconds = 0;
+    double                                  m_ROIiteratorMilliseconds = 0;
+    double                                  m_rowLoopMilliseconds = 0;
+
+    // Circular iterator time
+    // over ROI iterator time
+
+    double                                  m_speedup = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The results of a benchmark run
+//-------------------------------------------------------------------
+struct blImageROIIteratorBenchmarkResults
+{
+    int                                     m_numOfRows = 0;
+    int                                     m_numOfCols = 0;
+    int                                     m_numOfROIRows = 0;
+    int                                     m_numOfROICols = 0;
+    int                                     m_numOfRuns = 0;
+
+    blImageROIIteratorTimes                 m_copy;
+    blImageROIIteratorTimes                 m_accumulate;
+    blImageROIIteratorTimes                 m_transform;
+
+    // The sum of the last accumulate
+    // (so that it's not optimized away)
+
+    double                                  m_accumulatedValue = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to compute the speedup
+// of a set of times
+//-------------------------------------------------------------------
+inline void calculateImageROIIteratorSpeedup(blImageROIIteratorTimes& times)
+{
+    if(times.m_ROIiteratorMilliseconds > 0)
+        times.m_speedup = times.m_circularIteratorMilliseconds / times.m_ROIiteratorMilliseconds;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function benchmarks the
+// iterators over a ROI of an image
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImageROIIteratorBenchmarkResults benchmarkImageROIIterators(const int& numOfRows,
+                                                                     const int& numOfCols,
+                                                                     const int& numOfROIRows,
+                                                                     const int& numOfROICols,
+                                                                     const int& numOfRuns = 20)
+{
+    blImageROIIteratorBenchmarkResults results;
+
+    results.m_numOfRows = numOfRows;
+    results.m_numOfCols = numOfCols;
+    results.m_numOfROIRows = numOfROIRows;
+    results.m_numOfROICols = numOfROICols;
+    results.m_numOfRuns = numOfRuns;
+
+    if(numOfROIRows <= 0 || numOfROICols <= 0 ||
+       numOfROIRows > numOfRows || numOfROICols > numOfCols)
+    {
+        return results;
+    }
+
+    // A synthetic image with
+    // a centered ROI
+
+    blImage<blDataType> image(numOfRows,numOfCols);
+
+    for(int i = 0; i < numOfRows; ++i)
+    {
+        blDataType* row = image[i];
+
+        for(int j = 0; j < numOfCols; ++j)
+            row[j] = blDataType((i * 7 + j * 13) % 256);
+    }
+
+    image.setROI((numOfRows - numOfROIRows) / 2,
+                 (numOfCols - numOfROICols) / 2,
+                 numOfROIRows,
+                 numOfROICols);
+
+    const int sizeOfROI = image.sizeROI();
+
+    std::vector<blDataType> dstValues(sizeOfROI);
+
+    auto transformFunctor = [](const blDataType& value){return blDataType(value * blDataType(2) + blDataType(1));};
+
+    // The old iterators
+
+    blImageCircularIterator<blDataType> circularBegin(image,0,1);
+    blImageCircularIterator<blDataType> circularEnd(image,sizeOfROI,0);
+
+    // std::copy
+
+    results.m_copy.m_circularIteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        auto dstIter = dstValues.begin();
+
+        for(auto iter = circularBegin; iter != circularEnd; ++iter,++dstIter)
+            (*dstIter) = (*iter);
+    });
+
+    results.m_copy.m_ROIiteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        std::copy(image.begin_ROI(),image.end_ROI(),dstValues.begin());
+    });
+
+    results.m_copy.m_rowLoopMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        auto dstIter = dstValues.begin();
+
+        for(auto row : image.getRowsROI())
+            dstIter = std::copy(row.begin(),row.end(),dstIter);
+    });
+
+    // std::accumulate
+
+    double accumulatedValue = 0;
+
+    results.m_accumulate.m_circularIteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        accumulatedValue = std::accumulate(circularBegin,circularEnd,double(0));
+    });
+
+    results.m_accumulate.m_ROIiteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        accumulatedValue = std::accumulate(image.begin_ROI(),image.end_ROI(),double(0));
+    });
+
+    results.m_accumulate.m_rowLoopMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        accumulatedValue = 0;
+
+        for(auto row : image.getRowsROI())
+            accumulatedValue = std::accumulate(row.begin(),row.end(),accumulatedValue);
+    });
+
+    results.m_accumulatedValue = accumulatedValue;
+
+    // std::transform
+
+    results.m_transform.m_circularIteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        std::transform(circularBegin,circularEnd,dstValues.begin(),transformFunctor);
+    });
+
+    results.m_transform.m_ROIiteratorMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        std::transform(image.begin_ROI(),image.end_ROI(),dstValues.begin(),transformFunctor);
+    });
+
+    results.m_transform.m_rowLoopMilliseconds = getMillisecondsPerFrame(numOfRuns,[&]()
+    {
+        auto dstIter = dstValues.begin();
+
+        for(auto row : image.getRowsROI())
+            dstIter = std::transform(row.begin(),row.end(),dstIter,transformFunctor);
+    });
+
+    calculateImageROIIteratorSpeedup(results.m_copy);
+    calculateImageROIIteratorSpeedup(results.m_accumulate);
+    calculateImageROIIteratorSpeedup(results.m_transform);
+
+    return results;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function benchmarks the
+// iterators over an 800x1500 ROI of a
+// 1080p image
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImageROIIteratorBenchmarkResults benchmarkImageROIIterators(const int& numOfRuns = 20)
+{
+    return benchmarkImageROIIterators<blDataType>(1080,1920,800,1500,numOfRuns);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEROIITERATORBENCHMARK_HPP
@@ -0,0 +1,210 @@
+#ifndef BL_PYRAMIDBENCHMARK_HPP
+#define BL_PYRAMIDBENCHMARK_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blPyramidBenchmark.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to benchmark the construction of
+//                  the gaussian and laplacian pyramids of a frame,
+//                  comparing buildGaussianPyramids/buildLaplacianPyramids
+//                  with blPyramid (with and without the fused level
+//                  functions)
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    buildGaussianPyramids,buildLaplacianPyramids --
+//                  The reference construction
+//
+//                  blPyramid -- The preallocated construction
+//
+// NOTES:           - Every construction builds the same levels
+//                    (as many as the frame allows) from the same
+//                    synthetic frame
+//                  - Each construction is run once before being
+//                    timed, so the buffers are already allocated
+//                  - The times are the average time per frame
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The results of a benchmark run
+//-------------------------------------------------------------------
+struct blPyramidBenchmarkResults
+{
+    int                                     m_numOfRows = 0;
+    int                                     m_numOfCols = 0;
+    int                                     m_numOfLevels = 0;
+    int                                     m_numOfFrames = 0;
+
+    // buildGaussianPyramids followed
+    // by buildLaplacianPyramids
+
+    double                                  m_referenceMillisecondsPerFrame = 0;
+
+    // blPyramid with cvPyrDown,
+    // cvPyrUp and cvSub
+
+    double                                  m_pyramidMillisecondsPerFrame = 0;
+
+    // blPyramid with the fused
+    // level functions
+
+    double                                  m_fusedPyramidMillisecondsPerFrame = 0;
+
+    // Reference time over
+    // fused time
+
+    double                                  m_speedup = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to time a construction
+// over a number of frames (after one
+// untimed run)
+//-------------------------------------------------------------------
+template<typename blFunctorType>
+
+inline double getMillisecondsPerFrame(const int& numOfFrames,
+                                      const blFunctorType& buildPyramids)
+{
+    buildPyramids();
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < numOfFrames; ++i)
+        buildPyramids();
+
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double,std::milli>(endTime - startTime).count() / double(std::max(1,numOfFrames));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function benchmarks
+// the pyramid constructions for a
+// frame size
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blPyramidBenchmarkResults benchmarkPyramidConstruction(const int& numOfRows,
+                                                              const int& numOfCols,
+                                                              const int& numOfFrames = 20)
+{
+    blPyramidBenchmarkResults results;
+
+    results.m_numOfRows = numOfRows;
+    results.m_numOfCols = numOfCols;
+    results.m_numOfFrames = numOfFrames;
+
+    if(numOfRows <= 0 || numOfCols <= 0)
+        return results;
+
+    // A synthetic frame with
+    // some texture in it
+
+    blImage<blDataType> srcImage(numOfRows,numOfCols);
+
+    for(int i = 0; i < numOfRows; ++i)
+    {
+        blDataType* row = srcImage[i];
+
+        for(int j = 0; j < numOfCols; ++j)
+            row[j] = blDataType((i * 7 + j * 13 + (i * j) % 31) % 256);
+    }
+
+    // The reference construction
+
+    int numOfLevels = calculateMaxNumberOfPyramidLevels(srcImage);
+
+    std::vector< blImage<blDataType> > gaussianPyramid;
+    std::vector< blImage<blDataType> > laplacianPyramid;
+
+    initializePyramidVector(srcImage,gaussianPyramid);
+    initializePyramidVector(srcImage,laplacianPyramid);
+
+    results.m_referenceMillisecondsPerFrame = getMillisecondsPerFrame(numOfFrames,[&]()
+    {
+        buildGaussianPyramids(srcImage,
+                              gaussianPyramid.begin(),
+                              gaussianPyramid.end());
+
+        buildLaplacianPyramids(gaussianPyramid.begin(),
+                               gaussianPyramid.end(),
+                               laplacianPyramid.begin(),
+                               laplacianPyramid.end());
+    });
+
+    // The preallocated constructions
+
+    blPyramid<blDataType> pyramid;
+    pyramid.useFusedKernels(false);
+
+    results.m_pyramidMillisecondsPerFrame = getMillisecondsPerFrame(numOfFrames,[&]()
+    {
+        pyramid.buildLaplacianPyramid(srcImage);
+    });
+
+    blPyramid<blDataType> fusedPyramid;
+
+    results.m_fusedPyramidMillisecondsPerFrame = getMillisecondsPerFrame(numOfFrames,[&]()
+    {
+        fusedPyramid.buildLaplacianPyramid(srcImage);
+    });
+
+    results.m_numOfLevels = std::max(numOfLevels,fusedPyramid.getNumOfLevels());
+
+    if(results.m_fusedPyramidMillisecondsPerFrame > 0)
+        results.m_speedup = results.m_referenceMillisecondsPerFrame / results.m_fusedPyramidMillisecondsPerFrame;
+
+    return results;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function benchmarks the
+// pyramid constructions for 1080p and
+// 4K frames
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline std::vector<blPyramidBenchmarkResults> benchmarkPyramidConstruction(const int& numOfFrames = 20)
+{
+    std::vector<blPyramidBenchmarkResults> results;
+
+    results.push_back(benchmarkPyramidConstruction<blDataType>(1080,1920,numOfFrames));
+    results.push_back(benchmarkPyramidConstruction<blDataType>(2160,3840,numOfFrames));
+
+    return results;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_PYRAMIDBENCHMARK_HPP
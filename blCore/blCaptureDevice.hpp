@@ -19,11 +19,17 @@
 //
 // DEPENDENCIES:    blImage
 //                  std::shared_ptr -- From boost c++ libraries
+//                  blCaptureSource -- Interface for sources other
+//                                     than opencv's cameras and
+//                                     movie files
 //
-// NOTES:
+// NOTES:           - The device is either connected to an opencv
+//                    CvCapture or to a blCaptureSource, and every
+//                    query and property goes to whichever one is
+//                    connected
 //
 // DATE CREATED:    Sep/22/2009
-// DATE UPDATED:
+// DATE UPDATED:    Oct/16/2026
 //-------------------------------------------------------------------
 
 
@@ -69,6 +75,12 @@ public: // Public functions
 
     bool                                    connectToAVIFile(const std::string& AVIFileName);
 
+    // Function used to connect
+    // to a custom capture source
+    // (such as a synthetic one)
+
+    bool                                    connectToCaptureSource(const std::shared_ptr<blCaptureSource>& captureSource);
+
     // Function used to disconnect
     // the capture device
 
@@ -87,6 +99,40 @@ public: // Public functions
     template<typename blDataType>
     bool                                    queryFrame(blImage<blDataType>& frame)const;
 
+    // Function used to query an
+    // image into a blImage that
+    // gets reused from frame to
+    // frame
+    // - When the depth and number
+    //   of channels match, the image
+    //   is only allocated when its
+    //   size changes and the data is
+    //   copied with memcpy
+    // - Otherwise the image is
+    //   converted using the image
+    //   conversion engine
+    // - A frame that wraps the
+    //   buffer owned by the capture
+    //   driver (see queryFrameView)
+    //   gets its own storage first
+
+    template<typename blDataType>
+    bool                                    queryFrameInto(blImage<blDataType>& frame)const;
+
+    // Function used to query an
+    // image by wrapping the buffer
+    // owned by the capture driver,
+    // without copying it
+    // NOTE:  The frame is only valid
+    //        until the next frame is
+    //        grabbed (or the device is
+    //        disconnected) and it fails
+    //        when the depth or number
+    //        of channels don't match
+
+    template<typename blDataType>
+    bool                                    queryFrameView(blImage<blDataType>& frame)const;
+
     // Functions used to get/set the
     // properties of the capture
     // device (both camera and movie file)
@@ -135,6 +181,12 @@ public: // Public functions
 
     const std::shared_ptr<CvCapture>&       getCaptureDevice()const;
 
+    // Function used to get the
+    // custom capture source (NULL
+    // when connected through opencv)
+
+    const std::shared_ptr<blCaptureSource>& getCaptureSource()const;
+
     // Function used to convert
     // this object to a pure OpenCV
     // CvCapture device
@@ -160,12 +212,28 @@ public: // Public functions
             return m_captureDevice.get();
     }
 
+protected: // Protected functions
+
+    // Functions used to grab a frame
+    // and to get/set a property from
+    // whichever source is connected
+
+    IplImage*                               grabNextFrame()const;
+    double                                  getCaptureProperty(const int& propertyID)const;
+    int                                     setCaptureProperty(const int& propertyID,
+                                                               const double& value);
+
 protected: // Protected variables
 
     // Smart pointer holding
     // the connected device
 
     std::shared_ptr<CvCapture>              m_captureDevice;
+
+    // Smart pointer holding the
+    // connected custom source
+
+    std::shared_ptr<blCaptureSource>        m_captureSource;
 };
 //-------------------------------------------------------------------
 
@@ -187,6 +255,7 @@ inline blCaptureDevice::blCaptureDevice(const blCaptureDevice& captureDevice)
     // device
 
     m_captureDevice = captureDevice.getCaptureDevice();
+    m_captureSource = captureDevice.getCaptureSource();
 }
 //-------------------------------------------------------------------
 
@@ -199,6 +268,57 @@ inline const std::shared_ptr<CvCapture>& blCaptureDevice::getCaptureDevice()cons
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+inline const std::shared_ptr<blCaptureSource>& blCaptureDevice::getCaptureSource()const
+{
+    return m_captureSource;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline IplImage* blCaptureDevice::grabNextFrame()const
+{
+    if(m_captureSource)
+        return m_captureSource->queryFrame();
+
+    if(m_captureDevice)
+        return cvQueryFrame(m_captureDevice.get());
+
+    return NULL;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline double blCaptureDevice::getCaptureProperty(const int& propertyID)const
+{
+    if(m_captureSource)
+        return m_captureSource->getProperty(propertyID);
+
+    if(m_captureDevice)
+        return cvGetCaptureProperty(m_captureDevice.get(),propertyID);
+
+    return 0.0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blCaptureDevice::setCaptureProperty(const int& propertyID,
+                                               const double& value)
+{
+    if(m_captureSource)
+        return m_captureSource->setProperty(propertyID,value);
+
+    if(m_captureDevice)
+        return cvSetCaptureProperty(m_captureDevice.get(),propertyID,value);
+
+    return 0;
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 inline void blCaptureDevice::disconnectDevice()
 {
@@ -209,6 +329,8 @@ inline void blCaptureDevice::disconnectDevice()
 
     std::shared_ptr<CvCapture> disconnectedCaptureDevice;
     m_captureDevice = disconnectedCaptureDevice;
+
+    m_captureSource.reset();
 }
 //-------------------------------------------------------------------
 
@@ -234,12 +356,13 @@ inline bool blCaptureDevice::connectToCamera(const int& whichCamera,
         // the AVI file
 
         m_captureDevice = std::shared_ptr<CvCapture>(captureDevice,releaseCaptureDevice());
+        m_captureSource.reset();
 
         // Set the desired resolution
         // of the webcam capture
 
-        cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_WIDTH,width);
-        cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_HEIGHT,height);
+        setCaptureProperty(CV_CAP_PROP_FRAME_WIDTH,width);
+        setCaptureProperty(CV_CAP_PROP_FRAME_HEIGHT,height);
 
         return true;
     }
@@ -272,6 +395,7 @@ inline bool blCaptureDevice::connectToAVIFile(const std::string& AVIFileName)
         // to the AVI file
 
         m_captureDevice = std::shared_ptr<CvCapture>(tempCaptureDevice,releaseCaptureDevice());
+        m_captureSource.reset();
 
         return true;
     }
@@ -287,10 +411,36 @@ inline bool blCaptureDevice::connectToAVIFile(const std::string& AVIFileName)
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+inline bool blCaptureDevice::connectToCaptureSource(const std::shared_ptr<blCaptureSource>& captureSource)
+{
+    if(!captureSource)
+    {
+        // Error -- We need a
+        //          valid source
+
+        return false;
+    }
+
+    // The opencv device (if any)
+    // gets released, and from now
+    // on everything goes through
+    // the source
+
+    std::shared_ptr<CvCapture> disconnectedCaptureDevice;
+    m_captureDevice = disconnectedCaptureDevice;
+
+    m_captureSource = captureSource;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 inline bool blCaptureDevice::isConnected()const
 {
-    if(!m_captureDevice)
+    if(!m_captureDevice && !m_captureSource)
         return false;
     else
         return true;
@@ -301,17 +451,118 @@ inline bool blCaptureDevice::isConnected()const
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline bool blCaptureDevice::queryFrame(blImage<blDataType>& frame)const
+{
+    // Querying a frame reuses
+    // the frame passed in
+
+    return this->queryFrameInto(frame);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blCaptureDevice::queryFrameInto(blImage<blDataType>& frame)const
 {
     // First check if the
     // capture device has
     // been connected
 
-    if(this->isConnected())
+    if(!this->isConnected())
     {
-        frame.clone(cvQueryFrame(m_captureDevice.get()),0);
-        return true;
+        // Error -- The device is not
+        //          currently connected
+        //          so we simply quit
+
+        return false;
+    }
+
+    const IplImage* capturedImage = grabNextFrame();
+
+    if(!capturedImage)
+    {
+        // Error -- There was no
+        //          frame to grab
+
+        return false;
+    }
+
+    if(capturedImage->depth != frame.getDepth() ||
+       capturedImage->nChannels != frame.getNumOfChannels())
+    {
+        // The types don't match,
+        // so we convert the image
+        // (which also reuses the
+        // frame when its size
+        // matches)
+
+        return frame.clone(capturedImage,0);
+    }
+
+    // When the frame is a view of
+    // the captured image (the buffer
+    // owned by the driver, which is
+    // overwritten by the next grab)
+    // we let go of it, so that the
+    // frame gets its own storage
+
+    const IplImage* currentFrameImage = frame.getImagePtr();
+
+    if(currentFrameImage != NULL &&
+       currentFrameImage->imageData == capturedImage->imageData)
+    {
+        frame = blImage<blDataType>();
+    }
+
+    // The types match, so we
+    // make sure the frame is
+    // the right size (this does
+    // not reallocate it when
+    // it already is)
+
+    if(!frame.create(capturedImage->height,capturedImage->width))
+        return false;
+
+    IplImage* frameImage = frame.getImagePtr();
+
+    if(frameImage->widthStep == capturedImage->widthStep)
+    {
+        // Same layout, so we copy
+        // the whole buffer at once
+
+        std::memcpy(frameImage->imageData,
+                    capturedImage->imageData,
+                    std::size_t(capturedImage->widthStep) * capturedImage->height);
     }
     else
+    {
+        // Different paddings, so
+        // we copy row by row
+
+        std::size_t rowSizeInBytes = std::min(frameImage->widthStep,capturedImage->widthStep);
+
+        for(int i = 0; i < capturedImage->height; ++i)
+        {
+            std::memcpy(frameImage->imageData + std::ptrdiff_t(frameImage->widthStep) * i,
+                        capturedImage->imageData + std::ptrdiff_t(capturedImage->widthStep) * i,
+                        rowSizeInBytes);
+        }
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blCaptureDevice::queryFrameView(blImage<blDataType>& frame)const
+{
+    // First check if the
+    // capture device has
+    // been connected
+
+    if(!this->isConnected())
     {
         // Error -- The device is not
         //          currently connected
@@ -319,6 +570,16 @@ inline bool blCaptureDevice::queryFrame(blImage<blDataType>& frame)const
 
         return false;
     }
+
+    IplImage* capturedImage = grabNextFrame();
+
+    // The driver owns the image,
+    // so we wrap it without being
+    // in charge of releasing it
+    // (this fails for a NULL image
+    // or for mismatched types)
+
+    return frame.wrap(capturedImage,false);
 }
 //-------------------------------------------------------------------
 
@@ -331,7 +592,7 @@ inline double blCaptureDevice::getFrameWidth()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_WIDTH);
+        return getCaptureProperty(CV_CAP_PROP_FRAME_WIDTH);
     else
         return 0.0;
 }
@@ -346,7 +607,7 @@ inline double blCaptureDevice::getFrameHeight()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_HEIGHT);
+        return getCaptureProperty(CV_CAP_PROP_FRAME_HEIGHT);
     else
         return 0.0;
 }
@@ -362,8 +623,8 @@ inline CvSize blCaptureDevice::getFrameSize()const
 
     if(this->isConnected())
     {
-        int Width = int(cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_WIDTH));
-        int Height = int(cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_HEIGHT));
+        int Width = int(getCaptureProperty(CV_CAP_PROP_FRAME_WIDTH));
+        int Height = int(getCaptureProperty(CV_CAP_PROP_FRAME_HEIGHT));
         return cvSize(Width,Height);
     }
     else
@@ -380,7 +641,7 @@ inline double blCaptureDevice::getFPS()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FPS);
+        return getCaptureProperty(CV_CAP_PROP_FPS);
     else
         return 0.0;
 }
@@ -395,7 +656,7 @@ inline double blCaptureDevice::getBrightness()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_BRIGHTNESS);
+        return getCaptureProperty(CV_CAP_PROP_BRIGHTNESS);
     else
         return 0.0;
 }
@@ -410,7 +671,7 @@ inline double blCaptureDevice::getContrast()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_CONTRAST);
+        return getCaptureProperty(CV_CAP_PROP_CONTRAST);
     else
         return 0.0;
 }
@@ -425,7 +686,7 @@ inline double blCaptureDevice::getSaturation()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_SATURATION);
+        return getCaptureProperty(CV_CAP_PROP_SATURATION);
     else
         return 0.0;
 }
@@ -440,7 +701,7 @@ inline double blCaptureDevice::getHue()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_HUE);
+        return getCaptureProperty(CV_CAP_PROP_HUE);
     else
         return 0.0;
 }
@@ -455,7 +716,7 @@ inline double blCaptureDevice::getTotalNumOfFrames()const
     // of frames, otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_COUNT);
+        return getCaptureProperty(CV_CAP_PROP_FRAME_COUNT);
     else
         return 0.0;
 }
@@ -471,7 +732,7 @@ inline double blCaptureDevice::getCurrentPositionInMilliseconds()const
     // return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_MSEC);
+        return getCaptureProperty(CV_CAP_PROP_POS_MSEC);
     else
         return 0.0;
 }
@@ -486,7 +747,7 @@ inline double blCaptureDevice::getNextFrameIndex()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_FRAMES);
+        return getCaptureProperty(CV_CAP_PROP_POS_FRAMES);
     else
         return 0.0;
 }
@@ -503,7 +764,7 @@ inline double blCaptureDevice::getCurrentRelativePosition()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_AVI_RATIO);
+        return getCaptureProperty(CV_CAP_PROP_POS_AVI_RATIO);
     else
         return 0.0;
 }
@@ -519,7 +780,7 @@ inline double blCaptureDevice::getFourCharacterCodeOfCodec()const
     // otherwise return 0
 
     if(this->isConnected())
-        return cvGetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FOURCC);
+        return getCaptureProperty(CV_CAP_PROP_FOURCC);
     else
         return 0.0;
 }
@@ -530,7 +791,7 @@ inline double blCaptureDevice::getFourCharacterCodeOfCodec()const
 inline int blCaptureDevice::setFrameWidth(const double& width)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty((*this),CV_CAP_PROP_FRAME_WIDTH,width);
+        return setCaptureProperty(CV_CAP_PROP_FRAME_WIDTH,width);
     else
         return 0;
 }
@@ -541,7 +802,7 @@ inline int blCaptureDevice::setFrameWidth(const double& width)
 inline int blCaptureDevice::setFrameHeight(const double& height)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_HEIGHT,height);
+        return setCaptureProperty(CV_CAP_PROP_FRAME_HEIGHT,height);
     else
         return 0;
 }
@@ -553,8 +814,8 @@ inline void blCaptureDevice::setFrameSize(const CvSize& size)
 {
     if(this->isConnected())
     {
-        cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_WIDTH,double(size.width));
-        cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FRAME_HEIGHT,double(size.height));
+        setCaptureProperty(CV_CAP_PROP_FRAME_WIDTH,double(size.width));
+        setCaptureProperty(CV_CAP_PROP_FRAME_HEIGHT,double(size.height));
         return;
     }
     else
@@ -567,7 +828,7 @@ inline void blCaptureDevice::setFrameSize(const CvSize& size)
 inline int blCaptureDevice::setFPS(const double& FPS)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FPS,FPS);
+        return setCaptureProperty(CV_CAP_PROP_FPS,FPS);
     else
         return 0;
 }
@@ -578,7 +839,7 @@ inline int blCaptureDevice::setFPS(const double& FPS)
 inline int blCaptureDevice::setBrightness(const double& brightness)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_BRIGHTNESS,brightness);
+        return setCaptureProperty(CV_CAP_PROP_BRIGHTNESS,brightness);
     else
         return 0;
 }
@@ -589,7 +850,7 @@ inline int blCaptureDevice::setBrightness(const double& brightness)
 inline int blCaptureDevice::setContrast(const double& contrast)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_CONTRAST,contrast);
+        return setCaptureProperty(CV_CAP_PROP_CONTRAST,contrast);
     else
         return 0;
 }
@@ -600,7 +861,7 @@ inline int blCaptureDevice::setContrast(const double& contrast)
 inline int blCaptureDevice::setSaturation(const double& saturation)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_SATURATION,saturation);
+        return setCaptureProperty(CV_CAP_PROP_SATURATION,saturation);
     else
         return 0;
 }
@@ -611,7 +872,7 @@ inline int blCaptureDevice::setSaturation(const double& saturation)
 inline int blCaptureDevice::setHue(const double& hue)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_HUE,hue);
+        return setCaptureProperty(CV_CAP_PROP_HUE,hue);
     else
         return 0;
 }
@@ -622,7 +883,7 @@ inline int blCaptureDevice::setHue(const double& hue)
 inline int blCaptureDevice::setCurrentPositionInMilliseconds(const double& currentPositionInMilliseconds)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_MSEC,currentPositionInMilliseconds);
+        return setCaptureProperty(CV_CAP_PROP_POS_MSEC,currentPositionInMilliseconds);
     else
         return 0;
 }
@@ -633,7 +894,7 @@ inline int blCaptureDevice::setCurrentPositionInMilliseconds(const double& curre
 inline int blCaptureDevice::setNextFrameIndex(const double& nextFrameIndex)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_FRAMES,nextFrameIndex);
+        return setCaptureProperty(CV_CAP_PROP_POS_FRAMES,nextFrameIndex);
     else
         return 0;
 }
@@ -644,7 +905,7 @@ inline int blCaptureDevice::setNextFrameIndex(const double& nextFrameIndex)
 inline int blCaptureDevice::setCurrentRelativePosition(const double& currentRelativePosition)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_POS_AVI_RATIO,currentRelativePosition);
+        return setCaptureProperty(CV_CAP_PROP_POS_AVI_RATIO,currentRelativePosition);
     else
         return 0;
 }
@@ -655,7 +916,7 @@ inline int blCaptureDevice::setCurrentRelativePosition(const double& currentRela
 inline int blCaptureDevice::setFourCharacterCodeOfCodec(const double& fourCharacterCodeOfCodec)
 {
     if(this->isConnected())
-        return cvSetCaptureProperty(m_captureDevice.get(),CV_CAP_PROP_FOURCC,fourCharacterCodeOfCodec);
+        return setCaptureProperty(CV_CAP_PROP_FOURCC,fourCharacterCodeOfCodec);
     else
         return 0;
 }
@@ -0,0 +1,79 @@
+#ifndef BL_CAPTURESOURCE_HPP
+#define BL_CAPTURESOURCE_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blCaptureSource.hpp
+// CLASS:           blCaptureSource
+// BASE CLASS:      None
+//
+// PURPOSE:         An interface for video sources other than the
+//                  cameras and movie files opened through OpenCV,
+//                  which a blCaptureDevice (and therefore the video
+//                  thread classes) can be connected to
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    IplImage -- The frames are handed out as
+//                              opencv images
+//
+// NOTES:           - Just like cvQueryFrame, queryFrame returns an
+//                    image owned by the source, which stays valid
+//                    until the next frame is queried
+//                  - The properties use the same CV_CAP_PROP_*
+//                    identifiers as cvGetCaptureProperty, and a
+//                    source simply returns 0 for the properties
+//                    it doesn't support
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blCaptureSource
+{
+public: // Constructors and destructors
+
+    // Virtual destructor
+
+    virtual ~blCaptureSource()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to grab
+    // the next frame (NULL
+    // when there's none)
+
+    virtual IplImage*                       queryFrame() = 0;
+
+    // Functions used to get/set
+    // the properties of the source
+
+    virtual double                          getProperty(const int& propertyID)const = 0;
+    virtual int                             setProperty(const int& propertyID,
+                                                        const double& value) = 0;
+};
+//-------------------------------------------------------------------
+
+
+#endif // BL_CAPTURESOURCE_HPP
@@ -42,6 +42,15 @@
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// Forward declaration of the lazy
+// expressions (blImageExpressions.hpp)
+//-------------------------------------------------------------------
+template<typename blNodeType>
+class blImageExpression;
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 class blImage : public blImage6<blDataType>
@@ -49,8 +58,17 @@ class blImage : public blImage6<blDataType>
 public: // Constructors and destructors
 
     // Default constructor
+    // (It creates an empty
+    // image without allocating
+    // any image data)
 
-    explicit blImage(const int& rows = 1,
+    blImage();
+
+    // Constructor that creates
+    // an image of the specified
+    // size
+
+    explicit blImage(const int& rows,
                      const int& cols = 1);
 
     // Constructor that initializes
@@ -65,6 +83,10 @@ public: // Constructors and destructors
 
     blImage(const blImage<blDataType>& image);
 
+    // Move constructor
+
+    blImage(blImage<blDataType>&& image)noexcept;
+
     // Copy constructor from
     // a different type image
 
@@ -96,6 +118,14 @@ public: // Constructors and destructors
     template<typename blDataType2,int numOfRows,int numOfCols>
     blImage(const blDataType2 (&staticArray)[numOfRows][numOfCols]);
 
+    // Constructor evaluating a
+    // lazy image expression in
+    // one single pass
+    // (defined in blImageExpressions.hpp)
+
+    template<typename blNodeType>
+    blImage(const blImageExpression<blNodeType>& expression);
+
     // Construct from a cv::Mat
 
     #ifdef OPENCV_CORE_MAT_HPP
@@ -111,6 +141,7 @@ public: // Constructors and destructors
 public: // Assignment operators
 
     blImage<blDataType>&                            operator=(const blImage<blDataType>& image);
+    blImage<blDataType>&                            operator=(blImage<blDataType>&& image)noexcept;
     template<typename blDataType2>
     blImage<blDataType>&                            operator=(const blImage<blDataType2>& image);
     template<int numOfRows,int numOfCols>
@@ -119,6 +150,8 @@ public: // Assignment operators
     blImage<blDataType>&                            operator=(const blDataType (&staticArray)[numOfRows][numOfCols]);
     template<typename blDataType2,int numOfRows,int numOfCols>
     blImage<blDataType>&                            operator=(const blDataType2 (&staticArray)[numOfRows][numOfCols]);
+    template<typename blNodeType>
+    blImage<blDataType>&                            operator=(const blImageExpression<blNodeType>& expression);
 
     #ifdef OPENCV_CORE_MAT_HPP
     inline blImage<blDataType>&                     operator=(cv::Mat& img);
@@ -127,6 +160,20 @@ public: // Assignment operators
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage<blDataType>::blImage() : blImage6<blDataType>()
+{
+    // We purposely don't create
+    // any image data here, so that
+    // default constructed images
+    // (for example when resizing
+    // a std::vector of images)
+    // don't allocate anything
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline blImage<blDataType>::blImage(const int& rows,
@@ -177,6 +224,18 @@ inline blImage<blDataType>::blImage(const blImage<blDataType>& image)
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage<blDataType>::blImage(blImage<blDataType>&& image)noexcept
+                                    : blImage6<blDataType>(std::move(image))
+{
+    // We take over the image
+    // pointer of the passed image
+    // leaving it empty
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 template<typename blDataType2>
@@ -304,6 +363,21 @@ inline blImage<blDataType>& blImage<blDataType>::operator=(const blImage<blDataT
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage<blDataType>& blImage<blDataType>::operator=(blImage<blDataType>&& image)noexcept
+{
+    // We take over the image
+    // pointer of the passed image
+    // leaving it empty
+
+    blImage6<blDataType>::operator=(std::move(image));
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 template<typename blDataType2>
@@ -68,6 +68,11 @@ public: // Constructors and destructors
 
 
 
+    // Move constructor
+    blImage0(blImage0<blDataType>&& Image0)noexcept;
+
+
+
     // Destructor
     ~blImage0()
     {
@@ -83,6 +88,10 @@ public: // Overloaded operators
 
     blImage0<blDataType>&                   operator=(const blImage0<blDataType>& Image0);
 
+    // Move assignment operator
+
+    blImage0<blDataType>&                   operator=(blImage0<blDataType>&& Image0)noexcept;
+
 
 
     // Overloaded operators for
@@ -346,6 +355,15 @@ inline blImage0<blDataType>::blImage0(const blImage0<blDataType>& Image0)
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage0<blDataType>::blImage0(blImage0<blDataType>&& Image0)noexcept
+                                      : m_imageSharedPtr(std::move(Image0.m_imageSharedPtr))
+{
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline blImage0<blDataType>& blImage0<blDataType>::operator=(const blImage0<blDataType>& Image0)
@@ -356,6 +374,21 @@ inline blImage0<blDataType>& blImage0<blDataType>::operator=(const blImage0<blDa
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage0<blDataType>& blImage0<blDataType>::operator=(blImage0<blDataType>&& Image0)noexcept
+{
+    // We steal the shared pointer
+    // of the passed image, which
+    // avoids the atomic reference
+    // count increment/decrement
+
+    m_imageSharedPtr = std::move(Image0.m_imageSharedPtr);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline blDataType* blImage0<blDataType>::operator[](const int& rowIndex)
@@ -580,6 +613,12 @@ inline int blImage0<blDataType>::getSizeOfDepthInBytes()const
 template<typename blDataType>
 inline int blImage0<blDataType>::size1()const
 {
+    // A default constructed
+    // image has no data
+
+    if(!m_imageSharedPtr)
+        return 0;
+
     return m_imageSharedPtr->height;
 }
 //-------------------------------------------------------------------
@@ -589,6 +628,12 @@ inline int blImage0<blDataType>::size1()const
 template<typename blDataType>
 inline int blImage0<blDataType>::size2()const
 {
+    // A default constructed
+    // image has no data
+
+    if(!m_imageSharedPtr)
+        return 0;
+
     if(isDataTypeNativelySupported())
     {
         return m_imageSharedPtr->width;
@@ -610,6 +655,40 @@ inline int blImage0<blDataType>::size()const
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blImage0<blDataType>::length()const
+{
+    return size();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blImage0<blDataType>::max_size()const
+{
+    return size();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blImage0<blDataType>::empty()const
+{
+    // An image is empty when
+    // it's been default constructed
+    // or cleared
+
+    if(!m_imageSharedPtr)
+        return true;
+    else
+        return false;
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline bool blImage0<blDataType>::doesIndexPointToPixelInImage(const int& RowIndex,
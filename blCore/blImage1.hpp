@@ -53,12 +53,20 @@ public: // Constructors and destructors
 
     blImage1(const blImage1<blDataType>& Image1);
 
+    // Move constructor
+    blImage1(blImage1<blDataType>&& Image1)noexcept;
+
     // Destructor
 
     ~blImage1()
     {
     }
 
+public: // Assignment operators
+
+    blImage1<blDataType>&                   operator=(const blImage1<blDataType>& Image1);
+    blImage1<blDataType>&                   operator=(blImage1<blDataType>&& Image1)noexcept;
+
 public: // Iterator functions
 
     // Useful iterators
@@ -99,11 +107,40 @@ inline blImage1<blDataType>::blImage1(const blImage1<blDataType>& Image1)
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage1<blDataType>::blImage1(blImage1<blDataType>&& Image1)noexcept
+                                      : blImage0<blDataType>(std::move(Image1))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage1<blDataType>& blImage1<blDataType>::operator=(const blImage1<blDataType>& Image1)
+{
+    blImage0<blDataType>::operator=(Image1);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage1<blDataType>& blImage1<blDataType>::operator=(blImage1<blDataType>&& Image1)noexcept
+{
+    blImage0<blDataType>::operator=(std::move(Image1));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline typename blImage1<blDataType>::iterator blImage1<blDataType>::begin()
 {
-    return ( &(*this)(0) );
+    return ( this->getImageDataCastToDataType() );
 }
 //-------------------------------------------------------------------
 
@@ -112,7 +149,7 @@ inline typename blImage1<blDataType>::iterator blImage1<blDataType>::begin()
 template<typename blDataType>
 inline typename blImage1<blDataType>::iterator blImage1<blDataType>::end()
 {
-    return ( &(*this)(this->size()) );
+    return ( this->getImageDataCastToDataType() + this->size() );
 }
 //-------------------------------------------------------------------
 
@@ -121,7 +158,7 @@ inline typename blImage1<blDataType>::iterator blImage1<blDataType>::end()
 template<typename blDataType>
 inline typename blImage1<blDataType>::const_iterator blImage1<blDataType>::cbegin()const
 {
-    return ( &(*this)(0) );
+    return ( this->getImageDataCastToDataType() );
 }
 //-------------------------------------------------------------------
 
@@ -130,7 +167,7 @@ inline typename blImage1<blDataType>::const_iterator blImage1<blDataType>::cbegi
 template<typename blDataType>
 inline typename blImage1<blDataType>::const_iterator blImage1<blDataType>::cend()const
 {
-    return ( &(*this)(this->size()) );
+    return ( this->getImageDataCastToDataType() + this->size() );
 }
 //-------------------------------------------------------------------
 
@@ -139,7 +176,7 @@ inline typename blImage1<blDataType>::const_iterator blImage1<blDataType>::cend(
 template<typename blDataType>
 inline typename blImage1<blDataType>::reverse_iterator blImage1<blDataType>::rbegin()
 {
-    return ( &(*this)(this->size() - 1) );
+    return ( this->getImageDataCastToDataType() + this->size() - 1 );
 }
 //-------------------------------------------------------------------
 
@@ -148,7 +185,7 @@ inline typename blImage1<blDataType>::reverse_iterator blImage1<blDataType>::rbe
 template<typename blDataType>
 inline typename blImage1<blDataType>::reverse_iterator blImage1<blDataType>::rend()
 {
-    return ( &(*this)(0) - 1);
+    return ( this->getImageDataCastToDataType() - 1 );
 }
 //-------------------------------------------------------------------
 
@@ -157,7 +194,7 @@ inline typename blImage1<blDataType>::reverse_iterator blImage1<blDataType>::ren
 template<typename blDataType>
 inline typename blImage1<blDataType>::const_reverse_iterator blImage1<blDataType>::crbegin()const
 {
-    return ( &(*this)(this->size() - 1) );
+    return ( this->getImageDataCastToDataType() + this->size() - 1 );
 }
 //-------------------------------------------------------------------
 
@@ -166,7 +203,7 @@ inline typename blImage1<blDataType>::const_reverse_iterator blImage1<blDataType
 template<typename blDataType>
 inline typename blImage1<blDataType>::const_reverse_iterator blImage1<blDataType>::crend()const
 {
-    return ( &(*this)(0) - 1);
+    return ( this->getImageDataCastToDataType() - 1 );
 }
 //-------------------------------------------------------------------
 
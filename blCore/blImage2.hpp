@@ -14,6 +14,9 @@
 //                    Of Interest)
 //                  - It also adds random access forward and reverse
 //                    begin/end iterators
+//                  - It also adds row ranges (getRows/getRowsROI)
+//                    used to traverse the image one contiguous
+//                    row span at a time
 //
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
@@ -64,12 +67,20 @@ public: // Constructors and destructors
 
     blImage2(const blImage2<blDataType>& Image2);
 
+    // Move constructor
+    blImage2(blImage2<blDataType>&& Image2)noexcept;
+
     // Destructor
 
     ~blImage2()
     {
     }
 
+public: // Assignment operators
+
+    blImage2<blDataType>&                   operator=(const blImage2<blDataType>& Image2);
+    blImage2<blDataType>&                   operator=(blImage2<blDataType>&& Image2)noexcept;
+
 public: // Public functions
 
     // Functions used to create
@@ -139,6 +150,19 @@ public: // Public functions
     int                                     yROI()const;
     int                                     iROI()const;
 
+    // Functions used to traverse
+    // the whole image or the image
+    // ROI one row at a time, where
+    // each row is a contiguous span
+    // that respects the widthStep
+    // padding of the image
+    // (see blImageRowIterators.hpp)
+
+    blImageRowRange<blDataType>             getRows();
+    blImageRowRange<const blDataType>       getRows()const;
+    blImageRowRange<blDataType>             getRowsROI();
+    blImageRowRange<const blDataType>       getRowsROI()const;
+
 
     // Functions used to
     // set/get the ROI
@@ -218,6 +242,35 @@ inline blImage2<blDataType>::blImage2(const blImage2<blDataType>& Image2) : blIm
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage2<blDataType>::blImage2(blImage2<blDataType>&& Image2)noexcept
+                                      : blImage1<blDataType>(std::move(Image2))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage2<blDataType>& blImage2<blDataType>::operator=(const blImage2<blDataType>& Image2)
+{
+    blImage1<blDataType>::operator=(Image2);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage2<blDataType>& blImage2<blDataType>::operator=(blImage2<blDataType>&& Image2)noexcept
+{
+    blImage1<blDataType>::operator=(std::move(Image2));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline bool blImage2<blDataType>::create(int numOfRows,int numOfCols)
@@ -254,6 +307,13 @@ inline bool blImage2<blDataType>::create(int numOfRows,int numOfCols)
 
     IplImage* newImage = NULL;
 
+    // If the image buffer pool
+    // is enabled, we take the image
+    // from it and give it back to it
+    // once the image is released
+
+    bool isImageFromPool = blImageBufferPool::getInstance().isEnabled();
+
     // We check if the Depth and
     // Number of channels is correct
     // for the specified data type
@@ -265,9 +325,14 @@ inline bool blImage2<blDataType>::create(int numOfRows,int numOfCols)
         // number of channels
         // is correct
 
-        newImage = cvCreateImage(cvSize(numOfCols,numOfRows),
-                                 this->getDepth(),
-                                 this->getNumOfChannels());
+        if(isImageFromPool)
+            newImage = blImageBufferPool::getInstance().acquireImage(cvSize(numOfCols,numOfRows),
+                                                                     this->getDepth(),
+                                                                     this->getNumOfChannels());
+        else
+            newImage = cvCreateImage(cvSize(numOfCols,numOfRows),
+                                     this->getDepth(),
+                                     this->getNumOfChannels());
     }
     else
     {
@@ -281,9 +346,14 @@ inline bool blImage2<blDataType>::create(int numOfRows,int numOfCols)
         // to represent the data type
         // correctly
 
-        newImage = cvCreateImage(cvSize(numOfCols*sizeof(blDataType),numOfRows),
-                                 this->getDepth(),
-                                 this->getNumOfChannels());
+        if(isImageFromPool)
+            newImage = blImageBufferPool::getInstance().acquireImage(cvSize(numOfCols*sizeof(blDataType),numOfRows),
+                                                                     this->getDepth(),
+                                                                     this->getNumOfChannels());
+        else
+            newImage = cvCreateImage(cvSize(numOfCols*sizeof(blDataType),numOfRows),
+                                     this->getDepth(),
+                                     this->getNumOfChannels());
 
         // Some custom data types
         // might contain pointers
@@ -309,7 +379,10 @@ inline bool blImage2<blDataType>::create(int numOfRows,int numOfCols)
 
     if(newImage != NULL)
     {
-        this->m_imageSharedPtr = blImagePtr(newImage,releaseImage());
+        if(isImageFromPool)
+            this->m_imageSharedPtr = blImagePtr(newImage,releaseImageToPool());
+        else
+            this->m_imageSharedPtr = blImagePtr(newImage,releaseImage());
 
         // We always set the ROI
         // so that when we check the
@@ -494,6 +567,9 @@ inline bool blImage2<blDataType>::doesIndexPointToPixelInImageROI(const int& row
 template<typename blDataType>
 inline int blImage2<blDataType>::size1ROI()const
 {
+    if(!this->m_imageSharedPtr)
+        return 0;
+
     return (this->m_imageSharedPtr->roi->height);
 }
 //-------------------------------------------------------------------
@@ -503,6 +579,9 @@ inline int blImage2<blDataType>::size1ROI()const
 template<typename blDataType>
 inline int blImage2<blDataType>::size2ROI()const
 {
+    if(!this->m_imageSharedPtr)
+        return 0;
+
     return (this->m_imageSharedPtr->roi->width);
 }
 //-------------------------------------------------------------------
@@ -521,6 +600,9 @@ inline int blImage2<blDataType>::sizeROI()const
 template<typename blDataType>
 inline int blImage2<blDataType>::xROI()const
 {
+    if(!this->m_imageSharedPtr)
+        return 0;
+
     return (this->m_imageSharedPtr->roi->xOffset);
 }
 //-------------------------------------------------------------------
@@ -530,6 +612,9 @@ inline int blImage2<blDataType>::xROI()const
 template<typename blDataType>
 inline int blImage2<blDataType>::yROI()const
 {
+    if(!this->m_imageSharedPtr)
+        return 0;
+
     return (this->m_imageSharedPtr->roi->yOffset);
 }
 //-------------------------------------------------------------------
@@ -544,10 +629,73 @@ inline int blImage2<blDataType>::iROI()const
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<blDataType> blImage2<blDataType>::getRows()
+{
+    if(!this->m_imageSharedPtr)
+        return blImageRowRange<blDataType>();
+
+    return blImageRowRange<blDataType>(this->getImageDataCastToDataType(),
+                                       this->size1(),
+                                       this->size2(),
+                                       this->getWidthStep());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<const blDataType> blImage2<blDataType>::getRows()const
+{
+    if(!this->m_imageSharedPtr)
+        return blImageRowRange<const blDataType>();
+
+    return blImageRowRange<const blDataType>(this->getImageDataCastToDataType(),
+                                             this->size1(),
+                                             this->size2(),
+                                             this->getWidthStep());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<blDataType> blImage2<blDataType>::getRowsROI()
+{
+    if(!this->m_imageSharedPtr)
+        return blImageRowRange<blDataType>();
+
+    return blImageRowRange<blDataType>((*this)[this->yROI()] + this->xROI(),
+                                       this->size1ROI(),
+                                       this->size2ROI(),
+                                       this->getWidthStep());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<const blDataType> blImage2<blDataType>::getRowsROI()const
+{
+    if(!this->m_imageSharedPtr)
+        return blImageRowRange<const blDataType>();
+
+    return blImageRowRange<const blDataType>((*this)[this->yROI()] + this->xROI(),
+                                             this->size1ROI(),
+                                             this->size2ROI(),
+                                             this->getWidthStep());
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline _IplROI* blImage2<blDataType>::getROI()const
 {
+    if(!this->m_imageSharedPtr)
+        return NULL;
+
     return this->m_imageSharedPtr->roi;
 }
 //-------------------------------------------------------------------
@@ -557,6 +705,9 @@ inline _IplROI* blImage2<blDataType>::getROI()const
 template<typename blDataType>
 inline CvRect blImage2<blDataType>::getROIRect()const
 {
+    if(!this->m_imageSharedPtr)
+        return CvRect(0,0,0,0);
+
     return CvRect(this->m_imageSharedPtr->roi->xOffset,
                   this->m_imageSharedPtr->roi->yOffset,
                   this->m_imageSharedPtr->roi->width,
@@ -764,7 +915,7 @@ inline void blImage2<blDataType>::setROIheightAndwidth(const int& height,
 template<typename blDataType>
 inline void blImage2<blDataType>::setROIinCaseItIsNotSet()
 {
-    if(!this->m_imageSharedPtr->roi)
+    if(this->m_imageSharedPtr && !this->m_imageSharedPtr->roi)
         cvSetImageROI((*this),CvRect(0,0,this->size2(),this->size1()));
 }
 //-------------------------------------------------------------------
@@ -14,6 +14,8 @@
 //                  - It also adds random access forward and reverse
 //                    begin/end circular iterators used to iterate
 //                    over an image's ROI
+//                    (They are lightweight pointer/stride iterators,
+//                    see blImageROIIterator.hpp)
 //
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
@@ -46,8 +48,8 @@ class blImage3 : public blImage2<blDataType>
 {
 public: // Public typedefs
 
-    typedef blImageCircularIterator<blDataType>                     iteratorROI;
-    typedef blImageCircularIterator<const blDataType>               const_iteratorROI;
+    typedef blImageROIIterator<blDataType>                          iteratorROI;
+    typedef blImageROIIterator<const blDataType>                    const_iteratorROI;
 
     typedef typename blImage2<blDataType>::blImagePtr               blImagePtr;
 
@@ -59,11 +61,19 @@ public: // Constructors and destructors
     // Copy constructor
     blImage3(const blImage3<blDataType>& image3);
 
+    // Move constructor
+    blImage3(blImage3<blDataType>&& image3)noexcept;
+
     // Destructor
     ~blImage3()
     {
     }
 
+public: // Assignment operators
+
+    blImage3<blDataType>&                   operator=(const blImage3<blDataType>& image3);
+    blImage3<blDataType>&                   operator=(blImage3<blDataType>&& image3)noexcept;
+
 public: // Public functions
 
     // Function used to
@@ -143,6 +153,9 @@ public: // Circular iterators
     // go through the ROI because
     // the ROI is not a contiguous
     // space in memory)
+    // (They only hold pointers and
+    // strides, so they're cheap to
+    // copy and to dereference)
 
     iteratorROI                             begin_ROI(const int& maxNumberOfCirculations = 1);
     iteratorROI                             end_ROI();
@@ -172,6 +185,35 @@ inline blImage3<blDataType>::blImage3(const blImage3<blDataType>& image3) : blIm
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage3<blDataType>::blImage3(blImage3<blDataType>&& image3)noexcept
+                                      : blImage2<blDataType>(std::move(image3))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage3<blDataType>& blImage3<blDataType>::operator=(const blImage3<blDataType>& image3)
+{
+    blImage2<blDataType>::operator=(image3);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage3<blDataType>& blImage3<blDataType>::operator=(blImage3<blDataType>&& image3)noexcept
+{
+    blImage2<blDataType>::operator=(std::move(image3));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 inline void blImage3<blDataType>::wrap(const blImage3<blDataType>& srcImage)
@@ -525,287 +567,19 @@ inline bool blImage3<blDataType>::clone(const IplImage* imageToClone,
 
     this->setROIinCaseItIsNotSet();
 
-    // First we check
-    // if the number
-    // of channels match
-
-    if(this->getNumOfChannels() == imageToClone->nChannels)
-    {
-        // In this case,
-        // we know that
-        // the number of
-        // channels match,
-        // but that the
-        // depths are different,
-        // so we use the
-        // convertScale
-        // function to
-        // convert the image
-        // to the correct depth
-
-        convertScale(imageToClone,(*this));
-
-        // We're done
-
-        return true;
-    }
-
-    // By now, we know
-    // that the number
-    // of channels don't
-    // match, so we have
-    // to do some extra
-    // work to convert
-    // the image
-
-    // First we get the scale/shift
-    // parameters
-
-    double scale = 1;
-    double shift = 0;
-
-    getScaleShiftConversionParameters(imageToClone->depth,this->getDepth(),scale,shift);
-
-    // There are many cases:
-
-    // Case 1:  - imageToClone has 2 channels
-    //          - this image has 1 channel
-
-    if(this->getNumOfChannels() == 1 && imageToClone->nChannels == 2)
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom2ChannelsTo1Channel(imageToClone,
-                                               i,j,
-                                               this->getImagePtr(),
-                                               i,j,
-                                               scale,
-                                               shift,
-                                               inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 2:  - imageToClone has 2 channels
-    //          - this image has 3 channels
-
-    if(this->getNumOfChannels() == 3 && imageToClone->nChannels == 2)
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom2ChannelsTo3Channels(imageToClone,
-                                                i,j,
-                                                this->getImagePtr(),
-                                                i,j,
-                                                scale,
-                                                shift,
-                                                inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 3:  - imageToClone has 2 channels
-    //          - this image has 4 channels
-
-    if(this->getNumOfChannels() == 4 && imageToClone->nChannels == 2)
-    {
-        double alphaValue = rangeMax(this->getDepth());
-
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom2ChannelsTo4Channels(imageToClone,
-                                                i,j,
-                                                this->getImagePtr(),
-                                                i,j,
-                                                scale,
-                                                shift,
-                                                inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2,
-                                                alphaValue);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 4:  - imageToClone has 3 or 4 channels
-    //          - this image has 1 channels
-
-    if(this->getNumOfChannels() == 1 && (imageToClone->nChannels == 3 || imageToClone->nChannels == 4))
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom3or4ChannelsTo1Channel(imageToClone,
-                                                  i,j,
-                                                  this->getImagePtr(),
-                                                  i,j,
-                                                  scale,
-                                                  shift);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 5:  - imageToClone has 3 or 4 channels
-    //          - this image has 2 channels
-
-    if(this->getNumOfChannels() == 2 && (imageToClone->nChannels == 3 || imageToClone->nChannels == 4))
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom3or4ChannelsTo2Channels(imageToClone,
-                                                   i,j,
-                                                   this->getImagePtr(),
-                                                   i,j,
-                                                   scale,
-                                                   shift);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 6:  - imageToClone has 4 channels
-    //          - this image has 3 channels
-
-    if(this->getNumOfChannels() == 3 && imageToClone->nChannels == 4)
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom4ChannelsTo3Channels(imageToClone,
-                                                i,j,
-                                                this->getImagePtr(),
-                                                i,j,
-                                                scale,
-                                                shift);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 7:  - imageToClone has 3 channels
-    //          - this image has 4 channels
-
-    if(this->getNumOfChannels() == 4 && imageToClone->nChannels == 3)
-    {
-        double alphaValue = rangeMax(this->getDepth());
-
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom3ChannelsTo4Channels(imageToClone,
-                                                i,j,
-                                                this->getImagePtr(),
-                                                i,j,
-                                                scale,
-                                                shift,
-                                                alphaValue);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 8:  - imageToClone has 1 channel
-    //          - this image has 2 channels
-
-    if(this->getNumOfChannels() == 2 && imageToClone->nChannels == 1)
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom1ChannelTo2Channels(imageToClone,
-                                               i,j,
-                                               this->getImagePtr(),
-                                               i,j,
-                                               scale,
-                                               shift);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 9:  - imageToClone has 1 channel
-    //          - this image has 3 channels
-
-    if(this->getNumOfChannels() == 3 && imageToClone->nChannels == 1)
-    {
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom1ChannelTo3Channels(imageToClone,
-                                               i,j,
-                                               this->getImagePtr(),
-                                               i,j,
-                                               scale,
-                                               shift);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // Case 10: - imageToClone has 1 channel
-    //          - this image has 4 channels
-
-    if(this->getNumOfChannels() == 4 && imageToClone->nChannels == 1)
-    {
-        double alphaValue = rangeMax(this->getDepth());
-
-        for(int i = 0; i < imageToClone->height; ++i)
-        {
-            for(int j = 0; j < imageToClone->width; ++j)
-            {
-                convertFrom1ChannelTo4Channels(imageToClone,
-                                               i,j,
-                                               this->getImagePtr(),
-                                               i,j,
-                                               scale,
-                                               shift,
-                                               alphaValue);
-            }
-        }
-
-        // We're done
-        return true;
-    }
-
-    // If we got here, it's because
-    // we encountered a case that
-    // we did not originally think of.
-    // So we simply return false
-
-    return false;
+    // Finally we convert the
+    // image, the conversion engine
+    // resolves the depths and the
+    // channel mapping only once and
+    // then converts bands of rows
+    // in parallel
+    // NOTE:  It returns false for
+    //        cases we did not
+    //        originally think of
+
+    return convertImage(imageToClone,
+                        this->getImagePtr(),
+                        inCaseOfComplexToRealConversionDoYouWantReal_0_Imaginary_1_OrAbsoluteValue_2);
 }
 //-------------------------------------------------------------------
 
@@ -814,7 +588,7 @@ inline bool blImage3<blDataType>::clone(const IplImage* imageToClone,
 template<typename blDataType>
 inline typename blImage3<blDataType>::iteratorROI blImage3<blDataType>::begin_ROI(const int& maxNumberOfCirculations)
 {
-    return iteratorROI(*this,0,maxNumberOfCirculations);
+    return iteratorROI(this->getRowsROI(),0,maxNumberOfCirculations);
 }
 //-------------------------------------------------------------------
 
@@ -823,7 +597,13 @@ inline typename blImage3<blDataType>::iteratorROI blImage3<blDataType>::begin_RO
 template<typename blDataType>
 inline typename blImage3<blDataType>::iteratorROI blImage3<blDataType>::end_ROI()
 {
-    return iteratorROI(*this,this->sizeROI(),0);
+    // The end iterator is past
+    // the end from the start
+    // (zero circulations allowed)
+    // and sits sizeROI elements
+    // from the beginning
+
+    return ( iteratorROI(this->getRowsROI(),0,0) + ptrdiff_t(this->sizeROI()) );
 }
 //-------------------------------------------------------------------
 
@@ -832,7 +612,7 @@ inline typename blImage3<blDataType>::iteratorROI blImage3<blDataType>::end_ROI(
 template<typename blDataType>
 inline typename blImage3<blDataType>::const_iteratorROI blImage3<blDataType>::cbegin_ROI(const int& maxNumberOfCirculations)const
 {
-    return const_iteratorROI(*this,0,maxNumberOfCirculations);
+    return const_iteratorROI(this->getRowsROI(),0,maxNumberOfCirculations);
 }
 //-------------------------------------------------------------------
 
@@ -841,7 +621,7 @@ inline typename blImage3<blDataType>::const_iteratorROI blImage3<blDataType>::cb
 template<typename blDataType>
 inline typename blImage3<blDataType>::const_iteratorROI blImage3<blDataType>::cend_ROI()const
 {
-    return const_iteratorROI(*this,this->sizeROI(),0);
+    return ( const_iteratorROI(this->getRowsROI(),0,0) + ptrdiff_t(this->sizeROI()) );
 }
 //-------------------------------------------------------------------
 
@@ -851,7 +631,7 @@ template<typename blDataType>
 inline typename blImage3<blDataType>::iteratorROI blImage3<blDataType>::getIterROI(const int& startingElementIndex,
                                                                                    const int& maxNumberOfCirculations)
 {
-    return iteratorROI(*this,startingElementIndex,maxNumberOfCirculations);
+    return iteratorROI(this->getRowsROI(),startingElementIndex,maxNumberOfCirculations);
 }
 //-------------------------------------------------------------------
 
@@ -861,7 +641,7 @@ template<typename blDataType>
 inline typename blImage3<blDataType>::const_iteratorROI blImage3<blDataType>::getConstIterROI(const int& startingElementIndex,
                                                                                               const int& maxNumberOfCirculations)const
 {
-    return const_iteratorROI(*this,startingElementIndex,maxNumberOfCirculations);
+    return const_iteratorROI(this->getRowsROI(),startingElementIndex,maxNumberOfCirculations);
 }
 //-------------------------------------------------------------------
 
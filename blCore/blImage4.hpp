@@ -47,11 +47,19 @@ public: // Constructors and destructors
     // Copy constructor
     blImage4(const blImage4<blDataType>& Image4);
 
+    // Move constructor
+    blImage4(blImage4<blDataType>&& Image4)noexcept;
+
     // Destructor
     ~blImage4()
     {
     }
 
+public: // Assignment operators
+
+    blImage4<blDataType>&                   operator=(const blImage4<blDataType>& Image4);
+    blImage4<blDataType>&                   operator=(blImage4<blDataType>&& Image4)noexcept;
+
 public: // Public functions
 
     // Function used to load
@@ -84,6 +92,35 @@ inline blImage4<blDataType>::blImage4(const blImage4<blDataType>& Image4) : blIm
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage4<blDataType>::blImage4(blImage4<blDataType>&& Image4)noexcept
+                                      : blImage3<blDataType>(std::move(Image4))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage4<blDataType>& blImage4<blDataType>::operator=(const blImage4<blDataType>& Image4)
+{
+    blImage3<blDataType>::operator=(Image4);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage4<blDataType>& blImage4<blDataType>::operator=(blImage4<blDataType>&& Image4)noexcept
+{
+    blImage3<blDataType>::operator=(std::move(Image4));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blType>
 inline bool blImage4<blType>::loadImageFromFile(const char* filename,
@@ -49,11 +49,19 @@ public: // Constructors and destructors
     // Copy constructor
     blImage5(const blImage5<blDataType>& Image5);
 
+    // Move constructor
+    blImage5(blImage5<blDataType>&& Image5)noexcept;
+
     // Destructor
     ~blImage5()
     {
     }
 
+public: // Assignment operators
+
+    blImage5<blDataType>&                   operator=(const blImage5<blDataType>& Image5);
+    blImage5<blDataType>&                   operator=(blImage5<blDataType>&& Image5)noexcept;
+
 public: // Public functions
 
     // Overload the wrap and
@@ -117,6 +125,35 @@ inline blImage5<blDataType>::blImage5(const blImage5<blDataType>& Image5) : blIm
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage5<blDataType>::blImage5(blImage5<blDataType>&& Image5)noexcept
+                                      : blImage4<blDataType>(std::move(Image5))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage5<blDataType>& blImage5<blDataType>::operator=(const blImage5<blDataType>& Image5)
+{
+    blImage4<blDataType>::operator=(Image5);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage5<blDataType>& blImage5<blDataType>::operator=(blImage5<blDataType>&& Image5)noexcept
+{
+    blImage4<blDataType>::operator=(std::move(Image5));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blDataType>
 template<int numOfDataPoints>
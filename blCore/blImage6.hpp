@@ -55,11 +55,19 @@ public: // Constructors and destructors
     // Copy constructor
     blImage6(const blImage6<blDataType>& Image6);
 
+    // Move constructor
+    blImage6(blImage6<blDataType>&& Image6)noexcept;
+
     // Destructor
     ~blImage6()
     {
     }
 
+public: // Assignment operators
+
+    blImage6<blDataType>&                   operator=(const blImage6<blDataType>& Image6);
+    blImage6<blDataType>&                   operator=(blImage6<blDataType>&& Image6)noexcept;
+
 public: // Public functions
 
     // Functions used to
@@ -176,6 +184,35 @@ inline blImage6<blDataType>::blImage6(const blImage6<blDataType>& Image6) : blIm
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage6<blDataType>::blImage6(blImage6<blDataType>&& Image6)noexcept
+                                      : blImage5<blDataType>(std::move(Image6))
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage6<blDataType>& blImage6<blDataType>::operator=(const blImage6<blDataType>& Image6)
+{
+    blImage5<blDataType>::operator=(Image6);
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImage6<blDataType>& blImage6<blDataType>::operator=(blImage6<blDataType>&& Image6)noexcept
+{
+    blImage5<blDataType>::operator=(std::move(Image6));
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 // Define the basic
 // arithmetic functions
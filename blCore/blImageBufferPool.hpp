@@ -0,0 +1,513 @@
+#ifndef BL_IMAGEBUFFERPOOL_HPP
+#define BL_IMAGEBUFFERPOOL_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageBufferPool.hpp
+// CLASS:           blImageBufferPool
+// BASE CLASS:      None
+//
+// PURPOSE:         A thread-safe pool of IplImage buffers bucketed
+//                  by size, depth and number of channels, used to
+//                  avoid the cvCreateImage/cvReleaseImage pair every
+//                  time a blImage of a commonly used size is created
+//                  and released
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    IplImage -- Image structure from opencv
+//                  cvCreateImage -- To create new images
+//                  cvReleaseImage -- To release images
+//                  std::mutex -- To make the pool thread-safe
+//                  std::atomic -- To check whether the pool is
+//                                 enabled without locking it
+//                  std::map -- To hold the image buckets
+//
+// NOTES:           - The pool is disabled by default, in which case
+//                    blImage2::create behaves exactly as before
+//                    (the enabled flag is atomic, so checking it
+//                    doesn't take the pool's lock)
+//
+//                  - Once enabled, blImage2::create (and therefore
+//                    clone and the blImage constructors) takes its
+//                    buffers from the pool, and the shared_ptr deleter
+//                    (releaseImageToPool) gives them back
+//
+//                  - The pool object is never destroyed so that
+//                    images released during static destruction can
+//                    still be safely handed back to it
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blImageBufferPool
+{
+public: // Public typedefs
+
+    // Key used to bucket the
+    // images (width,height,depth,
+    // number of channels)
+
+    typedef std::tuple<int,int,int,int>     blBucketKey;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageBufferPool();
+
+    // Destructor
+
+    ~blImageBufferPool()
+    {
+        clear();
+    }
+
+private: // The pool cannot be copied
+
+    blImageBufferPool(const blImageBufferPool& pool);
+    blImageBufferPool&                      operator=(const blImageBufferPool& pool);
+
+public: // Public functions
+
+    // Function used to get
+    // the global pool used
+    // by blImage2::create
+
+    static blImageBufferPool&               getInstance();
+
+    // Functions used to enable/disable
+    // the pool (It's disabled by default)
+
+    void                                    setEnabled(const bool& isPoolEnabled);
+    bool                                    isEnabled()const;
+
+    // Functions used to set/get the
+    // limits of the pool, beyond which
+    // returned images are released
+    // instead of being cached
+
+    void                                    setMaxNumOfImagesPerBucket(const int& maxNumOfImagesPerBucket);
+    int                                     getMaxNumOfImagesPerBucket()const;
+
+    void                                    setMaxPoolSizeInBytes(const long long& maxPoolSizeInBytes);
+    long long                               getMaxPoolSizeInBytes()const;
+
+    // Function used to get an image
+    // from the pool, if the pool has
+    // no image of the requested size
+    // a new one is created
+
+    IplImage*                               acquireImage(const CvSize& size,
+                                                         const int& depth,
+                                                         const int& numOfChannels);
+
+    // Function used to give an
+    // image back to the pool (if the
+    // pool is full or disabled, the
+    // image is simply released)
+
+    void                                    recycleImage(IplImage* image);
+
+    // Function used to release
+    // every image cached in the pool
+
+    void                                    clear();
+
+    // Functions used to get the
+    // pool statistics used to size
+    // the pool for a given load
+
+    long long                               getNumOfHits()const;
+    long long                               getNumOfMisses()const;
+    long long                               getNumOfRecycledImages()const;
+    long long                               getNumOfDiscardedImages()const;
+    double                                  getHitRate()const;
+
+    int                                     getNumOfCachedImages()const;
+    long long                               getCachedSizeInBytes()const;
+    int                                     getNumOfBuckets()const;
+
+    void                                    resetStatistics();
+
+private: // Private variables
+
+    // Mutex protecting the
+    // buckets and statistics
+
+    mutable std::mutex                      m_mutex;
+
+    // The cached images
+    // bucketed by size
+
+    std::map< blBucketKey,std::vector<IplImage*> >  m_buckets;
+
+    // Pool settings (the enabled
+    // flag is read without the lock)
+
+    std::atomic<bool>                       m_isEnabled;
+    int                                     m_maxNumOfImagesPerBucket;
+    long long                               m_maxPoolSizeInBytes;
+
+    // Pool statistics
+
+    long long                               m_numOfHits;
+    long long                               m_numOfMisses;
+    long long                               m_numOfRecycledImages;
+    long long                               m_numOfDiscardedImages;
+
+    int                                     m_numOfCachedImages;
+    long long                               m_cachedSizeInBytes;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functor used with shared_ptr to
+// give an IplImage back to the global
+// image buffer pool instead of
+// releasing it
+//-------------------------------------------------------------------
+class releaseImageToPool
+{
+public:
+
+    // Overloaded operator
+    // used to give an IplImage
+    // back to the pool
+
+    void operator()(IplImage*& img)
+    {
+        // Check if we have
+        // an image
+
+        if(!img)
+            return;
+
+        // Give it back to the pool
+
+        blImageBufferPool::getInstance().recycleImage(img);
+
+        // Nullify the pointer
+
+        img = NULL;
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blImageBufferPool::blImageBufferPool()
+{
+    m_isEnabled = false;
+    m_maxNumOfImagesPerBucket = 8;
+    m_maxPoolSizeInBytes = 256LL * 1024LL * 1024LL;
+
+    m_numOfHits = 0;
+    m_numOfMisses = 0;
+    m_numOfRecycledImages = 0;
+    m_numOfDiscardedImages = 0;
+
+    m_numOfCachedImages = 0;
+    m_cachedSizeInBytes = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blImageBufferPool& blImageBufferPool::getInstance()
+{
+    // The pool is purposely never
+    // deleted, so that images released
+    // during static destruction can
+    // still be recycled safely
+
+    static blImageBufferPool* pool = new blImageBufferPool();
+
+    return (*pool);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::setEnabled(const bool& isPoolEnabled)
+{
+    m_isEnabled = isPoolEnabled;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blImageBufferPool::isEnabled()const
+{
+    return m_isEnabled;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::setMaxNumOfImagesPerBucket(const int& maxNumOfImagesPerBucket)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_maxNumOfImagesPerBucket = std::max(0,maxNumOfImagesPerBucket);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blImageBufferPool::getMaxNumOfImagesPerBucket()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_maxNumOfImagesPerBucket;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::setMaxPoolSizeInBytes(const long long& maxPoolSizeInBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_maxPoolSizeInBytes = std::max(0LL,maxPoolSizeInBytes);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getMaxPoolSizeInBytes()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_maxPoolSizeInBytes;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline IplImage* blImageBufferPool::acquireImage(const CvSize& size,
+                                                 const int& depth,
+                                                 const int& numOfChannels)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_isEnabled)
+        {
+            auto bucket = m_buckets.find(blBucketKey(size.width,size.height,depth,numOfChannels));
+
+            if(bucket != m_buckets.end() && !bucket->second.empty())
+            {
+                // We have a cached image
+                // of the correct size, so
+                // we hand it out
+
+                IplImage* cachedImage = bucket->second.back();
+                bucket->second.pop_back();
+
+                --m_numOfCachedImages;
+                m_cachedSizeInBytes -= cachedImage->imageSize;
+                ++m_numOfHits;
+
+                return cachedImage;
+            }
+
+            ++m_numOfMisses;
+        }
+    }
+
+    // If we got here, the pool didn't
+    // have the image we need, so we
+    // create a new one (outside the
+    // lock since it's the slow part)
+
+    return cvCreateImage(size,depth,numOfChannels);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::recycleImage(IplImage* image)
+{
+    if(!image)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_isEnabled &&
+           m_cachedSizeInBytes + image->imageSize <= m_maxPoolSizeInBytes)
+        {
+            auto& bucket = m_buckets[blBucketKey(image->width,image->height,image->depth,image->nChannels)];
+
+            if(int(bucket.size()) < m_maxNumOfImagesPerBucket)
+            {
+                bucket.push_back(image);
+
+                ++m_numOfCachedImages;
+                m_cachedSizeInBytes += image->imageSize;
+                ++m_numOfRecycledImages;
+
+                return;
+            }
+        }
+
+        ++m_numOfDiscardedImages;
+    }
+
+    // The pool is either full or
+    // disabled, so we just release
+    // the image
+
+    cvReleaseImage(&image);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::clear()
+{
+    // We move the cached images out
+    // of the pool and release them
+    // outside of the lock
+
+    std::map< blBucketKey,std::vector<IplImage*> > bucketsToRelease;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        bucketsToRelease.swap(m_buckets);
+
+        m_numOfCachedImages = 0;
+        m_cachedSizeInBytes = 0;
+    }
+
+    for(auto bucket = bucketsToRelease.begin(); bucket != bucketsToRelease.end(); ++bucket)
+    {
+        for(auto image = bucket->second.begin(); image != bucket->second.end(); ++image)
+        {
+            cvReleaseImage(&(*image));
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getNumOfHits()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfHits;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getNumOfMisses()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfMisses;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getNumOfRecycledImages()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfRecycledImages;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getNumOfDiscardedImages()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfDiscardedImages;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline double blImageBufferPool::getHitRate()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(m_numOfHits + m_numOfMisses == 0)
+        return 0.0;
+
+    return double(m_numOfHits) / double(m_numOfHits + m_numOfMisses);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blImageBufferPool::getNumOfCachedImages()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfCachedImages;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageBufferPool::getCachedSizeInBytes()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_cachedSizeInBytes;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blImageBufferPool::getNumOfBuckets()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return int(m_buckets.size());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageBufferPool::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_numOfHits = 0;
+    m_numOfMisses = 0;
+    m_numOfRecycledImages = 0;
+    m_numOfDiscardedImages = 0;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEBUFFERPOOL_HPP
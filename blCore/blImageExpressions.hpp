@@ -0,0 +1,652 @@
+#ifndef BL_IMAGEEXPRESSIONS_HPP
+#define BL_IMAGEEXPRESSIONS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageExpressions.hpp
+// CLASS:           blImageExpression
+// BASE CLASS:      None
+//
+// PURPOSE:         - A small set of lazy expression templates used
+//                    to evaluate per-element image arithmetic such as
+//                    lazy(img1) * 2.0 + img2 - lazy(img3) / 3.0 in one
+//                    single pass without creating any temporary
+//                    images
+//                  - The expression is only evaluated when it's
+//                    assigned to a blImage, used to construct a
+//                    blImage or passed to the evaluate function
+//                  - Each operand is read over its own ROI, and the
+//                    size of a binary expression is the smallest of
+//                    its operands (just like the eager operators)
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImage and its dependencies
+//
+// NOTES:           - Expressions only keep references to their
+//                    operand images, so they should be evaluated
+//                    within the same statement they are built in
+//                    (don't save them into "auto" variables)
+//                  - A plain image added to or subtracted from an
+//                    expression is captured automatically, while a
+//                    plain image scaled by a scalar (img3 / 3.0) is
+//                    still evaluated eagerly unless wrapped by lazy()
+//                  - Only image+image, image-image and additions,
+//                    subtractions, multiplications and divisions
+//                    with scalars are captured, the product of two
+//                    images remains the eager matrix product
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functors define the
+// per-element operations captured
+// by the expressions
+//-------------------------------------------------------------------
+struct blExpressionAdd
+{
+    template<typename blDataType,typename blDataType2>
+    static inline auto apply(const blDataType& value1,const blDataType2& value2) -> decltype(value1 + value2)
+    {
+        return ( value1 + value2 );
+    }
+};
+
+
+struct blExpressionSubtract
+{
+    template<typename blDataType,typename blDataType2>
+    static inline auto apply(const blDataType& value1,const blDataType2& value2) -> decltype(value1 - value2)
+    {
+        return ( value1 - value2 );
+    }
+};
+
+
+struct blExpressionMultiply
+{
+    template<typename blDataType,typename blDataType2>
+    static inline auto apply(const blDataType& value1,const blDataType2& value2) -> decltype(value1 * value2)
+    {
+        return ( value1 * value2 );
+    }
+};
+
+
+struct blExpressionDivide
+{
+    template<typename blDataType,typename blDataType2>
+    static inline auto apply(const blDataType& value1,const blDataType2& value2) -> decltype(value1 / value2)
+    {
+        return ( value1 / value2 );
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The expression leaf, which points
+// to the ROI of an image without
+// copying or sharing its data
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageExpressionLeaf
+{
+public: // Public typedefs
+
+    typedef blDataType                          value_type;
+
+public: // Constructors and destructors
+
+    blImageExpressionLeaf(const blImage<blDataType>& image)
+    {
+        if(image.empty())
+        {
+            m_image = NULL;
+            m_ROIdata = NULL;
+            m_widthStep = 0;
+            m_rows = 0;
+            m_cols = 0;
+        }
+        else
+        {
+            m_image = image.getImagePtr();
+            m_ROIdata = reinterpret_cast<const char*>(&image[image.yROI()][image.xROI()]);
+            m_widthStep = image.getWidthStep();
+            m_rows = image.size1ROI();
+            m_cols = image.size2ROI();
+        }
+    }
+
+public: // Public functions
+
+    int                                         size1()const{return m_rows;}
+    int                                         size2()const{return m_cols;}
+
+    // Function used to get
+    // the (i,j) element of
+    // the ROI (the row pointer
+    // computation is invariant
+    // in the column loop, so
+    // the compiler hoists it)
+
+    blDataType                                  operator()(const int& rowIndex,const int& colIndex)const
+    {
+        return reinterpret_cast<const blDataType*>(m_ROIdata + rowIndex * m_widthStep)[colIndex];
+    }
+
+    // Function used to check
+    // whether writing into the
+    // specified destination
+    // while reading from this
+    // leaf would overwrite
+    // data before it's read
+
+    bool                                        isAliasedWith(const IplImage* dstImage,const char* dstROIdata)const
+    {
+        return ( m_image != NULL && m_image == dstImage && m_ROIdata != dstROIdata );
+    }
+
+private: // Private variables
+
+    const IplImage*                             m_image;
+    const char*                                 m_ROIdata;
+    int                                         m_widthStep;
+    int                                         m_rows;
+    int                                         m_cols;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The expression node combining
+// two expressions per-element
+//-------------------------------------------------------------------
+template<typename blLeftNodeType,typename blRightNodeType,typename blOperationType>
+class blImageExpressionBinaryNode
+{
+public: // Public typedefs
+
+    typedef typename blLeftNodeType::value_type value_type;
+
+public: // Constructors and destructors
+
+    blImageExpressionBinaryNode(const blLeftNodeType& leftNode,
+                                const blRightNodeType& rightNode)
+                                : m_leftNode(leftNode),
+                                  m_rightNode(rightNode)
+    {
+    }
+
+public: // Public functions
+
+    int                                         size1()const{return std::min(m_leftNode.size1(),m_rightNode.size1());}
+    int                                         size2()const{return std::min(m_leftNode.size2(),m_rightNode.size2());}
+
+    value_type                                  operator()(const int& rowIndex,const int& colIndex)const
+    {
+        return value_type(blOperationType::apply(m_leftNode(rowIndex,colIndex),
+                                                 m_rightNode(rowIndex,colIndex)));
+    }
+
+    bool                                        isAliasedWith(const IplImage* dstImage,const char* dstROIdata)const
+    {
+        return ( m_leftNode.isAliasedWith(dstImage,dstROIdata) ||
+                 m_rightNode.isAliasedWith(dstImage,dstROIdata) );
+    }
+
+private: // Private variables
+
+    blLeftNodeType                              m_leftNode;
+    blRightNodeType                             m_rightNode;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The expression node combining an
+// expression with a scalar, where the
+// scalar can be on either side
+//-------------------------------------------------------------------
+template<typename blNodeType,typename blScalarType,typename blOperationType,bool isScalarOnTheLeft>
+class blImageExpressionScalarNode
+{
+public: // Public typedefs
+
+    typedef typename blNodeType::value_type     value_type;
+
+public: // Constructors and destructors
+
+    blImageExpressionScalarNode(const blNodeType& node,
+                                const blScalarType& scalar)
+                                : m_node(node),
+                                  m_scalar(scalar)
+    {
+    }
+
+public: // Public functions
+
+    int                                         size1()const{return m_node.size1();}
+    int                                         size2()const{return m_node.size2();}
+
+    value_type                                  operator()(const int& rowIndex,const int& colIndex)const
+    {
+        if(isScalarOnTheLeft)
+            return value_type(blOperationType::apply(m_scalar,m_node(rowIndex,colIndex)));
+        else
+            return value_type(blOperationType::apply(m_node(rowIndex,colIndex),m_scalar));
+    }
+
+    bool                                        isAliasedWith(const IplImage* dstImage,const char* dstROIdata)const
+    {
+        return m_node.isAliasedWith(dstImage,dstROIdata);
+    }
+
+private: // Private variables
+
+    blNodeType                                  m_node;
+    blScalarType                                m_scalar;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The expression node negating
+// an expression
+//-------------------------------------------------------------------
+template<typename blNodeType>
+class blImageExpressionNegateNode
+{
+public: // Public typedefs
+
+    typedef typename blNodeType::value_type     value_type;
+
+public: // Constructors and destructors
+
+    blImageExpressionNegateNode(const blNodeType& node)
+                                : m_node(node)
+    {
+    }
+
+public: // Public functions
+
+    int                                         size1()const{return m_node.size1();}
+    int                                         size2()const{return m_node.size2();}
+
+    value_type                                  operator()(const int& rowIndex,const int& colIndex)const
+    {
+        return value_type(-m_node(rowIndex,colIndex));
+    }
+
+    bool                                        isAliasedWith(const IplImage* dstImage,const char* dstROIdata)const
+    {
+        return m_node.isAliasedWith(dstImage,dstROIdata);
+    }
+
+private: // Private variables
+
+    blNodeType                                  m_node;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The expression wrapper, every
+// operator below takes and returns
+// this type, so that the overloads
+// are always more specialized than
+// the eager "image op dataPoint"
+// operators in blImageOperators.hpp
+//-------------------------------------------------------------------
+template<typename blNodeType>
+class blImageExpression
+{
+public: // Public typedefs
+
+    typedef typename blNodeType::value_type     value_type;
+    typedef blNodeType                          node_type;
+
+public: // Constructors and destructors
+
+    explicit blImageExpression(const blNodeType& node)
+                               : m_node(node)
+    {
+    }
+
+public: // Public functions
+
+    // Size of the expression
+    // (rows and cols)
+
+    int                                         size1()const{return m_node.size1();}
+    int                                         size2()const{return m_node.size2();}
+
+    const blNodeType&                           node()const{return m_node;}
+
+    value_type                                  operator()(const int& rowIndex,const int& colIndex)const
+    {
+        return m_node(rowIndex,colIndex);
+    }
+
+    bool                                        isAliasedWith(const IplImage* dstImage,const char* dstROIdata)const
+    {
+        return m_node.isAliasedWith(dstImage,dstROIdata);
+    }
+
+private: // Private variables
+
+    blNodeType                                  m_node;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to start
+// a lazy expression from
+// an image
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImageExpression< blImageExpressionLeaf<blDataType> > lazy(const blImage<blDataType>& image)
+{
+    return blImageExpression< blImageExpressionLeaf<blDataType> >(blImageExpressionLeaf<blDataType>(image));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to evaluate an
+// expression straight into the
+// ROI of an existing destination
+// image in one single pass
+// - If the destination ROI is not
+//   the same size as the expression,
+//   the destination is recreated to
+//   the expression's size (the new
+//   image is evaluated first and only
+//   then replaces the destination,
+//   since the destination could be
+//   an operand, bigger than the
+//   expression, whose buffer would
+//   otherwise be released before
+//   being read)
+// - If the destination is also one
+//   of the operands at a different
+//   offset, we evaluate into a
+//   temporary first to avoid
+//   overwriting data before it's read
+//-------------------------------------------------------------------
+template<typename blNodeType,typename blDataType>
+
+inline void evaluate(const blImageExpression<blNodeType>& expression,
+                     blImage<blDataType>& dstImage)
+{
+    int rows = expression.size1();
+    int cols = expression.size2();
+
+    if(dstImage.empty() ||
+       dstImage.size1ROI() != rows ||
+       dstImage.size2ROI() != cols)
+    {
+        // We create a brand new
+        // image, since create would
+        // otherwise reuse a same-sized
+        // buffer that an operand
+        // might be pointing to
+
+        blImage<blDataType> newDstImage(rows,cols);
+
+        if(rows > 0 && cols > 0)
+            evaluate(expression,newDstImage);
+
+        dstImage = std::move(newDstImage);
+
+        return;
+    }
+
+    if(rows <= 0 || cols <= 0)
+        return;
+
+    char* dstROIdata = reinterpret_cast<char*>(&dstImage[dstImage.yROI()][dstImage.xROI()]);
+    int dstWidthStep = dstImage.getWidthStep();
+
+    if(expression.isAliasedWith(dstImage.getImagePtr(),dstROIdata))
+    {
+        blImage<blDataType> tempImage(rows,cols);
+        evaluate(expression,tempImage);
+
+        for(int i = 0; i < rows; ++i)
+            std::copy(tempImage[i],tempImage[i] + cols,reinterpret_cast<blDataType*>(dstROIdata + i * dstWidthStep));
+
+        return;
+    }
+
+    // Single pass over the
+    // destination ROI, row by row
+
+    for(int i = 0; i < rows; ++i)
+    {
+        blDataType* dstRow = reinterpret_cast<blDataType*>(dstROIdata + i * dstWidthStep);
+
+        for(int j = 0; j < cols; ++j)
+            dstRow[j] = blDataType(expression(i,j));
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following operators build the
+// expression trees (expression with
+// expression, expression with image
+// and expression with scalar)
+//-------------------------------------------------------------------
+template<typename blNodeType1,typename blNodeType2>
+
+inline blImageExpression< blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionAdd> > operator+(const blImageExpression<blNodeType1>& expression1,
+                                                                                                            const blImageExpression<blNodeType2>& expression2)
+{
+    return blImageExpression< blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionAdd> >(blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionAdd>(expression1.node(),expression2.node()));
+}
+
+
+template<typename blNodeType1,typename blNodeType2>
+
+inline blImageExpression< blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionSubtract> > operator-(const blImageExpression<blNodeType1>& expression1,
+                                                                                                                 const blImageExpression<blNodeType2>& expression2)
+{
+    return blImageExpression< blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionSubtract> >(blImageExpressionBinaryNode<blNodeType1,blNodeType2,blExpressionSubtract>(expression1.node(),expression2.node()));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blNodeType,typename blDataType>
+
+inline auto operator+(const blImageExpression<blNodeType>& expression,
+                      const blImage<blDataType>& image) -> decltype(expression + lazy(image))
+{
+    return ( expression + lazy(image) );
+}
+
+
+template<typename blDataType,typename blNodeType>
+
+inline auto operator+(const blImage<blDataType>& image,
+                      const blImageExpression<blNodeType>& expression) -> decltype(lazy(image) + expression)
+{
+    return ( lazy(image) + expression );
+}
+
+
+template<typename blNodeType,typename blDataType>
+
+inline auto operator-(const blImageExpression<blNodeType>& expression,
+                      const blImage<blDataType>& image) -> decltype(expression - lazy(image))
+{
+    return ( expression - lazy(image) );
+}
+
+
+template<typename blDataType,typename blNodeType>
+
+inline auto operator-(const blImage<blDataType>& image,
+                      const blImageExpression<blNodeType>& expression) -> decltype(lazy(image) - expression)
+{
+    return ( lazy(image) - expression );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blNodeType,typename blScalarType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,false> > operator+(const blImageExpression<blNodeType>& expression,
+                                                                                                                  const blScalarType& scalar)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,false> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,false>(expression.node(),scalar));
+}
+
+
+template<typename blScalarType,typename blNodeType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,true> > operator+(const blScalarType& scalar,
+                                                                                                                 const blImageExpression<blNodeType>& expression)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,true> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionAdd,true>(expression.node(),scalar));
+}
+
+
+template<typename blNodeType,typename blScalarType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,false> > operator-(const blImageExpression<blNodeType>& expression,
+                                                                                                                       const blScalarType& scalar)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,false> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,false>(expression.node(),scalar));
+}
+
+
+template<typename blScalarType,typename blNodeType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,true> > operator-(const blScalarType& scalar,
+                                                                                                                      const blImageExpression<blNodeType>& expression)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,true> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionSubtract,true>(expression.node(),scalar));
+}
+
+
+template<typename blNodeType,typename blScalarType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,false> > operator*(const blImageExpression<blNodeType>& expression,
+                                                                                                                       const blScalarType& scalar)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,false> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,false>(expression.node(),scalar));
+}
+
+
+template<typename blScalarType,typename blNodeType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,true> > operator*(const blScalarType& scalar,
+                                                                                                                      const blImageExpression<blNodeType>& expression)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,true> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionMultiply,true>(expression.node(),scalar));
+}
+
+
+template<typename blNodeType,typename blScalarType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,false> > operator/(const blImageExpression<blNodeType>& expression,
+                                                                                                                     const blScalarType& scalar)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,false> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,false>(expression.node(),scalar));
+}
+
+
+template<typename blScalarType,typename blNodeType>
+
+inline blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,true> > operator/(const blScalarType& scalar,
+                                                                                                                    const blImageExpression<blNodeType>& expression)
+{
+    return blImageExpression< blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,true> >(blImageExpressionScalarNode<blNodeType,blScalarType,blExpressionDivide,true>(expression.node(),scalar));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blNodeType>
+
+inline blImageExpression< blImageExpressionNegateNode<blNodeType> > operator-(const blImageExpression<blNodeType>& expression)
+{
+    return blImageExpression< blImageExpressionNegateNode<blNodeType> >(blImageExpressionNegateNode<blNodeType>(expression.node()));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Definitions of the blImage constructor
+// and assignment operator from an
+// expression (declared in blImage.hpp)
+//-------------------------------------------------------------------
+template<typename blDataType>
+template<typename blNodeType>
+inline blImage<blDataType>::blImage(const blImageExpression<blNodeType>& expression)
+                                    : blImage6<blDataType>()
+{
+    evaluate(expression,*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+template<typename blNodeType>
+inline blImage<blDataType>& blImage<blDataType>::operator=(const blImageExpression<blNodeType>& expression)
+{
+    // Just like the eager operators,
+    // the result is a new image of
+    // the expression's size, but we
+    // write straight into the current
+    // image data when it's the right
+    // size and nobody else shares it
+
+    if(!this->empty() &&
+       this->m_imageSharedPtr.use_count() == 1 &&
+       this->size1() == expression.size1() &&
+       this->size2() == expression.size2())
+    {
+        this->resetROI();
+        evaluate(expression,*this);
+    }
+    else
+    {
+        blImage<blDataType> result(expression.size1(),expression.size2());
+        evaluate(expression,result);
+        (*this) = std::move(result);
+    }
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEEXPRESSIONS_HPP
@@ -260,78 +260,12 @@ inline std::istream& operator>>(std::istream& is,blImage<blDataType>& img)
 
 
 //-------------------------------------------------------------------
-// The following functions are used to
-// define what we mean by minimum and
-// maximum when dealing with any type of
-// image, including images of multiple
-// channels
+// The following functions find the
+// minimum of an image ROI (using the
+// single pass reduction engine in
+// blImageStatistics.hpp) and the
+// per-element minimum of two images
 //-------------------------------------------------------------------
-template<typename blDataType>
-inline void min(const blDataType& value1,
-                const blDataType& value2,
-                blDataType& minValue)
-{
-    minValue = std::min(value1,value2);
-}
-
-
-template<typename blDataType>
-inline void min(const std::complex< blDataType >& value1,
-                const std::complex< blDataType >& value2,
-                std::complex< blDataType >& minValue)
-{
-    minValue.real(std::min(value1.real(),value2.real()));
-    minValue.imag(std::min(value1.imag(),value2.imag()));
-}
-
-
-inline void min(const CvPoint& value1,
-                const CvPoint& value2,
-                CvPoint& minValue)
-{
-    minValue.x = std::min(value1.x,value2.x);
-    minValue.y = std::min(value1.y,value2.y);
-}
-
-
-inline void min(const CvPoint2D32f& value1,
-                const CvPoint2D32f& value2,
-                CvPoint2D32f& minValue)
-{
-    minValue.x = std::min(value1.x,value2.x);
-    minValue.y = std::min(value1.y,value2.y);
-}
-
-
-inline void min(const CvPoint2D64f& value1,
-                const CvPoint2D64f& value2,
-                CvPoint2D64f& minValue)
-{
-    minValue.x = std::min(value1.x,value2.x);
-    minValue.y = std::min(value1.y,value2.y);
-}
-
-
-inline void min(const CvPoint3D32f& value1,
-                const CvPoint3D32f& value2,
-                CvPoint3D32f& minValue)
-{
-    minValue.x = std::min(value1.x,value2.x);
-    minValue.y = std::min(value1.y,value2.y);
-    minValue.z = std::min(value1.z,value2.z);
-}
-
-
-inline void min(const CvPoint3D64f& value1,
-                const CvPoint3D64f& value2,
-                CvPoint3D64f& minValue)
-{
-    minValue.x = std::min(value1.x,value2.x);
-    minValue.y = std::min(value1.y,value2.y);
-    minValue.z = std::min(value1.z,value2.z);
-}
-
-
 template<typename blDataType>
 inline void min(const blImage<blDataType>& img,
                 blDataType& minValue)
@@ -339,21 +273,11 @@ inline void min(const blImage<blDataType>& img,
     if(img.sizeROI() <= 0)
         return;
 
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    blImageStatistics<blDataType> statistics;
 
-    minValue = img(yROI,xROI);
+    computeStatistics(img,statistics,BL_STATISTICS_MIN);
 
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            min(img(i,j),minValue,minValue);
-        }
-    }
+    minValue = statistics.m_min;
 }
 
 
@@ -393,72 +317,6 @@ inline void min(const blImage<blDataType>& img1,
 
 
 //-------------------------------------------------------------------
-template<typename blDataType>
-inline void max(const blDataType& value1,
-                const blDataType& value2,
-                blDataType& maxValue)
-{
-    maxValue = std::max(value1,value2);
-}
-
-
-template<typename blDataType>
-inline void max(const std::complex< blDataType >& value1,
-                const std::complex< blDataType >& value2,
-                std::complex< blDataType >& maxValue)
-{
-    maxValue.real(std::max(value1.real(),value2.real()));
-    maxValue.imag(std::max(value1.imag(),value2.imag()));
-}
-
-
-inline void max(const CvPoint& value1,
-                const CvPoint& value2,
-                CvPoint& maxValue)
-{
-    maxValue.x = std::max(value1.x,value2.x);
-    maxValue.y = std::max(value1.y,value2.y);
-}
-
-
-inline void max(const CvPoint2D32f& value1,
-                const CvPoint2D32f& value2,
-                CvPoint2D32f& maxValue)
-{
-    maxValue.x = std::max(value1.x,value2.x);
-    maxValue.y = std::max(value1.y,value2.y);
-}
-
-
-inline void max(const CvPoint2D64f& value1,
-                const CvPoint2D64f& value2,
-                CvPoint2D64f& maxValue)
-{
-    maxValue.x = std::max(value1.x,value2.x);
-    maxValue.y = std::max(value1.y,value2.y);
-}
-
-
-inline void max(const CvPoint3D32f& value1,
-                const CvPoint3D32f& value2,
-                CvPoint3D32f& maxValue)
-{
-    maxValue.x = std::max(value1.x,value2.x);
-    maxValue.y = std::max(value1.y,value2.y);
-    maxValue.z = std::max(value1.z,value2.z);
-}
-
-
-inline void max(const CvPoint3D64f& value1,
-                const CvPoint3D64f& value2,
-                CvPoint3D64f& maxValue)
-{
-    maxValue.x = std::max(value1.x,value2.x);
-    maxValue.y = std::max(value1.y,value2.y);
-    maxValue.z = std::max(value1.z,value2.z);
-}
-
-
 template<typename blDataType>
 inline void max(const blImage<blDataType>& img,
                 blDataType& maxValue)
@@ -466,21 +324,11 @@ inline void max(const blImage<blDataType>& img,
     if(img.sizeROI() <= 0)
         return;
 
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    blImageStatistics<blDataType> statistics;
 
-    maxValue = img(yROI,xROI);
+    computeStatistics(img,statistics,BL_STATISTICS_MAX);
 
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            max(img(i,j),maxValue,maxValue);
-        }
-    }
+    maxValue = statistics.m_max;
 }
 
 
@@ -531,23 +379,12 @@ inline void minmax(const blImage<blDataType>& img,
     if(img.sizeROI() <= 0)
         return;
 
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
+    blImageStatistics<blDataType> statistics;
 
-    int yROI = img.yROI();
-    int xROI = img.xROI();
-
-    minValue = img(yROI,xROI);
-    maxValue = img(yROI,xROI);
+    computeStatistics(img,statistics,BL_STATISTICS_MIN | BL_STATISTICS_MAX);
 
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            min(img(i,j),minValue,minValue);
-            max(img(i,j),maxValue,maxValue);
-        }
-    }
+    minValue = statistics.m_min;
+    maxValue = statistics.m_max;
 }
 //-------------------------------------------------------------------
 
@@ -829,61 +666,253 @@ template<typename blDataType,
          typename blDataType2,
          typename blDataType3>
 
-inline blDataType perElementSquareOfDifference(const blDataType& src1,
-                                               const blDataType2& src2,
-                                               blDataType3& dst)
+inline void perElementSquareOfDifference(const blDataType& src1,
+                                         const blDataType2& src2,
+                                         blDataType3& dst)
 {
     dst = ( (src1 - src2) * (src1 - src2) );
 }
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// The following functions run the
+// vectorized row kernels (blSimdKernels.hpp)
+// over the images' ROIs, they return
+// false when the data types don't have
+// a row kernel, so that the caller can
+// fall back to its element by element loop
 //-------------------------------------------------------------------
 template<typename blDataType,
-         typename blDataType2>
+         typename blDataType2,
+         typename blDataType3,
+         typename blOperation>
 
-inline void perElementAddition(blImage<blDataType>& img,
-                               const blDataType2& scalar)
+inline bool perElementOperationUsingSimdKernels(const blImage<blDataType>& srcImage1,
+                                                const blImage<blDataType2>& srcImage2,
+                                                blImage<blDataType3>& dstImage,
+                                                const blOperation& operation)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    return false;
+}
 
-    for(int i = yROI; i < rows + yROI; ++i)
+
+
+template<typename blDataType,
+         typename blOperation>
+
+inline bool perElementOperationUsingSimdKernels(const blImage<blDataType>& srcImage1,
+                                                const blImage<blDataType>& srcImage2,
+                                                blImage<blDataType>& dstImage,
+                                                const blOperation& operation)
+{
+    if(!blSimdPerElementKernel<blDataType,blOperation>::isSupported)
+        return false;
+
+    int rows = std::min(std::min(srcImage1.size1ROI(),srcImage2.size1ROI()),dstImage.size1ROI());
+    int cols = std::min(std::min(srcImage1.size2ROI(),srcImage2.size2ROI()),dstImage.size2ROI());
+
+    if(rows <= 0 || cols <= 0)
+        return true;
+
+    int srcyROI1 = srcImage1.yROI();
+    int srcxROI1 = srcImage1.xROI();
+    int srcyROI2 = srcImage2.yROI();
+    int srcxROI2 = srcImage2.xROI();
+    int dstyROI = dstImage.yROI();
+    int dstxROI = dstImage.xROI();
+
+    // The rows are split in
+    // full width bands run by
+    // the shared thread pool
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int j = xROI; j < cols + xROI; ++j)
+        for(int i = tile.m_row; i < tile.m_row + tile.m_numOfRows; ++i)
         {
-            perElementAddition(img(i,j),
-                               scalar,
-                               img(i,j));
+            blSimdPerElementKernel<blDataType,blOperation>::applyToRow(srcImage1[i + srcyROI1] + srcxROI1 + tile.m_col,
+                                                                       srcImage2[i + srcyROI2] + srcxROI2 + tile.m_col,
+                                                                       dstImage[i + dstyROI] + dstxROI + tile.m_col,
+                                                                       tile.m_numOfCols);
         }
+    });
+
+    return true;
+}
+
+
+
+template<typename blDataType,
+         typename blDataType2,
+         typename blOperation>
+
+inline bool perElementOperationUsingSimdKernels(blImage<blDataType>& img,
+                                                const blDataType2& scalar,
+                                                const blOperation& operation)
+{
+    if(!blSimdPerElementKernel<blDataType,blOperation>::isSupported ||
+       !blSimdPerElementKernel<blDataType,blOperation>::canApplyScalar(scalar))
+    {
+        return false;
     }
+
+    parallelForTiles(img,[&](const blImageTile& tile)
+    {
+        for(auto row : getTileRows(img,tile))
+        {
+            blSimdPerElementKernel<blDataType,blOperation>::applyScalarToRow(row.begin(),
+                                                                             scalar,
+                                                                             row.begin(),
+                                                                             row.size());
+        }
+    });
+
+    return true;
 }
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// Functors wrapping the element
+// by element functions above, used
+// to run them over the tiles of
+// the images' ROIs
+//-------------------------------------------------------------------
+struct blPerElementAdditionFunctor
+{
+    template<typename blDataType,typename blDataType2,typename blDataType3>
+    void operator()(const blDataType& src1,const blDataType2& src2,blDataType3& dst)const{perElementAddition(src1,src2,dst);}
+};
+
+struct blPerElementSubtractionFunctor
+{
+    template<typename blDataType,typename blDataType2,typename blDataType3>
+    void operator()(const blDataType& src1,const blDataType2& src2,blDataType3& dst)const{perElementSubtraction(src1,src2,dst);}
+};
+
+struct blPerElementMultiplicationFunctor
+{
+    template<typename blDataType,typename blDataType2,typename blDataType3>
+    void operator()(const blDataType& src1,const blDataType2& src2,blDataType3& dst)const{perElementMultiplication(src1,src2,dst);}
+};
+
+struct blPerElementDivisionFunctor
+{
+    template<typename blDataType,typename blDataType2,typename blDataType3>
+    void operator()(const blDataType& src1,const blDataType2& src2,blDataType3& dst)const{perElementDivision(src1,src2,dst);}
+};
+
+struct blPerElementSquareOfDifferenceFunctor
+{
+    template<typename blDataType,typename blDataType2,typename blDataType3>
+    void operator()(const blDataType& src1,const blDataType2& src2,blDataType3& dst)const{perElementSquareOfDifference(src1,src2,dst);}
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions run an
+// element by element operation over
+// the tiles of the images' ROIs using
+// the shared thread pool (they are
+// used when the data types have no
+// vectorized row kernel)
 //-------------------------------------------------------------------
 template<typename blDataType,
-         typename blDataType2>
+         typename blDataType2,
+         typename blElementOperation>
 
-inline void perElementSubtraction(blImage<blDataType>& img,
-                                  const blDataType2& scalar)
+inline void perElementOperationOverTiles(blImage<blDataType>& img,
+                                         const blDataType2& scalar,
+                                         const blElementOperation& operation)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    parallelForTiles(img,[&](const blImageTile& tile)
+    {
+        for(auto row : getTileRows(img,tile))
+        {
+            for(auto element = row.begin(); element != row.end(); ++element)
+                operation(*element,scalar,*element);
+        }
+    });
+}
 
-    for(int i = yROI; i < rows + yROI; ++i)
+
+
+template<typename blDataType,
+         typename blDataType2,
+         typename blDataType3,
+         typename blElementOperation>
+
+inline void perElementOperationOverTiles(const blImage<blDataType>& srcImage1,
+                                         const blImage<blDataType2>& srcImage2,
+                                         blImage<blDataType3>& dstImage,
+                                         const blElementOperation& operation)
+{
+    // We only go through as
+    // many rows and cols as
+    // the smallest ROI has
+
+    int rows = std::min(std::min(srcImage1.size1ROI(),srcImage2.size1ROI()),dstImage.size1ROI());
+    int cols = std::min(std::min(srcImage1.size2ROI(),srcImage2.size2ROI()),dstImage.size2ROI());
+
+    parallelForTiles(rows,cols,[&](const blImageTile& tile)
     {
-        for(int j = xROI; j < cols + xROI; ++j)
+        auto srcRows1 = getTileRows(srcImage1,tile);
+        auto srcRows2 = getTileRows(srcImage2,tile);
+        auto dstRows = getTileRows(dstImage,tile);
+
+        for(int i = 0; i < tile.m_numOfRows; ++i)
         {
-            perElementSubtraction(img(i,j),
-                                  scalar,
-                                  img(i,j));
+            auto srcRow1 = srcRows1[i];
+            auto srcRow2 = srcRows2[i];
+            auto dstRow = dstRows[i];
+
+            for(int j = 0; j < tile.m_numOfCols; ++j)
+                operation(srcRow1[j],srcRow2[j],dstRow[j]);
         }
-    }
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataType2>
+
+inline void perElementAddition(blImage<blDataType>& img,
+                               const blDataType2& scalar)
+{
+    // We use the vectorized row
+    // kernels when the image type
+    // has them
+
+    if(perElementOperationUsingSimdKernels(img,scalar,blSimdAdd()))
+        return;
+
+    perElementOperationOverTiles(img,
+                                 scalar,
+                                 blPerElementAdditionFunctor());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blDataType2>
+
+inline void perElementSubtraction(blImage<blDataType>& img,
+                                  const blDataType2& scalar)
+{
+    // We use the vectorized row
+    // kernels when the image type
+    // has them
+
+    if(perElementOperationUsingSimdKernels(img,scalar,blSimdSubtract()))
+        return;
+
+    perElementOperationOverTiles(img,
+                                 scalar,
+                                 blPerElementSubtractionFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -895,20 +924,16 @@ template<typename blDataType,
 inline void perElementMultiplication(blImage<blDataType>& img,
                                      const blDataType2& scalar)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    // We use the vectorized row
+    // kernels when the image type
+    // has them
 
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            perElementMultiplication(img(i,j),
-                                     scalar,
-                                     img(i,j));
-        }
-    }
+    if(perElementOperationUsingSimdKernels(img,scalar,blSimdMultiply()))
+        return;
+
+    perElementOperationOverTiles(img,
+                                 scalar,
+                                 blPerElementMultiplicationFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -920,20 +945,16 @@ template<typename blDataType,
 inline void perElementDivision(blImage<blDataType>& img,
                                const blDataType2& scalar)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-    int yROI = img.yROI();
-    int xROI = img.xROI();
+    // We use the vectorized row
+    // kernels when the image type
+    // has them
 
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            perElementDivision(img(i,j),
-                               scalar,
-                               img(i,j));
-        }
-    }
+    if(perElementOperationUsingSimdKernels(img,scalar,blSimdDivide()))
+        return;
+
+    perElementOperationOverTiles(img,
+                                 scalar,
+                                 blPerElementDivisionFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -945,20 +966,9 @@ template<typename blDataType,
 inline void perElementSquareOfDifference(blImage<blDataType>& img,
                                          const blDataType2& scalar)
 {
-    int rows = img.size1ROI();
-    int cols = img.size2ROI();
-    int yROI = img.yROI();
-    int xROI = img.xROI();
-
-    for(int i = yROI; i < rows + yROI; ++i)
-    {
-        for(int j = xROI; j < cols + xROI; ++j)
-        {
-            perElementSquareOfDifference(img(i,j),
-                                         scalar,
-                                         img(i,j));
-        }
-    }
+    perElementOperationOverTiles(img,
+                                 scalar,
+                                 blPerElementSquareOfDifferenceFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -972,34 +982,17 @@ inline void perElementAddition(const blImage<blDataType>& srcImage1,
                                const blImage<blDataType2>& srcImage2,
                                blImage<blDataType3>& dstImage)
 {
-    int srcRows1 = srcImage1.size1ROI();
-    int srcCols1 = srcImage1.size2ROI();
-    int srcyROI1 = srcImage1.yROI();
-    int srcxROI1 = srcImage1.xROI();
-
-    int srcRows2 = srcImage2.size1ROI();
-    int srcCols2 = srcImage2.size2ROI();
-    int srcyROI2 = srcImage2.yROI();
-    int srcxROI2 = srcImage2.xROI();
+    // We use the vectorized row
+    // kernels when the three images
+    // have the same type and it has them
 
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
+    if(perElementOperationUsingSimdKernels(srcImage1,srcImage2,dstImage,blSimdAdd()))
+        return;
 
-    for(int iSrc1 = srcyROI1, iSrc2 = srcyROI2, iDst = dstyROI;
-        iSrc1 < srcRows1 + srcyROI1 && iSrc2 < srcRows2 + srcyROI2 && iDst < dstRows + dstyROI;
-        ++iSrc1, ++iSrc2, ++iDst)
-    {
-        for(int jSrc1 = srcxROI1, jSrc2 = srcxROI2, jDst = dstxROI;
-            jSrc1 < srcCols1 + srcxROI1 && jSrc2 < srcCols2 + srcxROI2 && jDst < dstCols + dstxROI;
-            ++jSrc1, ++jSrc2, ++jDst)
-        {
-            perElementAddition(srcImage1(iSrc1,jSrc1),
-                               srcImage2(iSrc2,jSrc2),
-                               dstImage(iDst,jDst));
-        }
-    }
+    perElementOperationOverTiles(srcImage1,
+                                 srcImage2,
+                                 dstImage,
+                                 blPerElementAdditionFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -1013,34 +1006,17 @@ inline void perElementSubtraction(const blImage<blDataType>& srcImage1,
                                   const blImage<blDataType2>& srcImage2,
                                   blImage<blDataType3>& dstImage)
 {
-    int srcRows1 = srcImage1.size1ROI();
-    int srcCols1 = srcImage1.size2ROI();
-    int srcyROI1 = srcImage1.yROI();
-    int srcxROI1 = srcImage1.xROI();
-
-    int srcRows2 = srcImage2.size1ROI();
-    int srcCols2 = srcImage2.size2ROI();
-    int srcyROI2 = srcImage2.yROI();
-    int srcxROI2 = srcImage2.xROI();
+    // We use the vectorized row
+    // kernels when the three images
+    // have the same type and it has them
 
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
+    if(perElementOperationUsingSimdKernels(srcImage1,srcImage2,dstImage,blSimdSubtract()))
+        return;
 
-    for(int iSrc1 = srcyROI1, iSrc2 = srcyROI2, iDst = dstyROI;
-        iSrc1 < srcRows1 + srcyROI1 && iSrc2 < srcRows2 + srcyROI2 && iDst < dstRows + dstyROI;
-        ++iSrc1, ++iSrc2, ++iDst)
-    {
-        for(int jSrc1 = srcxROI1, jSrc2 = srcxROI2, jDst = dstxROI;
-            jSrc1 < srcCols1 + srcxROI1 && jSrc2 < srcCols2 + srcxROI2 && jDst < dstCols + dstxROI;
-            ++jSrc1, ++jSrc2, ++jDst)
-        {
-            perElementSubtraction(srcImage1(iSrc1,jSrc1),
-                                  srcImage2(iSrc2,jSrc2),
-                                  dstImage(iDst,jDst));
-        }
-    }
+    perElementOperationOverTiles(srcImage1,
+                                 srcImage2,
+                                 dstImage,
+                                 blPerElementSubtractionFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -1054,34 +1030,17 @@ inline void perElementMultiplication(const blImage<blDataType>& srcImage1,
                                      const blImage<blDataType2>& srcImage2,
                                      blImage<blDataType3>& dstImage)
 {
-    int srcRows1 = srcImage1.size1ROI();
-    int srcCols1 = srcImage1.size2ROI();
-    int srcyROI1 = srcImage1.yROI();
-    int srcxROI1 = srcImage1.xROI();
-
-    int srcRows2 = srcImage2.size1ROI();
-    int srcCols2 = srcImage2.size2ROI();
-    int srcyROI2 = srcImage2.yROI();
-    int srcxROI2 = srcImage2.xROI();
+    // We use the vectorized row
+    // kernels when the three images
+    // have the same type and it has them
 
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
+    if(perElementOperationUsingSimdKernels(srcImage1,srcImage2,dstImage,blSimdMultiply()))
+        return;
 
-    for(int iSrc1 = srcyROI1, iSrc2 = srcyROI2, iDst = dstyROI;
-        iSrc1 < srcRows1 + srcyROI1 && iSrc2 < srcRows2 + srcyROI2 && iDst < dstRows + dstyROI;
-        ++iSrc1, ++iSrc2, ++iDst)
-    {
-        for(int jSrc1 = srcxROI1, jSrc2 = srcxROI2, jDst = dstxROI;
-            jSrc1 < srcCols1 + srcxROI1 && jSrc2 < srcCols2 + srcxROI2 && jDst < dstCols + dstxROI;
-            ++jSrc1, ++jSrc2, ++jDst)
-        {
-            perElementMultiplication(srcImage1(iSrc1,jSrc1),
-                                     srcImage2(iSrc2,jSrc2),
-                                     dstImage(iDst,jDst));
-        }
-    }
+    perElementOperationOverTiles(srcImage1,
+                                 srcImage2,
+                                 dstImage,
+                                 blPerElementMultiplicationFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -1095,34 +1054,17 @@ inline void perElementDivision(const blImage<blDataType>& srcImage1,
                                const blImage<blDataType2>& srcImage2,
                                blImage<blDataType3>& dstImage)
 {
-    int srcRows1 = srcImage1.size1ROI();
-    int srcCols1 = srcImage1.size2ROI();
-    int srcyROI1 = srcImage1.yROI();
-    int srcxROI1 = srcImage1.xROI();
+    // We use the vectorized row
+    // kernels when the three images
+    // have the same type and it has them
 
-    int srcRows2 = srcImage2.size1ROI();
-    int srcCols2 = srcImage2.size2ROI();
-    int srcyROI2 = srcImage2.yROI();
-    int srcxROI2 = srcImage2.xROI();
-
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
+    if(perElementOperationUsingSimdKernels(srcImage1,srcImage2,dstImage,blSimdDivide()))
+        return;
 
-    for(int iSrc1 = srcyROI1, iSrc2 = srcyROI2, iDst = dstyROI;
-        iSrc1 < srcRows1 + srcyROI1 && iSrc2 < srcRows2 + srcyROI2 && iDst < dstRows + dstyROI;
-        ++iSrc1, ++iSrc2, ++iDst)
-    {
-        for(int jSrc1 = srcxROI1, jSrc2 = srcxROI2, jDst = dstxROI;
-            jSrc1 < srcCols1 + srcxROI1 && jSrc2 < srcCols2 + srcxROI2 && jDst < dstCols + dstxROI;
-            ++jSrc1, ++jSrc2, ++jDst)
-        {
-            perElementDivision(srcImage1(iSrc1,jSrc1),
-                               srcImage2(iSrc2,jSrc2),
-                               dstImage(iDst,jDst));
-        }
-    }
+    perElementOperationOverTiles(srcImage1,
+                                 srcImage2,
+                                 dstImage,
+                                 blPerElementDivisionFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -1136,34 +1078,10 @@ inline void perElementSquareOfDifference(const blImage<blDataType>& srcImage1,
                                          const blImage<blDataType2>& srcImage2,
                                          blImage<blDataType3>& dstImage)
 {
-    int srcRows1 = srcImage1.size1ROI();
-    int srcCols1 = srcImage1.size2ROI();
-    int srcyROI1 = srcImage1.yROI();
-    int srcxROI1 = srcImage1.xROI();
-
-    int srcRows2 = srcImage2.size1ROI();
-    int srcCols2 = srcImage2.size2ROI();
-    int srcyROI2 = srcImage2.yROI();
-    int srcxROI2 = srcImage2.xROI();
-
-    int dstRows = dstImage.size1ROI();
-    int dstCols = dstImage.size2ROI();
-    int dstyROI = dstImage.yROI();
-    int dstxROI = dstImage.xROI();
-
-    for(int iSrc1 = srcyROI1, iSrc2 = srcyROI2, iDst = dstyROI;
-        iSrc1 < srcRows1 + srcyROI1 && iSrc2 < srcRows2 + srcyROI2 && iDst < dstRows + dstyROI;
-        ++iSrc1, ++iSrc2, ++iDst)
-    {
-        for(int jSrc1 = srcxROI1, jSrc2 = srcxROI2, jDst = dstxROI;
-            jSrc1 < srcCols1 + srcxROI1 && jSrc2 < srcCols2 + srcxROI2 && jDst < dstCols + dstxROI;
-            ++jSrc1, ++jSrc2, ++jDst)
-        {
-            perElementSquareOfDifference(srcImage1(iSrc1,jSrc1),
-                                         srcImage2(iSrc2,jSrc2),
-                                         dstImage(iDst,jDst));
-        }
-    }
+    perElementOperationOverTiles(srcImage1,
+                                 srcImage2,
+                                 dstImage,
+                                 blPerElementSquareOfDifferenceFunctor());
 }
 //-------------------------------------------------------------------
 
@@ -1320,17 +1238,11 @@ template<typename blDataType>
 inline void mean(const blImage<blDataType>& srcImage,
                  blDataType& meanValue)
 {
-    meanValue = blDataType(0);
+    blImageStatistics<blDataType> statistics;
 
-    for(int i = 0; i < srcImage.size1ROI(); ++i)
-    {
-        for(int j = 0; j < srcImage.size2ROI(); ++j)
-        {
-            meanValue += srcImage.atROI(i,j);
-        }
-    }
+    computeStatistics(srcImage,statistics,BL_STATISTICS_MEAN);
 
-    meanValue /= srcImage.sizeROI();
+    meanValue = blDataType(statistics.m_mean);
 }
 //-------------------------------------------------------------------
 
@@ -1355,19 +1267,25 @@ template<typename blDataType>
 inline blDataType variance(const blImage<blDataType>& srcImage,
                            const blDataType& meanValue)
 {
-    blDataType varianceValue = blDataType(0);
+    // The sum of squared deviations
+    // from the passed mean is derived
+    // from the one around the actual
+    // mean, so we only walk the image
+    // once
 
-    for(int i = 0; i < srcImage.size1ROI(); ++i)
-    {
-        for(int j = 0; j < srcImage.size2ROI(); ++j)
-        {
-            varianceValue += ( (srcImage.atROI(i,j) - meanValue) * (srcImage.atROI(i,j) - meanValue) );
-        }
-    }
+    typedef typename blImageStatistics<blDataType>::accumulator_type blAccumulatorType;
+
+    blImageStatistics<blDataType> statistics;
+
+    computeStatistics(srcImage,statistics,BL_STATISTICS_VARIANCE);
 
-    varianceValue /= blDataType(srcImage.sizeROI() - 1);
+    if(statistics.m_count < 2)
+        return blDataType(0);
+
+    blAccumulatorType meanDifference = statistics.m_mean - blAccumulatorType(meanValue);
 
-    return varianceValue;
+    return blDataType( (statistics.m_sumOfSquaredDeviations + meanDifference * meanDifference * double(statistics.m_count)) /
+                       double(statistics.m_count - 1) );
 }
 //-------------------------------------------------------------------
 
@@ -1377,9 +1295,11 @@ template<typename blDataType>
 
 inline blDataType variance(const blImage<blDataType>& srcImage)
 {
-    auto meanValue = mean(srcImage);
+    blImageStatistics<blDataType> statistics;
+
+    computeStatistics(srcImage,statistics,BL_STATISTICS_VARIANCE);
 
-    return variance(srcImage,meanValue);
+    return blDataType(statistics.variance());
 }
 //-------------------------------------------------------------------
 
@@ -1400,7 +1320,11 @@ template<typename blDataType>
 
 inline blDataType stdDev(const blImage<blDataType>& srcImage)
 {
-    return ( sqrt(variance(srcImage)) );
+    blImageStatistics<blDataType> statistics;
+
+    computeStatistics(srcImage,statistics,BL_STATISTICS_VARIANCE);
+
+    return blDataType(statistics.stdDev());
 }
 //-------------------------------------------------------------------
 
@@ -0,0 +1,546 @@
+#ifndef BL_IMAGEROIITERATOR_HPP
+#define BL_IMAGEROIITERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageROIIterator.hpp
+// CLASS:           blImageROIIterator
+// BASE CLASS:      None
+//
+// PURPOSE:         - Defines a lightweight random access iterator
+//                    used to go through an image's ROI in stl
+//                    algorithms
+//                  - Unlike blImageCircularIterator, it does not
+//                    hold a copy of the image (no shared_ptr
+//                    reference counting when copying iterators)
+//                    and it does not compute modulos when
+//                    dereferenced, it only holds the ROI origin,
+//                    the row stride and its current position
+//                  - It keeps the "maxNumberOfCirculations"
+//                    semantics of the circular iterator, wrapping
+//                    back to the ROI origin once it goes past the
+//                    last ROI element, but the common case of
+//                    maxNumberOfCirculations == 1 never wraps
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    <iterator>
+//                  <limits>
+//                  blImageRowIterators.hpp
+//
+// NOTES:           - Incrementing is just a pointer increment plus
+//                    an end of row check, and when the ROI rows are
+//                    back to back in memory (the ROI spans the whole
+//                    width of an image without padding) the ROI is
+//                    treated as one single row
+//
+//                  - Random jumps (+=, -=) compute the new row/col
+//                    position with one division
+//
+//                  - Two iterators are equal when they are both
+//                    past their max number of circulations, or when
+//                    they are at the same position (starting element
+//                    plus number of steps taken, so the same element
+//                    in two different circulations is not equal)
+//
+//                  - The difference and the ordering use the same
+//                    positions, and an iterator past the end is as
+//                    far from another one as the steps that one has
+//                    left before its own end, so that
+//                    std::distance(first,last) is the number of steps
+//                    a (first != last) loop takes
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageROIIterator : public std::iterator<std::random_access_iterator_tag,
+                                                blDataType,
+                                                ptrdiff_t,
+                                                blDataType*,
+                                                blDataType&>
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageROIIterator();
+
+    // Constructor used to iterate
+    // over a ROI given its origin,
+    // its size and the row stride
+    // (in bytes) of the image
+
+    blImageROIIterator(blDataType* ROIorigin,
+                       const int& numOfRows,
+                       const int& numOfCols,
+                       const ptrdiff_t& widthStep,
+                       const int& startingElementIndex,
+                       const int& maxNumberOfCirculations);
+
+    // Constructor used to iterate
+    // over a range of rows (usually
+    // the one returned by getRowsROI)
+
+    blImageROIIterator(const blImageRowRange<blDataType>& rows,
+                       const int& startingElementIndex,
+                       const int& maxNumberOfCirculations);
+
+public: // Overloaded operators
+
+    // Boolean operator to check validity
+    // of iterator
+
+    operator                                    bool()const
+    {
+        if(m_ROIorigin)
+            return true;
+        else
+            return false;
+    }
+
+    // Comparator operators
+
+    bool                                        operator==(const blImageROIIterator<blDataType>& ROIiterator)const;
+    bool                                        operator!=(const blImageROIIterator<blDataType>& ROIiterator)const;
+    bool                                        operator<(const blImageROIIterator<blDataType>& ROIiterator)const{return ( ((*this) - ROIiterator) < 0 );}
+    bool                                        operator>(const blImageROIIterator<blDataType>& ROIiterator)const{return ( ((*this) - ROIiterator) > 0 );}
+    bool                                        operator<=(const blImageROIIterator<blDataType>& ROIiterator)const{return ( ((*this) - ROIiterator) <= 0 );}
+    bool                                        operator>=(const blImageROIIterator<blDataType>& ROIiterator)const{return ( ((*this) - ROIiterator) >= 0 );}
+
+    // Arithmetic operators
+
+    blImageROIIterator<blDataType>&             operator+=(const ptrdiff_t& movement);
+    blImageROIIterator<blDataType>&             operator-=(const ptrdiff_t& movement);
+    blImageROIIterator<blDataType>&             operator++();
+    blImageROIIterator<blDataType>&             operator--();
+    blImageROIIterator<blDataType>              operator++(int);
+    blImageROIIterator<blDataType>              operator--(int);
+    blImageROIIterator<blDataType>              operator+(const ptrdiff_t& movement)const;
+    blImageROIIterator<blDataType>              operator-(const ptrdiff_t& movement)const;
+
+    ptrdiff_t                                   operator-(const blImageROIIterator<blDataType>& ROIiterator)const;
+
+    // Dereferencing operators
+
+    blDataType&                                 operator*()const{return (*m_current);}
+    blDataType*                                 operator->()const{return m_current;}
+    blDataType&                                 operator[](const ptrdiff_t& movement)const{return *((*this) + movement);}
+
+public: // Public functions
+
+    // Functions used to get
+    // the iterator components
+
+    int                                         getDataIndex()const;
+    int                                         getStartIndex()const{return m_startIndex;}
+    int                                         getCurrentNumberOfCirculations()const;
+    int                                         getMaxNumberOfCirculations()const{return m_maxNumberOfCirculations;}
+
+    blDataType*                                 getRawPointer()const{return m_current;}
+
+    // Function used to tell whether
+    // the iterator has gone past
+    // its max number of circulations
+
+    bool                                        isPastTheEnd()const{return (m_index >= m_endIndex);}
+
+private: // Private functions
+
+    // Function used to recompute
+    // the row/col position and the
+    // pointer from the total number
+    // of steps taken
+
+    void                                        updatePosition();
+
+private: // Private variables
+
+    // Pointer to the first element
+    // of the ROI and to the element
+    // the iterator is pointing at
+
+    blDataType*                                 m_ROIorigin;
+    blDataType*                                 m_current;
+
+    // ROI dimensions and distance
+    // in bytes between rows
+
+    int                                         m_numOfRows;
+    int                                         m_numOfCols;
+    ptrdiff_t                                   m_widthStep;
+
+    // Current row and col
+    // within the ROI
+
+    int                                         m_row;
+    int                                         m_col;
+
+    // Element index (within the ROI)
+    // the iterator started from, the
+    // number of steps taken since
+    // then and the number of steps
+    // after which the iterator
+    // reaches the "end"
+
+    int                                         m_startIndex;
+    ptrdiff_t                                   m_index;
+    ptrdiff_t                                   m_endIndex;
+
+    // Max number of allowed times
+    // the iterator can circulate
+    // around the ROI before reaching
+    // the "end" (negative means never)
+
+    int                                         m_maxNumberOfCirculations;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>::blImageROIIterator()
+                                       : m_ROIorigin(nullptr),
+                                         m_current(nullptr),
+                                         m_numOfRows(0),
+                                         m_numOfCols(0),
+                                         m_widthStep(0),
+                                         m_row(0),
+                                         m_col(0),
+                                         m_startIndex(0),
+                                         m_index(0),
+                                         m_endIndex(0),
+                                         m_maxNumberOfCirculations(0)
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>::blImageROIIterator(blDataType* ROIorigin,
+                                                          const int& numOfRows,
+                                                          const int& numOfCols,
+                                                          const ptrdiff_t& widthStep,
+                                                          const int& startingElementIndex,
+                                                          const int& maxNumberOfCirculations)
+{
+    // When the ROI rows are back
+    // to back in memory we treat
+    // the ROI as one single row
+
+    blImageRowRange<blDataType> rows = blImageRowRange<blDataType>(ROIorigin,
+                                                                   numOfRows,
+                                                                   numOfCols,
+                                                                   widthStep).getContinuousRows();
+
+    m_ROIorigin = ROIorigin;
+    m_numOfRows = rows.getNumOfRows();
+    m_numOfCols = rows.getNumOfCols();
+    m_widthStep = rows.getWidthStep();
+
+    m_maxNumberOfCirculations = maxNumberOfCirculations;
+
+    ptrdiff_t sizeOfROI = ptrdiff_t(m_numOfRows) * ptrdiff_t(m_numOfCols);
+
+    if(sizeOfROI == 0)
+    {
+        m_startIndex = 0;
+        m_endIndex = 0;
+    }
+    else
+    {
+        m_startIndex = int( ( (startingElementIndex % sizeOfROI) + sizeOfROI ) % sizeOfROI );
+
+        if(maxNumberOfCirculations < 0)
+            m_endIndex = std::numeric_limits<ptrdiff_t>::max();
+        else
+            m_endIndex = sizeOfROI * ptrdiff_t(maxNumberOfCirculations);
+    }
+
+    m_index = 0;
+
+    updatePosition();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>::blImageROIIterator(const blImageRowRange<blDataType>& rows,
+                                                          const int& startingElementIndex,
+                                                          const int& maxNumberOfCirculations)
+                                       : blImageROIIterator(rows.begin().getRowPtr(),
+                                                            rows.getNumOfRows(),
+                                                            rows.getNumOfCols(),
+                                                            rows.getWidthStep(),
+                                                            startingElementIndex,
+                                                            maxNumberOfCirculations)
+{
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageROIIterator<blDataType>::updatePosition()
+{
+    ptrdiff_t sizeOfROI = ptrdiff_t(m_numOfRows) * ptrdiff_t(m_numOfCols);
+
+    if(sizeOfROI == 0)
+    {
+        m_row = 0;
+        m_col = 0;
+        m_current = m_ROIorigin;
+        return;
+    }
+
+    ptrdiff_t elementIndex = ( ( (m_startIndex + m_index) % sizeOfROI ) + sizeOfROI ) % sizeOfROI;
+
+    m_row = int(elementIndex / m_numOfCols);
+    m_col = int(elementIndex % m_numOfCols);
+
+    m_current = advancePointerByBytes(m_ROIorigin,ptrdiff_t(m_row) * m_widthStep) + m_col;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blImageROIIterator<blDataType>::getDataIndex()const
+{
+    return (m_row * m_numOfCols + m_col);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline int blImageROIIterator<blDataType>::getCurrentNumberOfCirculations()const
+{
+    ptrdiff_t sizeOfROI = ptrdiff_t(m_numOfRows) * ptrdiff_t(m_numOfCols);
+
+    if(sizeOfROI == 0)
+        return 0;
+
+    return int(m_index / sizeOfROI);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blImageROIIterator<blDataType>::operator==(const blImageROIIterator<blDataType>& ROIiterator)const
+{
+    bool isThisPastTheEnd = this->isPastTheEnd();
+
+    if(isThisPastTheEnd != ROIiterator.isPastTheEnd())
+        return false;
+
+    if(isThisPastTheEnd)
+        return true;
+
+    return ( (m_startIndex + m_index) == (ROIiterator.m_startIndex + ROIiterator.m_index) );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blImageROIIterator<blDataType>::operator!=(const blImageROIIterator<blDataType>& ROIiterator)const
+{
+    return !( (*this) == ROIiterator );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>& blImageROIIterator<blDataType>::operator++()
+{
+    ++m_index;
+    ++m_current;
+
+    if(++m_col == m_numOfCols)
+    {
+        m_col = 0;
+
+        if(++m_row == m_numOfRows)
+        {
+            // We circulate back to
+            // the ROI origin
+
+            m_row = 0;
+            m_current = m_ROIorigin;
+        }
+        else
+        {
+            m_current = advancePointerByBytes(m_current - m_numOfCols,m_widthStep);
+        }
+    }
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>& blImageROIIterator<blDataType>::operator--()
+{
+    --m_index;
+
+    if(m_col == 0)
+    {
+        m_col = m_numOfCols - 1;
+
+        if(m_row == 0)
+        {
+            // We circulate back to
+            // the ROI last element
+
+            m_row = m_numOfRows - 1;
+            m_current = advancePointerByBytes(m_ROIorigin,ptrdiff_t(m_row) * m_widthStep) + m_col;
+        }
+        else
+        {
+            --m_row;
+            m_current = advancePointerByBytes(m_current,-m_widthStep) + m_col;
+        }
+    }
+    else
+    {
+        --m_col;
+        --m_current;
+    }
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>& blImageROIIterator<blDataType>::operator+=(const ptrdiff_t& movement)
+{
+    m_index += movement;
+
+    updatePosition();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType>& blImageROIIterator<blDataType>::operator-=(const ptrdiff_t& movement)
+{
+    m_index -= movement;
+
+    updatePosition();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType> blImageROIIterator<blDataType>::operator++(int)
+{
+    auto temp(*this);
+
+    ++(*this);
+
+    return temp;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType> blImageROIIterator<blDataType>::operator--(int)
+{
+    auto temp(*this);
+
+    --(*this);
+
+    return temp;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType> blImageROIIterator<blDataType>::operator+(const ptrdiff_t& movement)const
+{
+    auto temp(*this);
+
+    temp += movement;
+
+    return temp;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageROIIterator<blDataType> blImageROIIterator<blDataType>::operator-(const ptrdiff_t& movement)const
+{
+    auto temp(*this);
+
+    temp -= movement;
+
+    return temp;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline ptrdiff_t blImageROIIterator<blDataType>::operator-(const blImageROIIterator<blDataType>& ROIiterator)const
+{
+    bool isThisPastTheEnd = this->isPastTheEnd();
+    bool isOtherPastTheEnd = ROIiterator.isPastTheEnd();
+
+    // Iterators past the end are all
+    // equal, and they're as far from
+    // an iterator as the steps that
+    // iterator has left before its end
+
+    if(isThisPastTheEnd && isOtherPastTheEnd)
+        return 0;
+
+    if(isThisPastTheEnd)
+        return (ROIiterator.m_endIndex - ROIiterator.m_index);
+
+    if(isOtherPastTheEnd)
+        return -(m_endIndex - m_index);
+
+    return ( (m_startIndex + m_index) - (ROIiterator.m_startIndex + ROIiterator.m_index) );
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEROIITERATOR_HPP
@@ -0,0 +1,562 @@
+#ifndef BL_IMAGEROWITERATORS_HPP
+#define BL_IMAGEROWITERATORS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageRowIterators.hpp
+// CLASS:           blImageRowSpan
+//                  blImageRowIterator
+//                  blImageSegmentedIterator
+//                  blImageRowRange
+// BASE CLASS:      None
+//
+// PURPOSE:         Defines a two-level (row/segment) way of
+//                  traversing an image or an image ROI
+//
+//                  -- blImageRowSpan is a contiguous span of
+//                     pixels (a row or part of a row), whose
+//                     begin/end are raw pointers, so stl
+//                     algorithms and the compiler's
+//                     auto-vectorizer get tight inner loops
+//
+//                  -- blImageRowIterator is a random access
+//                     iterator over the rows of an image,
+//                     stepping by the image's widthStep, so
+//                     padded rows are handled correctly
+//
+//                  -- blImageSegmentedIterator is a forward
+//                     iterator over the pixels that jumps
+//                     over the row padding when reaching
+//                     the end of a row
+//
+//                  -- blImageRowRange ties everything
+//                     together for a whole image or an ROI
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    <algorithm>
+//                  <iterator>
+//                  <type_traits>
+//
+// NOTES:           - When the rows of a range are stored
+//                    back to back (no padding, or a
+//                    single row), the range is
+//                    "continuous" and "getContinuousRows"
+//                    collapses it into one single row,
+//                    which is also what the segmented
+//                    iterators use internally, so both
+//                    padded and continuous images take
+//                    the fast path
+//
+//                  - Example of use:
+//
+//                    for(auto row : img.getRowsROI())
+//                        std::fill(row.begin(),row.end(),value);
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A helper function used to move a
+// typed pointer by a number of bytes
+// (the widthStep of an image is in
+// bytes and is not necessarily a
+// multiple of the element size)
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blDataType* advancePointerByBytes(blDataType* ptr,
+                                         const ptrdiff_t& numOfBytes)
+{
+    typedef typename std::conditional<std::is_const<blDataType>::value,
+                                      const char,
+                                      char>::type                   blByteType;
+
+    return reinterpret_cast<blDataType*>(reinterpret_cast<blByteType*>(ptr) + numOfBytes);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A contiguous span of pixels
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageRowSpan
+{
+public: // Public typedefs
+
+    typedef blDataType                          value_type;
+    typedef blDataType*                         iterator;
+    typedef blDataType*                         pointer;
+    typedef blDataType&                         reference;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageRowSpan(blDataType* beginOfSpan = nullptr,
+                   const int& numOfElements = 0)
+                   : m_begin(beginOfSpan),
+                     m_end(beginOfSpan + numOfElements)
+    {
+    }
+
+public: // Public functions
+
+    blDataType*                                 begin()const{return m_begin;}
+    blDataType*                                 end()const{return m_end;}
+    blDataType*                                 data()const{return m_begin;}
+
+    int                                         size()const{return int(m_end - m_begin);}
+    bool                                        empty()const{return (m_end == m_begin);}
+
+    blDataType&                                 operator[](const int& index)const{return m_begin[index];}
+
+private: // Private variables
+
+    blDataType*                                 m_begin;
+    blDataType*                                 m_end;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A random access iterator over the
+// rows of an image (dereferencing
+// it returns a row span by value)
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageRowIterator : public std::iterator<std::random_access_iterator_tag,
+                                                blImageRowSpan<blDataType>,
+                                                ptrdiff_t,
+                                                const blImageRowSpan<blDataType>*,
+                                                blImageRowSpan<blDataType> >
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageRowIterator(blDataType* row = nullptr,
+                       const int& numOfCols = 0,
+                       const ptrdiff_t& widthStep = 0)
+                       : m_row(row),
+                         m_numOfCols(numOfCols),
+                         m_widthStep(widthStep)
+    {
+    }
+
+public: // Public functions
+
+    // Dereferencing operators
+
+    blImageRowSpan<blDataType>                  operator*()const{return blImageRowSpan<blDataType>(m_row,m_numOfCols);}
+    blImageRowSpan<blDataType>                  operator[](const ptrdiff_t& movement)const{return *((*this) + movement);}
+
+    // Overloaded equality/inequality operators
+
+    bool                                        operator==(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row == rowIterator.m_row);}
+    bool                                        operator!=(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row != rowIterator.m_row);}
+    bool                                        operator<(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row < rowIterator.m_row);}
+    bool                                        operator>(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row > rowIterator.m_row);}
+    bool                                        operator<=(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row <= rowIterator.m_row);}
+    bool                                        operator>=(const blImageRowIterator<blDataType>& rowIterator)const{return (m_row >= rowIterator.m_row);}
+
+    // Overloaded assignment/arithmetic operators
+
+    blImageRowIterator<blDataType>&             operator+=(const ptrdiff_t& movement){m_row = advancePointerByBytes(m_row,movement * m_widthStep);return (*this);}
+    blImageRowIterator<blDataType>&             operator-=(const ptrdiff_t& movement){m_row = advancePointerByBytes(m_row,-movement * m_widthStep);return (*this);}
+    blImageRowIterator<blDataType>&             operator++(){return ((*this) += 1);}
+    blImageRowIterator<blDataType>&             operator--(){return ((*this) -= 1);}
+    blImageRowIterator<blDataType>              operator++(int){blImageRowIterator<blDataType> temp(*this);++(*this);return temp;}
+    blImageRowIterator<blDataType>              operator--(int){blImageRowIterator<blDataType> temp(*this);--(*this);return temp;}
+    blImageRowIterator<blDataType>              operator+(const ptrdiff_t& movement)const{blImageRowIterator<blDataType> temp(*this);return (temp += movement);}
+    blImageRowIterator<blDataType>              operator-(const ptrdiff_t& movement)const{blImageRowIterator<blDataType> temp(*this);return (temp -= movement);}
+
+    ptrdiff_t                                   operator-(const blImageRowIterator<blDataType>& rowIterator)const;
+
+    // Functions used to get the
+    // iterator's properties
+
+    blDataType*                                 getRowPtr()const{return m_row;}
+    int                                         getNumOfCols()const{return m_numOfCols;}
+    ptrdiff_t                                   getWidthStep()const{return m_widthStep;}
+
+private: // Private variables
+
+    // Pointer to the first
+    // element of the row
+
+    blDataType*                                 m_row;
+
+    // Number of elements in
+    // each row and distance
+    // in bytes between rows
+
+    int                                         m_numOfCols;
+    ptrdiff_t                                   m_widthStep;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline ptrdiff_t blImageRowIterator<blDataType>::operator-(const blImageRowIterator<blDataType>& rowIterator)const
+{
+    if(m_widthStep == 0)
+        return 0;
+
+    typedef typename std::conditional<std::is_const<blDataType>::value,
+                                      const char,
+                                      char>::type                   blByteType;
+
+    return ( (reinterpret_cast<blByteType*>(m_row) - reinterpret_cast<blByteType*>(rowIterator.m_row)) / m_widthStep );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A forward iterator over the pixels
+// of a range of rows, which skips
+// the row padding at the end of each
+// row -- The end iterator points to
+// the beginning of the row after the
+// last one, which is exactly where
+// incrementing past the last element
+// of the last row lands
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageSegmentedIterator : public std::iterator<std::forward_iterator_tag,
+                                                      blDataType,
+                                                      ptrdiff_t,
+                                                      blDataType*,
+                                                      blDataType&>
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageSegmentedIterator(blDataType* row = nullptr,
+                             const int& numOfCols = 0,
+                             const ptrdiff_t& widthStep = 0)
+                             : m_current(row),
+                               m_endOfRow(row + numOfCols),
+                               m_numOfCols(numOfCols),
+                               m_widthStep(widthStep)
+    {
+    }
+
+public: // Public functions
+
+    // Dereferencing operators
+
+    blDataType&                                 operator*()const{return (*m_current);}
+    blDataType*                                 operator->()const{return m_current;}
+
+    // Overloaded equality/inequality operators
+
+    bool                                        operator==(const blImageSegmentedIterator<blDataType>& segmentedIterator)const{return (m_current == segmentedIterator.m_current);}
+    bool                                        operator!=(const blImageSegmentedIterator<blDataType>& segmentedIterator)const{return (m_current != segmentedIterator.m_current);}
+
+    // Increment operators
+
+    blImageSegmentedIterator<blDataType>&       operator++();
+    blImageSegmentedIterator<blDataType>        operator++(int){blImageSegmentedIterator<blDataType> temp(*this);++(*this);return temp;}
+
+    // Functions used to get the
+    // remaining part of the current
+    // segment (row), which segmented
+    // algorithms can process with a
+    // tight inner loop before calling
+    // "nextSegment"
+
+    blImageRowSpan<blDataType>                  getSegment()const{return blImageRowSpan<blDataType>(m_current,int(m_endOfRow - m_current));}
+
+    void                                        nextSegment();
+
+private: // Private variables
+
+    // Pointer to the current
+    // element and to the end
+    // of the current row
+
+    blDataType*                                 m_current;
+    blDataType*                                 m_endOfRow;
+
+    // Number of elements in
+    // each row and distance
+    // in bytes between rows
+
+    int                                         m_numOfCols;
+    ptrdiff_t                                   m_widthStep;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageSegmentedIterator<blDataType>& blImageSegmentedIterator<blDataType>::operator++()
+{
+    ++m_current;
+
+    if(m_current == m_endOfRow)
+        nextSegment();
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageSegmentedIterator<blDataType>::nextSegment()
+{
+    m_endOfRow = advancePointerByBytes(m_endOfRow,m_widthStep);
+    m_current = m_endOfRow - m_numOfCols;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A range of rows (a whole image or
+// an image ROI)
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageRowRange
+{
+public: // Public typedefs
+
+    typedef blImageRowIterator<blDataType>          iterator;
+    typedef blImageSegmentedIterator<blDataType>    segmented_iterator;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageRowRange(blDataType* firstRow = nullptr,
+                    const int& numOfRows = 0,
+                    const int& numOfCols = 0,
+                    const ptrdiff_t& widthStep = 0);
+
+public: // Public functions
+
+    // Row iterators (used with
+    // range based for loops)
+
+    blImageRowIterator<blDataType>              begin()const{return blImageRowIterator<blDataType>(m_firstRow,m_numOfCols,m_widthStep);}
+    blImageRowIterator<blDataType>              end()const{return (begin() + m_numOfRows);}
+
+    // Element iterators that skip
+    // the row padding (they walk
+    // the continuous layout when
+    // there's no padding)
+
+    blImageSegmentedIterator<blDataType>        beginElements()const;
+    blImageSegmentedIterator<blDataType>        endElements()const;
+
+    // Range properties
+
+    int                                         size()const{return m_numOfRows;}
+    bool                                        empty()const{return (m_numOfRows == 0);}
+
+    int                                         getNumOfRows()const{return m_numOfRows;}
+    int                                         getNumOfCols()const{return m_numOfCols;}
+    ptrdiff_t                                   getWidthStep()const{return m_widthStep;}
+
+    blImageRowSpan<blDataType>                  operator[](const int& rowIndex)const{return begin()[rowIndex];}
+
+    // Function used to tell whether
+    // the rows are stored back to
+    // back in memory
+
+    bool                                        isContinuous()const;
+
+    // Function used to get the same
+    // range with all its rows merged
+    // into one row when the range is
+    // continuous (otherwise it returns
+    // the range itself)
+
+    blImageRowRange<blDataType>                 getContinuousRows()const;
+
+private: // Private variables
+
+    blDataType*                                 m_firstRow;
+
+    int                                         m_numOfRows;
+    int                                         m_numOfCols;
+    ptrdiff_t                                   m_widthStep;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<blDataType>::blImageRowRange(blDataType* firstRow,
+                                                    const int& numOfRows,
+                                                    const int& numOfCols,
+                                                    const ptrdiff_t& widthStep)
+{
+    // An empty range (no rows, no
+    // cols or no data) is stored
+    // as zero rows so that begin
+    // and end always match
+
+    if(firstRow == nullptr || numOfRows <= 0 || numOfCols <= 0)
+    {
+        m_firstRow = firstRow;
+        m_numOfRows = 0;
+        m_numOfCols = 0;
+        m_widthStep = 0;
+    }
+    else
+    {
+        m_firstRow = firstRow;
+        m_numOfRows = numOfRows;
+        m_numOfCols = numOfCols;
+        m_widthStep = widthStep;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline bool blImageRowRange<blDataType>::isContinuous()const
+{
+    return ( m_numOfRows <= 1 ||
+             m_widthStep == ptrdiff_t(m_numOfCols * sizeof(blDataType)) );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageRowRange<blDataType> blImageRowRange<blDataType>::getContinuousRows()const
+{
+    if(m_numOfRows > 1 && this->isContinuous())
+    {
+        return blImageRowRange<blDataType>(m_firstRow,
+                                           1,
+                                           m_numOfRows * m_numOfCols,
+                                           m_numOfRows * m_widthStep);
+    }
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageSegmentedIterator<blDataType> blImageRowRange<blDataType>::beginElements()const
+{
+    blImageRowRange<blDataType> rows = this->getContinuousRows();
+
+    return blImageSegmentedIterator<blDataType>(rows.m_firstRow,
+                                                rows.m_numOfCols,
+                                                rows.m_widthStep);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageSegmentedIterator<blDataType> blImageRowRange<blDataType>::endElements()const
+{
+    blImageRowRange<blDataType> rows = this->getContinuousRows();
+
+    return blImageSegmentedIterator<blDataType>(advancePointerByBytes(rows.m_firstRow,
+                                                                      rows.m_numOfRows * rows.m_widthStep),
+                                                rows.m_numOfCols,
+                                                rows.m_widthStep);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A segmented version of std::for_each
+// which calls the functor on every
+// element of the range, one row span
+// at a time
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blFunctorType>
+inline blFunctorType forEachElement(const blImageRowRange<blDataType>& rows,
+                                    blFunctorType functor)
+{
+    for(auto row : rows.getContinuousRows())
+    {
+        for(auto element = row.begin(); element != row.end(); ++element)
+            functor(*element);
+    }
+
+    return functor;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A segmented version of std::transform
+// which works on two ranges of the same
+// size (possibly with different padding)
+//-------------------------------------------------------------------
+template<typename blSrcDataType,
+         typename blDstDataType,
+         typename blFunctorType>
+inline bool transformElements(const blImageRowRange<blSrcDataType>& srcRows,
+                              const blImageRowRange<blDstDataType>& dstRows,
+                              blFunctorType functor)
+{
+    if(srcRows.getNumOfRows() != dstRows.getNumOfRows() ||
+       srcRows.getNumOfCols() != dstRows.getNumOfCols())
+    {
+        return false;
+    }
+
+    // When both ranges are continuous
+    // we process them as a single row
+
+    if(srcRows.isContinuous() && dstRows.isContinuous())
+    {
+        auto srcRow = *srcRows.getContinuousRows().begin();
+        auto dstRow = *dstRows.getContinuousRows().begin();
+
+        std::transform(srcRow.begin(),srcRow.end(),dstRow.begin(),functor);
+
+        return true;
+    }
+
+    auto srcRowIterator = srcRows.begin();
+    auto dstRowIterator = dstRows.begin();
+
+    for(; srcRowIterator != srcRows.end(); ++srcRowIterator,++dstRowIterator)
+    {
+        auto srcRow = *srcRowIterator;
+
+        std::transform(srcRow.begin(),srcRow.end(),(*dstRowIterator).begin(),functor);
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEROWITERATORS_HPP
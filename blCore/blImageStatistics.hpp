@@ -0,0 +1,1296 @@
+#ifndef BL_IMAGESTATISTICS_HPP
+#define BL_IMAGESTATISTICS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageStatistics.hpp
+// CLASS:           blImageStatistics
+// BASE CLASS:      None
+//
+// PURPOSE:         - A reduction engine that computes the mean,
+//                    variance, standard deviation, minimum and maximum
+//                    of an image ROI (and the locations of the minimum
+//                    and maximum) in one single pass
+//                  - Each row is reduced with shifted sums (vectorized
+//                    for float, double and unsigned char images), and
+//                    rows and row blocks are merged with Chan's
+//                    pairwise formula, which keeps the variance
+//                    numerically stable
+//                  - Big images are split in row blocks, reduced in
+//                    parallel by the tile thread pool
+//                  - The mean, variance, stdDev, min, max and minmax
+//                    functions in blImageOperators.hpp are thin
+//                    wrappers around this engine
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blImage and its dependencies
+//                  - blSimdKernels
+//                  - blTileThreadPool -- Used to reduce the row
+//                                        blocks in parallel
+//
+// NOTES:           - Natively arithmetic types are accumulated in
+//                    double precision, complex and blColor3 types in
+//                    complex<double> and blColor3<double>
+//                  - The locations of the minimum and maximum are
+//                    relative to the ROI, and they point to the first
+//                    occurrence in row order.  They are only computed
+//                    for arithmetic types, (-1,-1) otherwise
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blStatisticsEnum {BL_STATISTICS_MEAN = 1,
+                       BL_STATISTICS_VARIANCE = 2,
+                       BL_STATISTICS_MIN = 4,
+                       BL_STATISTICS_MAX = 8,
+                       BL_STATISTICS_ALL = 15};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions are used to
+// define what we mean by minimum and
+// maximum when dealing with any type of
+// image, including images of multiple
+// channels
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void min(const blDataType& value1,
+                const blDataType& value2,
+                blDataType& minValue)
+{
+    minValue = std::min(value1,value2);
+}
+
+
+template<typename blDataType>
+inline void min(const std::complex< blDataType >& value1,
+                const std::complex< blDataType >& value2,
+                std::complex< blDataType >& minValue)
+{
+    minValue.real(std::min(value1.real(),value2.real()));
+    minValue.imag(std::min(value1.imag(),value2.imag()));
+}
+
+
+inline void min(const CvPoint& value1,
+                const CvPoint& value2,
+                CvPoint& minValue)
+{
+    minValue.x = std::min(value1.x,value2.x);
+    minValue.y = std::min(value1.y,value2.y);
+}
+
+
+inline void min(const CvPoint2D32f& value1,
+                const CvPoint2D32f& value2,
+                CvPoint2D32f& minValue)
+{
+    minValue.x = std::min(value1.x,value2.x);
+    minValue.y = std::min(value1.y,value2.y);
+}
+
+
+inline void min(const CvPoint2D64f& value1,
+                const CvPoint2D64f& value2,
+                CvPoint2D64f& minValue)
+{
+    minValue.x = std::min(value1.x,value2.x);
+    minValue.y = std::min(value1.y,value2.y);
+}
+
+
+inline void min(const CvPoint3D32f& value1,
+                const CvPoint3D32f& value2,
+                CvPoint3D32f& minValue)
+{
+    minValue.x = std::min(value1.x,value2.x);
+    minValue.y = std::min(value1.y,value2.y);
+    minValue.z = std::min(value1.z,value2.z);
+}
+
+
+inline void min(const CvPoint3D64f& value1,
+                const CvPoint3D64f& value2,
+                CvPoint3D64f& minValue)
+{
+    minValue.x = std::min(value1.x,value2.x);
+    minValue.y = std::min(value1.y,value2.y);
+    minValue.z = std::min(value1.z,value2.z);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void max(const blDataType& value1,
+                const blDataType& value2,
+                blDataType& maxValue)
+{
+    maxValue = std::max(value1,value2);
+}
+
+
+template<typename blDataType>
+inline void max(const std::complex< blDataType >& value1,
+                const std::complex< blDataType >& value2,
+                std::complex< blDataType >& maxValue)
+{
+    maxValue.real(std::max(value1.real(),value2.real()));
+    maxValue.imag(std::max(value1.imag(),value2.imag()));
+}
+
+
+inline void max(const CvPoint& value1,
+                const CvPoint& value2,
+                CvPoint& maxValue)
+{
+    maxValue.x = std::max(value1.x,value2.x);
+    maxValue.y = std::max(value1.y,value2.y);
+}
+
+
+inline void max(const CvPoint2D32f& value1,
+                const CvPoint2D32f& value2,
+                CvPoint2D32f& maxValue)
+{
+    maxValue.x = std::max(value1.x,value2.x);
+    maxValue.y = std::max(value1.y,value2.y);
+}
+
+
+inline void max(const CvPoint2D64f& value1,
+                const CvPoint2D64f& value2,
+                CvPoint2D64f& maxValue)
+{
+    maxValue.x = std::max(value1.x,value2.x);
+    maxValue.y = std::max(value1.y,value2.y);
+}
+
+
+inline void max(const CvPoint3D32f& value1,
+                const CvPoint3D32f& value2,
+                CvPoint3D32f& maxValue)
+{
+    maxValue.x = std::max(value1.x,value2.x);
+    maxValue.y = std::max(value1.y,value2.y);
+    maxValue.z = std::max(value1.z,value2.z);
+}
+
+
+inline void max(const CvPoint3D64f& value1,
+                const CvPoint3D64f& value2,
+                CvPoint3D64f& maxValue)
+{
+    maxValue.x = std::max(value1.x,value2.x);
+    maxValue.y = std::max(value1.y,value2.y);
+    maxValue.z = std::max(value1.z,value2.z);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures define the
+// type used to accumulate the sums of
+// each image type
+//-------------------------------------------------------------------
+template<typename blDataType,
+         bool isDataTypeArithmetic = std::is_arithmetic<blDataType>::value>
+struct blStatisticsAccumulator
+{
+    typedef blDataType                          type;
+};
+
+
+template<typename blDataType>
+struct blStatisticsAccumulator<blDataType,true>
+{
+    typedef double                              type;
+};
+
+
+template<typename blDataType>
+struct blStatisticsAccumulator<std::complex<blDataType>,false>
+{
+    typedef std::complex<double>                type;
+};
+
+
+template<typename blDataType>
+struct blStatisticsAccumulator<blColor3<blDataType>,false>
+{
+    typedef blColor3<double>                    type;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to take the square
+// root of an accumulated variance
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blDataType statisticsSqrt(const blDataType& value)
+{
+    using std::sqrt;
+
+    return sqrt(value);
+}
+
+
+inline blColor3<double> statisticsSqrt(const blColor3<double>& value)
+{
+    return blColor3<double>(std::sqrt(value.m_blue),
+                            std::sqrt(value.m_green),
+                            std::sqrt(value.m_red));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions update a
+// running minimum/maximum and its
+// location (only arithmetic types
+// keep track of the location)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void updateMinimum(const blDataType& value,
+                          const CvPoint& location,
+                          blDataType& minValue,
+                          CvPoint& minLocation,
+                          std::true_type)
+{
+    if(value < minValue)
+    {
+        minValue = value;
+        minLocation = location;
+    }
+}
+
+
+template<typename blDataType>
+
+inline void updateMinimum(const blDataType& value,
+                          const CvPoint&,
+                          blDataType& minValue,
+                          CvPoint&,
+                          std::false_type)
+{
+    min(value,minValue,minValue);
+}
+
+
+template<typename blDataType>
+
+inline void updateMaximum(const blDataType& value,
+                          const CvPoint& location,
+                          blDataType& maxValue,
+                          CvPoint& maxLocation,
+                          std::true_type)
+{
+    if(value > maxValue)
+    {
+        maxValue = value;
+        maxLocation = location;
+    }
+}
+
+
+template<typename blDataType>
+
+inline void updateMaximum(const blDataType& value,
+                          const CvPoint&,
+                          blDataType& maxValue,
+                          CvPoint&,
+                          std::false_type)
+{
+    max(value,maxValue,maxValue);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The structure holding the statistics
+// of an image ROI (or of a block of it)
+//-------------------------------------------------------------------
+template<typename blDataType>
+class blImageStatistics
+{
+public: // Public typedefs
+
+    typedef typename blStatisticsAccumulator<blDataType>::type          accumulator_type;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blImageStatistics();
+
+    // Destructor
+
+    ~blImageStatistics()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to reset
+    // the statistics
+
+    void                                        reset();
+
+    // Functions used to merge the
+    // statistics of another block of
+    // elements into these ones
+    // (Chan et al. pairwise formula
+    // for the mean and variance)
+
+    void                                        merge(const blImageStatistics<blDataType>& statistics);
+
+    void                                        mergeMoments(const int& count,
+                                                             const accumulator_type& mean,
+                                                             const accumulator_type& sumOfSquaredDeviations);
+
+    void                                        mergeMinimum(const blDataType& value,
+                                                             const CvPoint& location);
+
+    void                                        mergeMaximum(const blDataType& value,
+                                                             const CvPoint& location);
+
+    // Functions used to get the
+    // sample variance (divided by
+    // n - 1) and standard deviation
+
+    accumulator_type                            variance()const;
+    accumulator_type                            stdDev()const;
+
+public: // Public variables
+
+    // Number of elements, mean and
+    // sum of squared deviations from
+    // the mean
+
+    int                                         m_count;
+    accumulator_type                            m_mean;
+    accumulator_type                            m_sumOfSquaredDeviations;
+
+    // Minimum and maximum values
+    // and their locations
+
+    bool                                        m_isMinSet;
+    bool                                        m_isMaxSet;
+
+    blDataType                                  m_min;
+    blDataType                                  m_max;
+
+    CvPoint                                     m_minLocation;
+    CvPoint                                     m_maxLocation;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blImageStatistics<blDataType>::blImageStatistics()
+{
+    reset();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageStatistics<blDataType>::reset()
+{
+    m_count = 0;
+    m_mean = accumulator_type(0);
+    m_sumOfSquaredDeviations = accumulator_type(0);
+
+    m_isMinSet = false;
+    m_isMaxSet = false;
+
+    m_min = blDataType();
+    m_max = blDataType();
+
+    m_minLocation = cvPoint(-1,-1);
+    m_maxLocation = cvPoint(-1,-1);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageStatistics<blDataType>::merge(const blImageStatistics<blDataType>& statistics)
+{
+    mergeMoments(statistics.m_count,
+                 statistics.m_mean,
+                 statistics.m_sumOfSquaredDeviations);
+
+    if(statistics.m_isMinSet)
+        mergeMinimum(statistics.m_min,statistics.m_minLocation);
+
+    if(statistics.m_isMaxSet)
+        mergeMaximum(statistics.m_max,statistics.m_maxLocation);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageStatistics<blDataType>::mergeMoments(const int& count,
+                                                        const accumulator_type& mean,
+                                                        const accumulator_type& sumOfSquaredDeviations)
+{
+    if(count <= 0)
+        return;
+
+    if(m_count == 0)
+    {
+        m_count = count;
+        m_mean = mean;
+        m_sumOfSquaredDeviations = sumOfSquaredDeviations;
+
+        return;
+    }
+
+    double totalCount = double(m_count) + double(count);
+
+    accumulator_type meanDifference = mean - m_mean;
+
+    m_mean += meanDifference * (double(count) / totalCount);
+
+    m_sumOfSquaredDeviations += sumOfSquaredDeviations +
+                                meanDifference * meanDifference * (double(m_count) * double(count) / totalCount);
+
+    m_count += count;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageStatistics<blDataType>::mergeMinimum(const blDataType& value,
+                                                        const CvPoint& location)
+{
+    if(!m_isMinSet)
+    {
+        m_min = value;
+        m_minLocation = std::is_arithmetic<blDataType>::value ? location : cvPoint(-1,-1);
+        m_isMinSet = true;
+    }
+    else
+        updateMinimum(value,location,m_min,m_minLocation,std::is_arithmetic<blDataType>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blImageStatistics<blDataType>::mergeMaximum(const blDataType& value,
+                                                        const CvPoint& location)
+{
+    if(!m_isMaxSet)
+    {
+        m_max = value;
+        m_maxLocation = std::is_arithmetic<blDataType>::value ? location : cvPoint(-1,-1);
+        m_isMaxSet = true;
+    }
+    else
+        updateMaximum(value,location,m_max,m_maxLocation,std::is_arithmetic<blDataType>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline typename blImageStatistics<blDataType>::accumulator_type blImageStatistics<blDataType>::variance()const
+{
+    if(m_count < 2)
+        return accumulator_type(0);
+
+    return ( m_sumOfSquaredDeviations / double(m_count - 1) );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline typename blImageStatistics<blDataType>::accumulator_type blImageStatistics<blDataType>::stdDev()const
+{
+    return statisticsSqrt(variance());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions vectorize the
+// shifted sums and the minimum/maximum
+// of a row, they return the number of
+// elements processed, leaving the tail
+// to the caller
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+inline double horizontalSumSSE2(const __m128d& values)
+{
+    double lanes[2];
+    _mm_storeu_pd(lanes,values);
+
+    return (lanes[0] + lanes[1]);
+}
+
+
+BL_SIMD_TARGET_AVX2 inline double horizontalSumAVX2(const __m256d& values)
+{
+    double lanes[4];
+    _mm256_storeu_pd(lanes,values);
+
+    return ( (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) );
+}
+
+
+inline int statisticsRowSumsSSE2(const double* row,
+                                 const int& numOfElements,
+                                 const double& shift,
+                                 double& sum,
+                                 double& sumOfSquares)
+{
+    __m128d shiftValues = _mm_set1_pd(shift);
+    __m128d sumValues = _mm_setzero_pd();
+    __m128d sumOfSquaresValues = _mm_setzero_pd();
+
+    int i = 0;
+
+    for(; i + 2 <= numOfElements; i += 2)
+    {
+        __m128d differences = _mm_sub_pd(_mm_loadu_pd(row + i),shiftValues);
+
+        sumValues = _mm_add_pd(sumValues,differences);
+        sumOfSquaresValues = _mm_add_pd(sumOfSquaresValues,_mm_mul_pd(differences,differences));
+    }
+
+    sum += horizontalSumSSE2(sumValues);
+    sumOfSquares += horizontalSumSSE2(sumOfSquaresValues);
+
+    return i;
+}
+
+
+inline int statisticsRowSumsSSE2(const float* row,
+                                 const int& numOfElements,
+                                 const double& shift,
+                                 double& sum,
+                                 double& sumOfSquares)
+{
+    // The floats are widened to
+    // doubles before being summed
+
+    __m128d shiftValues = _mm_set1_pd(shift);
+    __m128d sumValues = _mm_setzero_pd();
+    __m128d sumOfSquaresValues = _mm_setzero_pd();
+
+    int i = 0;
+
+    for(; i + 4 <= numOfElements; i += 4)
+    {
+        __m128 values = _mm_loadu_ps(row + i);
+
+        __m128d differences1 = _mm_sub_pd(_mm_cvtps_pd(values),shiftValues);
+        __m128d differences2 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(values,values)),shiftValues);
+
+        sumValues = _mm_add_pd(sumValues,_mm_add_pd(differences1,differences2));
+        sumOfSquaresValues = _mm_add_pd(sumOfSquaresValues,_mm_add_pd(_mm_mul_pd(differences1,differences1),
+                                                                      _mm_mul_pd(differences2,differences2)));
+    }
+
+    sum += horizontalSumSSE2(sumValues);
+    sumOfSquares += horizontalSumSSE2(sumOfSquaresValues);
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowSumsAVX2(const double* row,
+                                                     const int& numOfElements,
+                                                     const double& shift,
+                                                     double& sum,
+                                                     double& sumOfSquares)
+{
+    __m256d shiftValues = _mm256_set1_pd(shift);
+    __m256d sumValues = _mm256_setzero_pd();
+    __m256d sumOfSquaresValues = _mm256_setzero_pd();
+
+    int i = 0;
+
+    for(; i + 4 <= numOfElements; i += 4)
+    {
+        __m256d differences = _mm256_sub_pd(_mm256_loadu_pd(row + i),shiftValues);
+
+        sumValues = _mm256_add_pd(sumValues,differences);
+        sumOfSquaresValues = _mm256_add_pd(sumOfSquaresValues,_mm256_mul_pd(differences,differences));
+    }
+
+    sum += horizontalSumAVX2(sumValues);
+    sumOfSquares += horizontalSumAVX2(sumOfSquaresValues);
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowSumsAVX2(const float* row,
+                                                     const int& numOfElements,
+                                                     const double& shift,
+                                                     double& sum,
+                                                     double& sumOfSquares)
+{
+    __m256d shiftValues = _mm256_set1_pd(shift);
+    __m256d sumValues = _mm256_setzero_pd();
+    __m256d sumOfSquaresValues = _mm256_setzero_pd();
+
+    int i = 0;
+
+    for(; i + 4 <= numOfElements; i += 4)
+    {
+        __m256d differences = _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(row + i)),shiftValues);
+
+        sumValues = _mm256_add_pd(sumValues,differences);
+        sumOfSquaresValues = _mm256_add_pd(sumOfSquaresValues,_mm256_mul_pd(differences,differences));
+    }
+
+    sum += horizontalSumAVX2(sumValues);
+    sumOfSquares += horizontalSumAVX2(sumOfSquaresValues);
+
+    return i;
+}
+
+
+inline int statisticsRowSumsSSE2(const unsigned char* row,
+                                 const int& numOfElements,
+                                 unsigned long long& sum,
+                                 unsigned long long& sumOfSquares)
+{
+    // Bytes are summed exactly, with
+    // sad for the sums and madd for
+    // the sums of squares
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i sumValues = _mm_setzero_si128();
+    __m128i sumOfSquaresValues = _mm_setzero_si128();
+
+    int i = 0;
+
+    for(; i + 16 <= numOfElements; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+
+        __m128i low = _mm_unpacklo_epi8(values,zero);
+        __m128i high = _mm_unpackhi_epi8(values,zero);
+
+        __m128i squares = _mm_add_epi32(_mm_madd_epi16(low,low),_mm_madd_epi16(high,high));
+
+        sumValues = _mm_add_epi64(sumValues,_mm_sad_epu8(values,zero));
+        sumOfSquaresValues = _mm_add_epi64(sumOfSquaresValues,_mm_add_epi64(_mm_unpacklo_epi32(squares,zero),
+                                                                            _mm_unpackhi_epi32(squares,zero)));
+    }
+
+    unsigned long long lanes[2];
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes),sumValues);
+    sum += lanes[0] + lanes[1];
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes),sumOfSquaresValues);
+    sumOfSquares += lanes[0] + lanes[1];
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowSumsAVX2(const unsigned char* row,
+                                                     const int& numOfElements,
+                                                     unsigned long long& sum,
+                                                     unsigned long long& sumOfSquares)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i sumValues = _mm256_setzero_si256();
+    __m256i sumOfSquaresValues = _mm256_setzero_si256();
+
+    int i = 0;
+
+    for(; i + 32 <= numOfElements; i += 32)
+    {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+
+        __m256i low = _mm256_unpacklo_epi8(values,zero);
+        __m256i high = _mm256_unpackhi_epi8(values,zero);
+
+        __m256i squares = _mm256_add_epi32(_mm256_madd_epi16(low,low),_mm256_madd_epi16(high,high));
+
+        sumValues = _mm256_add_epi64(sumValues,_mm256_sad_epu8(values,zero));
+        sumOfSquaresValues = _mm256_add_epi64(sumOfSquaresValues,_mm256_add_epi64(_mm256_unpacklo_epi32(squares,zero),
+                                                                                  _mm256_unpackhi_epi32(squares,zero)));
+    }
+
+    unsigned long long lanes[4];
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),sumValues);
+    sum += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),sumOfSquaresValues);
+    sumOfSquares += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    return i;
+}
+
+
+inline int statisticsRowMinMaxSSE2(const double* row,
+                                   const int& numOfElements,
+                                   double& minValue,
+                                   double& maxValue)
+{
+    __m128d minValues = _mm_set1_pd(minValue);
+    __m128d maxValues = _mm_set1_pd(maxValue);
+
+    int i = 0;
+
+    for(; i + 2 <= numOfElements; i += 2)
+    {
+        __m128d values = _mm_loadu_pd(row + i);
+
+        minValues = _mm_min_pd(minValues,values);
+        maxValues = _mm_max_pd(maxValues,values);
+    }
+
+    double lanes[2];
+
+    _mm_storeu_pd(lanes,minValues);
+    minValue = std::min(lanes[0],lanes[1]);
+
+    _mm_storeu_pd(lanes,maxValues);
+    maxValue = std::max(lanes[0],lanes[1]);
+
+    return i;
+}
+
+
+inline int statisticsRowMinMaxSSE2(const float* row,
+                                   const int& numOfElements,
+                                   float& minValue,
+                                   float& maxValue)
+{
+    __m128 minValues = _mm_set1_ps(minValue);
+    __m128 maxValues = _mm_set1_ps(maxValue);
+
+    int i = 0;
+
+    for(; i + 4 <= numOfElements; i += 4)
+    {
+        __m128 values = _mm_loadu_ps(row + i);
+
+        minValues = _mm_min_ps(minValues,values);
+        maxValues = _mm_max_ps(maxValues,values);
+    }
+
+    float lanes[4];
+
+    _mm_storeu_ps(lanes,minValues);
+    minValue = std::min(std::min(lanes[0],lanes[1]),std::min(lanes[2],lanes[3]));
+
+    _mm_storeu_ps(lanes,maxValues);
+    maxValue = std::max(std::max(lanes[0],lanes[1]),std::max(lanes[2],lanes[3]));
+
+    return i;
+}
+
+
+inline int statisticsRowMinMaxSSE2(const unsigned char* row,
+                                   const int& numOfElements,
+                                   unsigned char& minValue,
+                                   unsigned char& maxValue)
+{
+    __m128i minValues = _mm_set1_epi8(static_cast<char>(minValue));
+    __m128i maxValues = _mm_set1_epi8(static_cast<char>(maxValue));
+
+    int i = 0;
+
+    for(; i + 16 <= numOfElements; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+
+        minValues = _mm_min_epu8(minValues,values);
+        maxValues = _mm_max_epu8(maxValues,values);
+    }
+
+    unsigned char lanes[16];
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes),minValues);
+    minValue = *std::min_element(lanes,lanes + 16);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes),maxValues);
+    maxValue = *std::max_element(lanes,lanes + 16);
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowMinMaxAVX2(const double* row,
+                                                       const int& numOfElements,
+                                                       double& minValue,
+                                                       double& maxValue)
+{
+    __m256d minValues = _mm256_set1_pd(minValue);
+    __m256d maxValues = _mm256_set1_pd(maxValue);
+
+    int i = 0;
+
+    for(; i + 4 <= numOfElements; i += 4)
+    {
+        __m256d values = _mm256_loadu_pd(row + i);
+
+        minValues = _mm256_min_pd(minValues,values);
+        maxValues = _mm256_max_pd(maxValues,values);
+    }
+
+    double lanes[4];
+
+    _mm256_storeu_pd(lanes,minValues);
+    minValue = *std::min_element(lanes,lanes + 4);
+
+    _mm256_storeu_pd(lanes,maxValues);
+    maxValue = *std::max_element(lanes,lanes + 4);
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowMinMaxAVX2(const float* row,
+                                                       const int& numOfElements,
+                                                       float& minValue,
+                                                       float& maxValue)
+{
+    __m256 minValues = _mm256_set1_ps(minValue);
+    __m256 maxValues = _mm256_set1_ps(maxValue);
+
+    int i = 0;
+
+    for(; i + 8 <= numOfElements; i += 8)
+    {
+        __m256 values = _mm256_loadu_ps(row + i);
+
+        minValues = _mm256_min_ps(minValues,values);
+        maxValues = _mm256_max_ps(maxValues,values);
+    }
+
+    float lanes[8];
+
+    _mm256_storeu_ps(lanes,minValues);
+    minValue = *std::min_element(lanes,lanes + 8);
+
+    _mm256_storeu_ps(lanes,maxValues);
+    maxValue = *std::max_element(lanes,lanes + 8);
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int statisticsRowMinMaxAVX2(const unsigned char* row,
+                                                       const int& numOfElements,
+                                                       unsigned char& minValue,
+                                                       unsigned char& maxValue)
+{
+    __m256i minValues = _mm256_set1_epi8(static_cast<char>(minValue));
+    __m256i maxValues = _mm256_set1_epi8(static_cast<char>(maxValue));
+
+    int i = 0;
+
+    for(; i + 32 <= numOfElements; i += 32)
+    {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+
+        minValues = _mm256_min_epu8(minValues,values);
+        maxValues = _mm256_max_epu8(maxValues,values);
+    }
+
+    unsigned char lanes[32];
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),minValues);
+    minValue = *std::min_element(lanes,lanes + 32);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),maxValues);
+    maxValue = *std::max_element(lanes,lanes + 32);
+
+    return i;
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures reduce one
+// row of an image into a block's
+// statistics, the generic one works
+// element by element for any type
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blStatisticsRowKernel
+{
+    typedef typename blStatisticsAccumulator<blDataType>::type          accumulator_type;
+
+    static void accumulateMoments(const blDataType* row,
+                                  const int& numOfElements,
+                                  blImageStatistics<blDataType>& statistics)
+    {
+        // We sum the values shifted by
+        // the first value of the row to
+        // avoid catastrophic cancellation
+
+        accumulator_type shift = accumulator_type(row[0]);
+        accumulator_type sum = accumulator_type(0);
+        accumulator_type sumOfSquares = accumulator_type(0);
+
+        for(int j = 0; j < numOfElements; ++j)
+        {
+            accumulator_type difference = accumulator_type(row[j]) - shift;
+
+            sum += difference;
+            sumOfSquares += difference * difference;
+        }
+
+        double count = double(numOfElements);
+
+        statistics.mergeMoments(numOfElements,
+                                shift + sum / count,
+                                sumOfSquares - sum * sum / count);
+    }
+
+    static void accumulateMinMax(const blDataType* row,
+                                 const int& numOfElements,
+                                 const int& rowIndex,
+                                 const bool& shouldMinBeComputed,
+                                 const bool& shouldMaxBeComputed,
+                                 blImageStatistics<blDataType>& statistics)
+    {
+        for(int j = 0; j < numOfElements; ++j)
+        {
+            if(shouldMinBeComputed)
+                statistics.mergeMinimum(row[j],cvPoint(j,rowIndex));
+
+            if(shouldMaxBeComputed)
+                statistics.mergeMaximum(row[j],cvPoint(j,rowIndex));
+        }
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The vectorized row kernel used for
+// float, double and unsigned char images
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blStatisticsNativeRowKernel
+{
+    static void accumulateMoments(const blDataType* row,
+                                  const int& numOfElements,
+                                  blImageStatistics<blDataType>& statistics)
+    {
+        double shift = double(row[0]);
+        double sum = 0;
+        double sumOfSquares = 0;
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                j = statisticsRowSumsAVX2(row,numOfElements,shift,sum,sumOfSquares);
+            else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = statisticsRowSumsSSE2(row,numOfElements,shift,sum,sumOfSquares);
+
+        #endif
+
+        for(; j < numOfElements; ++j)
+        {
+            double difference = double(row[j]) - shift;
+
+            sum += difference;
+            sumOfSquares += difference * difference;
+        }
+
+        double count = double(numOfElements);
+
+        statistics.mergeMoments(numOfElements,
+                                shift + sum / count,
+                                sumOfSquares - sum * sum / count);
+    }
+
+    static void accumulateMinMax(const blDataType* row,
+                                 const int& numOfElements,
+                                 const int& rowIndex,
+                                 const bool& shouldMinBeComputed,
+                                 const bool& shouldMaxBeComputed,
+                                 blImageStatistics<blDataType>& statistics)
+    {
+        blDataType minValue = row[0];
+        blDataType maxValue = row[0];
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                j = statisticsRowMinMaxAVX2(row,numOfElements,minValue,maxValue);
+            else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = statisticsRowMinMaxSSE2(row,numOfElements,minValue,maxValue);
+
+        #endif
+
+        for(; j < numOfElements; ++j)
+        {
+            minValue = std::min(minValue,row[j]);
+            maxValue = std::max(maxValue,row[j]);
+        }
+
+        mergeRowMinMax(row,numOfElements,rowIndex,minValue,maxValue,shouldMinBeComputed,shouldMaxBeComputed,statistics);
+    }
+
+    static void mergeRowMinMax(const blDataType* row,
+                               const int& numOfElements,
+                               const int& rowIndex,
+                               const blDataType& minValue,
+                               const blDataType& maxValue,
+                               const bool& shouldMinBeComputed,
+                               const bool& shouldMaxBeComputed,
+                               blImageStatistics<blDataType>& statistics)
+    {
+        // We only look for the location
+        // of the row's minimum/maximum when
+        // it beats the current one
+
+        if(shouldMinBeComputed && (!statistics.m_isMinSet || minValue < statistics.m_min))
+        {
+            int location = int(std::find(row,row + numOfElements,minValue) - row);
+            statistics.mergeMinimum(minValue,cvPoint(location,rowIndex));
+        }
+
+        if(shouldMaxBeComputed && (!statistics.m_isMaxSet || maxValue > statistics.m_max))
+        {
+            int location = int(std::find(row,row + numOfElements,maxValue) - row);
+            statistics.mergeMaximum(maxValue,cvPoint(location,rowIndex));
+        }
+    }
+};
+
+
+template<>
+struct blStatisticsRowKernel<float> : public blStatisticsNativeRowKernel<float>
+{
+};
+
+
+template<>
+struct blStatisticsRowKernel<double> : public blStatisticsNativeRowKernel<double>
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The unsigned char row kernel only
+// differs in its sums, which are
+// exact integers
+//-------------------------------------------------------------------
+template<>
+struct blStatisticsRowKernel<unsigned char> : public blStatisticsNativeRowKernel<unsigned char>
+{
+    static void accumulateMoments(const unsigned char* row,
+                                  const int& numOfElements,
+                                  blImageStatistics<unsigned char>& statistics)
+    {
+        unsigned long long sum = 0;
+        unsigned long long sumOfSquares = 0;
+
+        int j = 0;
+
+        #if defined(BL_USE_SIMD_X86)
+
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                j = statisticsRowSumsAVX2(row,numOfElements,sum,sumOfSquares);
+            else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+                j = statisticsRowSumsSSE2(row,numOfElements,sum,sumOfSquares);
+
+        #endif
+
+        for(; j < numOfElements; ++j)
+        {
+            sum += row[j];
+            sumOfSquares += (unsigned long long)(row[j]) * row[j];
+        }
+
+        // n * sum of squares - sum^2 is
+        // computed exactly in integers
+
+        unsigned long long count = (unsigned long long)(numOfElements);
+
+        statistics.mergeMoments(numOfElements,
+                                double(sum) / double(count),
+                                double(count * sumOfSquares - sum * sum) / double(count));
+    }
+};
+
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to reduce a block of
+// rows of the image ROI
+// (rows are relative to the ROI)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void computeStatisticsOfRows(const blImage<blDataType>& srcImage,
+                                    const int& firstRow,
+                                    const int& lastRow,
+                                    const int& whatToCompute,
+                                    blImageStatistics<blDataType>& statistics)
+{
+    statistics.reset();
+
+    int cols = srcImage.size2ROI();
+    int yROI = srcImage.yROI();
+    int xROI = srcImage.xROI();
+
+    bool shouldMomentsBeComputed = ( (whatToCompute & (BL_STATISTICS_MEAN | BL_STATISTICS_VARIANCE)) != 0 );
+    bool shouldMinBeComputed = ( (whatToCompute & BL_STATISTICS_MIN) != 0 );
+    bool shouldMaxBeComputed = ( (whatToCompute & BL_STATISTICS_MAX) != 0 );
+
+    for(int i = firstRow; i < lastRow; ++i)
+    {
+        const blDataType* row = srcImage[i + yROI] + xROI;
+
+        if(shouldMomentsBeComputed)
+            blStatisticsRowKernel<blDataType>::accumulateMoments(row,cols,statistics);
+
+        if(shouldMinBeComputed || shouldMaxBeComputed)
+        {
+            blStatisticsRowKernel<blDataType>::accumulateMinMax(row,
+                                                                cols,
+                                                                i,
+                                                                shouldMinBeComputed,
+                                                                shouldMaxBeComputed,
+                                                                statistics);
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to compute the statistics
+// of an image ROI in one single pass
+// - "whatToCompute" is a combination of
+//   the blStatisticsEnum flags
+// - Images with at least twice
+//   "minNumOfElementsPerThread" elements
+//   are split in row blocks reduced by
+//   the tile thread pool (maxNumOfThreads
+//   = 0 means use the pool's cap)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline void computeStatistics(const blImage<blDataType>& srcImage,
+                              blImageStatistics<blDataType>& statistics,
+                              const int& whatToCompute = BL_STATISTICS_ALL,
+                              const int& maxNumOfThreads = 0,
+                              const int& minNumOfElementsPerThread = 65536)
+{
+    statistics.reset();
+
+    int rows = srcImage.size1ROI();
+    int cols = srcImage.size2ROI();
+
+    if(rows <= 0 || cols <= 0)
+        return;
+
+    // We figure out how many
+    // row blocks are worth
+    // reducing in parallel
+
+    blTileThreadPool& pool = getTileThreadPool();
+
+    int numOfBlocks = pool.getNumOfThreads();
+
+    if(pool.getMaxNumOfThreads() > 0)
+        numOfBlocks = std::min(numOfBlocks,pool.getMaxNumOfThreads());
+
+    if(maxNumOfThreads > 0)
+        numOfBlocks = std::min(numOfBlocks,maxNumOfThreads);
+
+    numOfBlocks = std::min(numOfBlocks,(rows * cols) / std::max(minNumOfElementsPerThread,1));
+    numOfBlocks = std::min(numOfBlocks,rows);
+
+    if(numOfBlocks <= 1)
+    {
+        computeStatisticsOfRows(srcImage,0,rows,whatToCompute,statistics);
+        return;
+    }
+
+    // Each task reduces its own
+    // block of rows into its own
+    // partial statistics
+
+    std::vector< blImageStatistics<blDataType> > blockStatistics(numOfBlocks);
+
+    pool.runTasks(numOfBlocks,[&](int block)
+    {
+        computeStatisticsOfRows(srcImage,
+                                (rows * block) / numOfBlocks,
+                                (rows * (block + 1)) / numOfBlocks,
+                                whatToCompute,
+                                blockStatistics[block]);
+    },maxNumOfThreads);
+
+    // We merge the blocks in row
+    // order, so that ties keep the
+    // first location
+
+    for(int block = 0; block < numOfBlocks; ++block)
+        statistics.merge(blockStatistics[block]);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImageStatistics<blDataType> computeStatistics(const blImage<blDataType>& srcImage,
+                                                       const int& whatToCompute = BL_STATISTICS_ALL)
+{
+    blImageStatistics<blDataType> statistics;
+
+    computeStatistics(srcImage,statistics,whatToCompute);
+
+    return statistics;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGESTATISTICS_HPP
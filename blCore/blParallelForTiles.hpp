@@ -0,0 +1,652 @@
+#ifndef BL_PARALLELFORTILES_HPP
+#define BL_PARALLELFORTILES_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blParallelForTiles.hpp
+// CLASS:           blImageTile
+//                  blTileThreadPool
+// BASE CLASS:      None
+//
+// PURPOSE:         - Defines a shared pool of worker threads and a
+//                    work-stealing scheduler used to run an
+//                    algorithm over the tiles of an image ROI
+//                  - parallelForTiles splits a ROI into tiles,
+//                    hands every participating thread a contiguous
+//                    block of tiles, and threads that run out of
+//                    tiles steal half of the remaining tiles of
+//                    another thread
+//                  - The functor receives a blImageTile expressed
+//                    in ROI coordinates, and getTileRows turns it
+//                    into a row range that respects the image's
+//                    widthStep and ROI
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    <atomic>
+//                  <condition_variable>
+//                  <functional>
+//                  <mutex>
+//                  <thread>
+//                  <vector>
+//                  blImage2 and all its dependencies
+//
+// NOTES:           - The calling thread always takes part in the
+//                    work, so a pool of N threads has N - 1 workers
+//
+//                  - The "grain size" is the minimum number of
+//                    elements per tile, regions smaller than two
+//                    grains run on the calling thread in one call
+//
+//                  - The functor is called concurrently from
+//                    different threads, so it should only write
+//                    to the pixels of the tile it receives
+//
+//                  - Calling parallelForTiles from inside a tile
+//                    functor (or while another thread is using the
+//                    pool) simply runs the tiles on the calling
+//                    thread, so nested calls never deadlock
+//
+//                  - The shared pool has one thread per hardware
+//                    thread, unless BL_NUM_OF_TILE_THREADS is defined
+//                    (before including the library) to the number of
+//                    threads it should have
+//
+//                  - Example of use:
+//
+//                    parallelForTiles(img,[&](const blImageTile& tile)
+//                    {
+//                        for(auto row : getTileRows(img,tile))
+//                            std::fill(row.begin(),row.end(),value);
+//                    });
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A rectangular tile of a ROI
+// (expressed in ROI coordinates)
+//-------------------------------------------------------------------
+struct blImageTile
+{
+    int                                         m_row;
+    int                                         m_col;
+    int                                         m_numOfRows;
+    int                                         m_numOfCols;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blTileThreadPool
+{
+public: // Constructors and destructors
+
+    // Default constructor
+    // (0 means use one thread
+    // per hardware thread)
+
+    blTileThreadPool(const int& numOfThreads = 0);
+
+    // Destructor
+
+    ~blTileThreadPool();
+
+private: // Non-copyable
+
+    blTileThreadPool(const blTileThreadPool&);
+    blTileThreadPool&                           operator=(const blTileThreadPool&);
+
+public: // Public functions
+
+    // Total number of threads
+    // (workers + calling thread)
+
+    int                                         getNumOfThreads()const;
+
+    // Functions used to cap the
+    // number of threads used by
+    // every parallel call
+    // (0 means no cap)
+
+    void                                        setMaxNumOfThreads(const int& maxNumOfThreads);
+    int                                         getMaxNumOfThreads()const;
+
+    // Functions used to set/get
+    // the grain size (minimum
+    // number of elements per tile)
+
+    void                                        setGrainSize(const int& grainSize);
+    int                                         getGrainSize()const;
+
+    // Function used to run tasks
+    // [0,numOfTasks) using at most
+    // maxNumOfThreads threads
+    // (0 means use the pool's cap)
+
+    void                                        runTasks(const int& numOfTasks,
+                                                         const std::function<void(int)>& task,
+                                                         const int& maxNumOfThreads = 0);
+
+private: // Private functions
+
+    // The loop run by every worker
+
+    void                                        workerLoop(const int& workerIndex);
+
+    // Functions used to pop a task
+    // from a thread's own queue and
+    // to steal tasks from others
+
+    bool                                        popTask(const int& queueIndex,int& taskIndex);
+    bool                                        stealTasks(const int& thiefIndex);
+
+    // Function used to process
+    // tasks until no queue has
+    // any task left
+
+    void                                        processTasks(const int& queueIndex);
+
+private: // Private variables
+
+    // Every participating thread owns
+    // a block of tasks [m_begin,m_end),
+    // it pops tasks from the front
+    // while thieves take from the back
+
+    struct blTaskQueue
+    {
+        std::mutex                              m_mutex;
+        int                                     m_begin;
+        int                                     m_end;
+    };
+
+    std::vector<std::thread>                    m_workers;
+    std::vector<std::unique_ptr<blTaskQueue> >  m_queues;
+
+    // State of the current job
+
+    std::mutex                                  m_stateMutex;
+    std::condition_variable                     m_newJobCondition;
+    std::condition_variable                     m_jobDoneCondition;
+
+    const std::function<void(int)>*             m_task;
+    int                                         m_numOfParticipants;
+    int                                         m_numOfWorkersStillWorking;
+    unsigned int                                m_jobID;
+    bool                                        m_shouldWorkersStop;
+
+    // Flag used to let only one
+    // caller at a time use the pool
+
+    std::atomic<bool>                           m_isBusy;
+
+    // Settings
+
+    std::atomic<int>                            m_maxNumOfThreads;
+    std::atomic<int>                            m_grainSize;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blTileThreadPool::blTileThreadPool(const int& numOfThreads)
+                                          : m_task(nullptr),
+                                            m_numOfParticipants(0),
+                                            m_numOfWorkersStillWorking(0),
+                                            m_jobID(0),
+                                            m_shouldWorkersStop(false),
+                                            m_isBusy(false),
+                                            m_maxNumOfThreads(0),
+                                            m_grainSize(16384)
+{
+    int totalNumOfThreads = numOfThreads;
+
+    if(totalNumOfThreads <= 0)
+        totalNumOfThreads = std::max(1,int(std::thread::hardware_concurrency()));
+
+    for(int i = 0; i < totalNumOfThreads; ++i)
+        m_queues.push_back(std::unique_ptr<blTaskQueue>(new blTaskQueue()));
+
+    // The calling thread is
+    // participant 0, so we
+    // only spawn the others
+
+    for(int i = 1; i < totalNumOfThreads; ++i)
+        m_workers.push_back(std::thread(&blTileThreadPool::workerLoop,this,i));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blTileThreadPool::~blTileThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_shouldWorkersStop = true;
+    }
+
+    m_newJobCondition.notify_all();
+
+    for(auto& worker : m_workers)
+    {
+        if(worker.joinable())
+            worker.join();
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blTileThreadPool::getNumOfThreads()const
+{
+    return int(m_workers.size()) + 1;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blTileThreadPool::setMaxNumOfThreads(const int& maxNumOfThreads)
+{
+    m_maxNumOfThreads = std::max(0,maxNumOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blTileThreadPool::getMaxNumOfThreads()const
+{
+    return m_maxNumOfThreads;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blTileThreadPool::setGrainSize(const int& grainSize)
+{
+    m_grainSize = std::max(1,grainSize);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blTileThreadPool::getGrainSize()const
+{
+    return m_grainSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blTileThreadPool::runTasks(const int& numOfTasks,
+                                       const std::function<void(int)>& task,
+                                       const int& maxNumOfThreads)
+{
+    if(numOfTasks <= 0)
+        return;
+
+    // Figure out how many
+    // threads take part
+
+    int numOfParticipants = this->getNumOfThreads();
+
+    if(m_maxNumOfThreads > 0)
+        numOfParticipants = std::min(numOfParticipants,int(m_maxNumOfThreads));
+
+    if(maxNumOfThreads > 0)
+        numOfParticipants = std::min(numOfParticipants,maxNumOfThreads);
+
+    numOfParticipants = std::min(numOfParticipants,numOfTasks);
+
+    // When only one thread is needed,
+    // or when the pool is already
+    // in use (nested calls or calls
+    // from other threads), we run
+    // the tasks right here
+
+    bool isPoolFree = false;
+
+    if(numOfParticipants > 1)
+        isPoolFree = !m_isBusy.exchange(true);
+
+    if(!isPoolFree)
+    {
+        for(int i = 0; i < numOfTasks; ++i)
+            task(i);
+
+        return;
+    }
+
+    // Hand every participant
+    // a contiguous block of tasks
+
+    for(int i = 0; i < numOfParticipants; ++i)
+    {
+        std::lock_guard<std::mutex> lock(m_queues[i]->m_mutex);
+
+        m_queues[i]->m_begin = int( (long long)(numOfTasks) * i / numOfParticipants );
+        m_queues[i]->m_end = int( (long long)(numOfTasks) * (i + 1) / numOfParticipants );
+    }
+
+    // Wake up the workers
+
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        m_task = &task;
+        m_numOfParticipants = numOfParticipants;
+        m_numOfWorkersStillWorking = numOfParticipants - 1;
+        ++m_jobID;
+    }
+
+    m_newJobCondition.notify_all();
+
+    // The calling thread
+    // works as participant 0
+
+    processTasks(0);
+
+    // Wait for the workers
+    // to finish
+
+    {
+        std::unique_lock<std::mutex> lock(m_stateMutex);
+
+        m_jobDoneCondition.wait(lock,[this](){return (m_numOfWorkersStillWorking == 0);});
+
+        m_task = nullptr;
+        m_numOfParticipants = 0;
+    }
+
+    m_isBusy = false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blTileThreadPool::workerLoop(const int& workerIndex)
+{
+    unsigned int lastJobID = 0;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_stateMutex);
+
+            m_newJobCondition.wait(lock,[this,&lastJobID](){return (m_shouldWorkersStop || m_jobID != lastJobID);});
+
+            if(m_shouldWorkersStop)
+                return;
+
+            lastJobID = m_jobID;
+
+            // Workers that don't take
+            // part in this job go back
+            // to sleep
+
+            if(workerIndex >= m_numOfParticipants)
+                continue;
+        }
+
+        processTasks(workerIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_stateMutex);
+            --m_numOfWorkersStillWorking;
+        }
+
+        m_jobDoneCondition.notify_one();
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blTileThreadPool::popTask(const int& queueIndex,int& taskIndex)
+{
+    std::lock_guard<std::mutex> lock(m_queues[queueIndex]->m_mutex);
+
+    if(m_queues[queueIndex]->m_begin >= m_queues[queueIndex]->m_end)
+        return false;
+
+    taskIndex = m_queues[queueIndex]->m_begin;
+    ++m_queues[queueIndex]->m_begin;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blTileThreadPool::stealTasks(const int& thiefIndex)
+{
+    for(int i = 1; i < m_numOfParticipants; ++i)
+    {
+        int victimIndex = (thiefIndex + i) % m_numOfParticipants;
+
+        int stolenBegin = 0;
+        int stolenEnd = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(m_queues[victimIndex]->m_mutex);
+
+            int numOfRemainingTasks = m_queues[victimIndex]->m_end - m_queues[victimIndex]->m_begin;
+
+            if(numOfRemainingTasks <= 0)
+                continue;
+
+            // We take the back half
+            // (rounded up) of what's left
+
+            stolenEnd = m_queues[victimIndex]->m_end;
+            stolenBegin = stolenEnd - (numOfRemainingTasks + 1) / 2;
+            m_queues[victimIndex]->m_end = stolenBegin;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_queues[thiefIndex]->m_mutex);
+
+            m_queues[thiefIndex]->m_begin = stolenBegin;
+            m_queues[thiefIndex]->m_end = stolenEnd;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blTileThreadPool::processTasks(const int& queueIndex)
+{
+    int taskIndex = 0;
+
+    while(true)
+    {
+        if(popTask(queueIndex,taskIndex))
+            (*m_task)(taskIndex);
+        else if(!stealTasks(queueIndex))
+            break;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the pool
+// shared by the whole library
+//-------------------------------------------------------------------
+inline blTileThreadPool& getTileThreadPool()
+{
+#ifdef BL_NUM_OF_TILE_THREADS
+    static blTileThreadPool tileThreadPool(BL_NUM_OF_TILE_THREADS);
+#else
+    static blTileThreadPool tileThreadPool;
+#endif
+
+    return tileThreadPool;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function runs a
+// functor over the tiles of a
+// numOfRows x numOfCols region
+//
+// - A tile size of 0 means "automatic",
+//   which gives full width bands of
+//   rows of about one grain each
+// - maxNumOfThreads of 0 means use the
+//   pool's cap
+//-------------------------------------------------------------------
+template<typename blFunctorType>
+
+inline void parallelForTiles(const int& numOfRows,
+                             const int& numOfCols,
+                             const blFunctorType& functor,
+                             const int& tileHeight = 0,
+                             const int& tileWidth = 0,
+                             const int& maxNumOfThreads = 0)
+{
+    if(numOfRows <= 0 || numOfCols <= 0)
+        return;
+
+    blTileThreadPool& pool = getTileThreadPool();
+
+    int grainSize = pool.getGrainSize();
+
+    // Small regions are not
+    // worth waking up threads
+
+    if( (long long)(numOfRows) * numOfCols < 2LL * grainSize || maxNumOfThreads == 1 )
+    {
+        blImageTile wholeRegion = {0,0,numOfRows,numOfCols};
+        functor(wholeRegion);
+        return;
+    }
+
+    // Figure out the tile size
+
+    int tileCols = (tileWidth > 0) ? std::min(tileWidth,numOfCols) : numOfCols;
+
+    int tileRows = tileHeight;
+
+    if(tileRows <= 0)
+        tileRows = std::max(1,grainSize / tileCols);
+
+    tileRows = std::min(tileRows,numOfRows);
+
+    int numOfTileRows = (numOfRows + tileRows - 1) / tileRows;
+    int numOfTileCols = (numOfCols + tileCols - 1) / tileCols;
+
+    std::function<void(int)> task = [&](int tileIndex)
+    {
+        int tileRowIndex = tileIndex / numOfTileCols;
+        int tileColIndex = tileIndex % numOfTileCols;
+
+        blImageTile tile;
+
+        tile.m_row = tileRowIndex * tileRows;
+        tile.m_col = tileColIndex * tileCols;
+        tile.m_numOfRows = std::min(tileRows,numOfRows - tile.m_row);
+        tile.m_numOfCols = std::min(tileCols,numOfCols - tile.m_col);
+
+        functor(tile);
+    };
+
+    pool.runTasks(numOfTileRows * numOfTileCols,task,maxNumOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function runs a
+// functor over the tiles of an
+// image's ROI (the tiles are in
+// ROI coordinates)
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blFunctorType>
+
+inline void parallelForTiles(const blImage2<blDataType>& image,
+                             const blFunctorType& functor,
+                             const int& tileHeight = 0,
+                             const int& tileWidth = 0,
+                             const int& maxNumOfThreads = 0)
+{
+    parallelForTiles(image.size1ROI(),
+                     image.size2ROI(),
+                     functor,
+                     tileHeight,
+                     tileWidth,
+                     maxNumOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions return
+// the rows of a tile of an image's
+// ROI (clipped to the ROI)
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline blImageRowRange<blDataType> getTileRows(blImage2<blDataType>& image,
+                                               const blImageTile& tile)
+{
+    int numOfRows = std::min(tile.m_numOfRows,image.size1ROI() - tile.m_row);
+    int numOfCols = std::min(tile.m_numOfCols,image.size2ROI() - tile.m_col);
+
+    if(image.empty() || numOfRows <= 0 || numOfCols <= 0)
+        return blImageRowRange<blDataType>();
+
+    return blImageRowRange<blDataType>(image[image.yROI() + tile.m_row] + image.xROI() + tile.m_col,
+                                       numOfRows,
+                                       numOfCols,
+                                       image.getWidthStep());
+}
+
+
+
+template<typename blDataType>
+
+inline blImageRowRange<const blDataType> getTileRows(const blImage2<blDataType>& image,
+                                                     const blImageTile& tile)
+{
+    int numOfRows = std::min(tile.m_numOfRows,image.size1ROI() - tile.m_row);
+    int numOfCols = std::min(tile.m_numOfCols,image.size2ROI() - tile.m_col);
+
+    if(image.empty() || numOfRows <= 0 || numOfCols <= 0)
+        return blImageRowRange<const blDataType>();
+
+    return blImageRowRange<const blDataType>(image[image.yROI() + tile.m_row] + image.xROI() + tile.m_col,
+                                             numOfRows,
+                                             numOfCols,
+                                             image.getWidthStep());
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_PARALLELFORTILES_HPP
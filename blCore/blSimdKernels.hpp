@@ -0,0 +1,1129 @@
+#ifndef BL_SIMDKERNELS_HPP
+#define BL_SIMDKERNELS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSimdKernels.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         - A collection of vectorized row kernels used by
+//                    the perElementAddition/Subtraction/Multiplication
+//                    and Division functions for float, double,
+//                    unsigned char and blColor3<unsigned char> images
+//                  - The instruction set (SSE2 or AVX2) is picked at
+//                    run time, with a plain scalar loop used for the
+//                    row tails and when no instruction set is available
+//                  - Unsigned char kernels (and therefore blColor3
+//                    <unsigned char> kernels) use saturating
+//                    arithmetic, so results are clamped to [0,255]
+//                    instead of wrapping around
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - <immintrin.h> (included by blImageAPI.hpp when
+//                    compiling for x86 and BL_DISABLE_SIMD is not
+//                    defined)
+//                  - blColor3
+//
+// NOTES:           - Unsigned char divisions are carried out in single
+//                    precision and truncated, which gives the same
+//                    result as the integer division, while a division
+//                    by zero saturates to 255
+//                  - Unsigned char operations with a fractional scalar
+//                    are carried out in single precision and truncated
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+// The gcc and clang compilers need
+// the target attribute to compile
+// avx2 intrinsics in functions that
+// are only called after checking
+// that the cpu supports them
+
+#if defined(BL_USE_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define BL_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define BL_SIMD_TARGET_AVX2
+#endif
+
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blSimdInstructionSetEnum {BL_SIMD_NONE = 0,
+                               BL_SIMD_SSE2 = 1,
+                               BL_SIMD_AVX2 = 2};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to detect the best
+// instruction set supported by the
+// cpu we're running on
+//-------------------------------------------------------------------
+inline blSimdInstructionSetEnum detectSimdInstructionSet()
+{
+    #if defined(BL_USE_SIMD_X86)
+
+        #if defined(_MSC_VER)
+
+            int cpuInfo[4];
+
+            __cpuid(cpuInfo,0);
+
+            if(cpuInfo[0] >= 7)
+            {
+                __cpuid(cpuInfo,1);
+
+                bool isOSXSAVEsupported = ( (cpuInfo[2] & (1 << 27)) != 0 );
+                bool isAVXsupported = ( (cpuInfo[2] & (1 << 28)) != 0 );
+
+                __cpuidex(cpuInfo,7,0);
+
+                bool isAVX2supported = ( (cpuInfo[1] & (1 << 5)) != 0 );
+
+                if(isOSXSAVEsupported &&
+                   isAVXsupported &&
+                   isAVX2supported &&
+                   (_xgetbv(0) & 6) == 6)
+                {
+                    return BL_SIMD_AVX2;
+                }
+            }
+
+            return BL_SIMD_SSE2;
+
+        #else
+
+            __builtin_cpu_init();
+
+            if(__builtin_cpu_supports("avx2"))
+                return BL_SIMD_AVX2;
+
+            return BL_SIMD_SSE2;
+
+        #endif
+
+    #else
+
+        return BL_SIMD_NONE;
+
+    #endif
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get/set the
+// instruction set used by the kernels
+// - The instruction set can only be
+//   lowered from the detected one, which
+//   is useful to compare the kernels
+// - Setting it is not thread safe, so
+//   it should be done at startup
+//-------------------------------------------------------------------
+inline blSimdInstructionSetEnum& simdInstructionSetInUse()
+{
+    static blSimdInstructionSetEnum instructionSet = detectSimdInstructionSet();
+
+    return instructionSet;
+}
+
+
+inline blSimdInstructionSetEnum getSimdInstructionSet()
+{
+    return simdInstructionSetInUse();
+}
+
+
+inline void setSimdInstructionSet(const blSimdInstructionSetEnum& instructionSet)
+{
+    blSimdInstructionSetEnum detectedInstructionSet = detectSimdInstructionSet();
+
+    if(instructionSet < detectedInstructionSet)
+        simdInstructionSetInUse() = instructionSet;
+    else
+        simdInstructionSetInUse() = detectedInstructionSet;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to saturate a single
+// precision value to the [0,255] range
+// (truncating it like a cast would)
+// NOTE:  NaN saturates to 255 just like
+//        the vectorized version below
+//-------------------------------------------------------------------
+inline unsigned char saturateToUnsignedChar(const float& value)
+{
+    if(!(value < 255.0f))
+        return 255;
+
+    if(value <= 0.0f)
+        return 0;
+
+    return static_cast<unsigned char>(value);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following helpers convert sixteen
+// unsigned chars to/from four single
+// precision vectors (saturating them
+// on the way back)
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+inline void unpackUnsignedCharToFloatSSE2(const __m128i& values,
+                                          __m128 (&floatValues)[4])
+{
+    __m128i zero = _mm_setzero_si128();
+
+    __m128i low16 = _mm_unpacklo_epi8(values,zero);
+    __m128i high16 = _mm_unpackhi_epi8(values,zero);
+
+    floatValues[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(low16,zero));
+    floatValues[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(low16,zero));
+    floatValues[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(high16,zero));
+    floatValues[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(high16,zero));
+}
+
+
+inline __m128i packFloatToUnsignedCharSSE2(const __m128 (&floatValues)[4])
+{
+    // The min takes care of values
+    // above 255, infinity and NaN,
+    // while the saturating packs
+    // take care of negative values
+
+    __m128 maxValue = _mm_set1_ps(255.0f);
+
+    __m128i values0 = _mm_cvttps_epi32(_mm_min_ps(floatValues[0],maxValue));
+    __m128i values1 = _mm_cvttps_epi32(_mm_min_ps(floatValues[1],maxValue));
+    __m128i values2 = _mm_cvttps_epi32(_mm_min_ps(floatValues[2],maxValue));
+    __m128i values3 = _mm_cvttps_epi32(_mm_min_ps(floatValues[3],maxValue));
+
+    return _mm_packus_epi16(_mm_packs_epi32(values0,values1),
+                            _mm_packs_epi32(values2,values3));
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures define the
+// per-element operations vectorized by
+// the kernels, for each data type and
+// instruction set
+//-------------------------------------------------------------------
+struct blSimdAdd
+{
+    // Sign used by the saturated
+    // integer path of the unsigned
+    // char kernels with a scalar
+
+    static const int                            saturatedScalarSign = 1;
+
+    template<typename blDataType>
+    static inline blDataType apply(const blDataType& value1,const blDataType& value2)
+    {
+        return (value1 + value2);
+    }
+
+    static inline unsigned char applySaturated(const unsigned char& value1,const unsigned char& value2)
+    {
+        int result = int(value1) + int(value2);
+        return static_cast<unsigned char>(result > 255 ? 255 : result);
+    }
+
+    #if defined(BL_USE_SIMD_X86)
+
+    static inline __m128 apply(const __m128& values1,const __m128& values2){return _mm_add_ps(values1,values2);}
+    static inline __m128d apply(const __m128d& values1,const __m128d& values2){return _mm_add_pd(values1,values2);}
+    static inline __m128i applySaturated(const __m128i& values1,const __m128i& values2){return _mm_adds_epu8(values1,values2);}
+
+    BL_SIMD_TARGET_AVX2 static inline __m256 apply(const __m256& values1,const __m256& values2){return _mm256_add_ps(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256d apply(const __m256d& values1,const __m256d& values2){return _mm256_add_pd(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256i applySaturated(const __m256i& values1,const __m256i& values2){return _mm256_adds_epu8(values1,values2);}
+
+    #endif
+};
+
+
+struct blSimdSubtract
+{
+    static const int                            saturatedScalarSign = -1;
+
+    template<typename blDataType>
+    static inline blDataType apply(const blDataType& value1,const blDataType& value2)
+    {
+        return (value1 - value2);
+    }
+
+    static inline unsigned char applySaturated(const unsigned char& value1,const unsigned char& value2)
+    {
+        return static_cast<unsigned char>(value1 > value2 ? value1 - value2 : 0);
+    }
+
+    #if defined(BL_USE_SIMD_X86)
+
+    static inline __m128 apply(const __m128& values1,const __m128& values2){return _mm_sub_ps(values1,values2);}
+    static inline __m128d apply(const __m128d& values1,const __m128d& values2){return _mm_sub_pd(values1,values2);}
+    static inline __m128i applySaturated(const __m128i& values1,const __m128i& values2){return _mm_subs_epu8(values1,values2);}
+
+    BL_SIMD_TARGET_AVX2 static inline __m256 apply(const __m256& values1,const __m256& values2){return _mm256_sub_ps(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256d apply(const __m256d& values1,const __m256d& values2){return _mm256_sub_pd(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256i applySaturated(const __m256i& values1,const __m256i& values2){return _mm256_subs_epu8(values1,values2);}
+
+    #endif
+};
+
+
+struct blSimdMultiply
+{
+    static const int                            saturatedScalarSign = 0;
+
+    template<typename blDataType>
+    static inline blDataType apply(const blDataType& value1,const blDataType& value2)
+    {
+        return (value1 * value2);
+    }
+
+    static inline unsigned char applySaturated(const unsigned char& value1,const unsigned char& value2)
+    {
+        int result = int(value1) * int(value2);
+        return static_cast<unsigned char>(result > 255 ? 255 : result);
+    }
+
+    #if defined(BL_USE_SIMD_X86)
+
+    static inline __m128 apply(const __m128& values1,const __m128& values2){return _mm_mul_ps(values1,values2);}
+    static inline __m128d apply(const __m128d& values1,const __m128d& values2){return _mm_mul_pd(values1,values2);}
+
+    static inline __m128i applySaturated(const __m128i& values1,const __m128i& values2)
+    {
+        // We multiply in 16 bits (the
+        // products fit in 16 unsigned bits)
+        // and clamp them to 255 with
+        // min(p,255) = p - max(p - 255,0)
+
+        __m128i zero = _mm_setzero_si128();
+        __m128i maxValue = _mm_set1_epi16(255);
+
+        __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi8(values1,zero),_mm_unpacklo_epi8(values2,zero));
+        __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi8(values1,zero),_mm_unpackhi_epi8(values2,zero));
+
+        low = _mm_sub_epi16(low,_mm_subs_epu16(low,maxValue));
+        high = _mm_sub_epi16(high,_mm_subs_epu16(high,maxValue));
+
+        return _mm_packus_epi16(low,high);
+    }
+
+    BL_SIMD_TARGET_AVX2 static inline __m256 apply(const __m256& values1,const __m256& values2){return _mm256_mul_ps(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256d apply(const __m256d& values1,const __m256d& values2){return _mm256_mul_pd(values1,values2);}
+
+    BL_SIMD_TARGET_AVX2 static inline __m256i applySaturated(const __m256i& values1,const __m256i& values2)
+    {
+        // Same as above, the unpacks
+        // and packs work within each
+        // 128 bit lane so the order
+        // is preserved
+
+        __m256i zero = _mm256_setzero_si256();
+        __m256i maxValue = _mm256_set1_epi16(255);
+
+        __m256i low = _mm256_mullo_epi16(_mm256_unpacklo_epi8(values1,zero),_mm256_unpacklo_epi8(values2,zero));
+        __m256i high = _mm256_mullo_epi16(_mm256_unpackhi_epi8(values1,zero),_mm256_unpackhi_epi8(values2,zero));
+
+        low = _mm256_sub_epi16(low,_mm256_subs_epu16(low,maxValue));
+        high = _mm256_sub_epi16(high,_mm256_subs_epu16(high,maxValue));
+
+        return _mm256_packus_epi16(low,high);
+    }
+
+    #endif
+};
+
+
+struct blSimdDivide
+{
+    static const int                            saturatedScalarSign = 0;
+
+    template<typename blDataType>
+    static inline blDataType apply(const blDataType& value1,const blDataType& value2)
+    {
+        return (value1 / value2);
+    }
+
+    static inline unsigned char applySaturated(const unsigned char& value1,const unsigned char& value2)
+    {
+        if(value2 == 0)
+            return 255;
+
+        return static_cast<unsigned char>(value1 / value2);
+    }
+
+    #if defined(BL_USE_SIMD_X86)
+
+    static inline __m128 apply(const __m128& values1,const __m128& values2){return _mm_div_ps(values1,values2);}
+    static inline __m128d apply(const __m128d& values1,const __m128d& values2){return _mm_div_pd(values1,values2);}
+
+    static inline __m128i applySaturated(const __m128i& values1,const __m128i& values2)
+    {
+        // There's no integer division,
+        // so we divide in single precision,
+        // which is exact enough for the
+        // truncated quotient of two bytes
+
+        __m128 floatValues1[4];
+        __m128 floatValues2[4];
+
+        unpackUnsignedCharToFloatSSE2(values1,floatValues1);
+        unpackUnsignedCharToFloatSSE2(values2,floatValues2);
+
+        for(int i = 0; i < 4; ++i)
+            floatValues1[i] = _mm_div_ps(floatValues1[i],floatValues2[i]);
+
+        return packFloatToUnsignedCharSSE2(floatValues1);
+    }
+
+    BL_SIMD_TARGET_AVX2 static inline __m256 apply(const __m256& values1,const __m256& values2){return _mm256_div_ps(values1,values2);}
+    BL_SIMD_TARGET_AVX2 static inline __m256d apply(const __m256d& values1,const __m256d& values2){return _mm256_div_pd(values1,values2);}
+
+    BL_SIMD_TARGET_AVX2 static inline __m256i applySaturated(const __m256i& values1,const __m256i& values2)
+    {
+        __m128i low = applySaturated(_mm256_castsi256_si128(values1),_mm256_castsi256_si128(values2));
+        __m128i high = applySaturated(_mm256_extracti128_si256(values1,1),_mm256_extracti128_si256(values2,1));
+
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(low),high,1);
+    }
+
+    #endif
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures wrap the
+// load/store/broadcast intrinsics of
+// the floating point types, so that
+// the float and double kernels can
+// share the same code
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+template<typename blDataType>
+struct blSimdVectorSSE2;
+
+template<>
+struct blSimdVectorSSE2<float>
+{
+    typedef __m128                              vector_type;
+    static const int                            numOfElements = 4;
+
+    static inline __m128 load(const float* data){return _mm_loadu_ps(data);}
+    static inline void store(float* data,const __m128& values){_mm_storeu_ps(data,values);}
+    static inline __m128 broadcast(const float& value){return _mm_set1_ps(value);}
+};
+
+template<>
+struct blSimdVectorSSE2<double>
+{
+    typedef __m128d                             vector_type;
+    static const int                            numOfElements = 2;
+
+    static inline __m128d load(const double* data){return _mm_loadu_pd(data);}
+    static inline void store(double* data,const __m128d& values){_mm_storeu_pd(data,values);}
+    static inline __m128d broadcast(const double& value){return _mm_set1_pd(value);}
+};
+
+
+template<typename blDataType>
+struct blSimdVectorAVX2;
+
+template<>
+struct blSimdVectorAVX2<float>
+{
+    typedef __m256                              vector_type;
+    static const int                            numOfElements = 8;
+
+    BL_SIMD_TARGET_AVX2 static inline __m256 load(const float* data){return _mm256_loadu_ps(data);}
+    BL_SIMD_TARGET_AVX2 static inline void store(float* data,const __m256& values){_mm256_storeu_ps(data,values);}
+    BL_SIMD_TARGET_AVX2 static inline __m256 broadcast(const float& value){return _mm256_set1_ps(value);}
+};
+
+template<>
+struct blSimdVectorAVX2<double>
+{
+    typedef __m256d                             vector_type;
+    static const int                            numOfElements = 4;
+
+    BL_SIMD_TARGET_AVX2 static inline __m256d load(const double* data){return _mm256_loadu_pd(data);}
+    BL_SIMD_TARGET_AVX2 static inline void store(double* data,const __m256d& values){_mm256_storeu_pd(data,values);}
+    BL_SIMD_TARGET_AVX2 static inline __m256d broadcast(const double& value){return _mm256_set1_pd(value);}
+};
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions vectorize
+// a floating point row, they return
+// the number of elements processed,
+// leaving the tail to the caller
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+template<typename blOperation,typename blDataType>
+
+inline int perElementRowOperationSSE2(const blDataType* src1,
+                                      const blDataType* src2,
+                                      blDataType* dst,
+                                      const int& numOfElements)
+{
+    typedef blSimdVectorSSE2<blDataType> blVector;
+
+    int i = 0;
+
+    for(; i + blVector::numOfElements <= numOfElements; i += blVector::numOfElements)
+        blVector::store(dst + i,blOperation::apply(blVector::load(src1 + i),blVector::load(src2 + i)));
+
+    return i;
+}
+
+
+template<typename blOperation,typename blDataType>
+
+inline int perElementRowOperationSSE2(const blDataType* src,
+                                      const blDataType& scalar,
+                                      blDataType* dst,
+                                      const int& numOfElements)
+{
+    typedef blSimdVectorSSE2<blDataType> blVector;
+
+    typename blVector::vector_type scalarValues = blVector::broadcast(scalar);
+
+    int i = 0;
+
+    for(; i + blVector::numOfElements <= numOfElements; i += blVector::numOfElements)
+        blVector::store(dst + i,blOperation::apply(blVector::load(src + i),scalarValues));
+
+    return i;
+}
+
+
+template<typename blOperation,typename blDataType>
+
+BL_SIMD_TARGET_AVX2 inline int perElementRowOperationAVX2(const blDataType* src1,
+                                                          const blDataType* src2,
+                                                          blDataType* dst,
+                                                          const int& numOfElements)
+{
+    typedef blSimdVectorAVX2<blDataType> blVector;
+
+    int i = 0;
+
+    for(; i + blVector::numOfElements <= numOfElements; i += blVector::numOfElements)
+        blVector::store(dst + i,blOperation::apply(blVector::load(src1 + i),blVector::load(src2 + i)));
+
+    return i;
+}
+
+
+template<typename blOperation,typename blDataType>
+
+BL_SIMD_TARGET_AVX2 inline int perElementRowOperationAVX2(const blDataType* src,
+                                                          const blDataType& scalar,
+                                                          blDataType* dst,
+                                                          const int& numOfElements)
+{
+    typedef blSimdVectorAVX2<blDataType> blVector;
+
+    typename blVector::vector_type scalarValues = blVector::broadcast(scalar);
+
+    int i = 0;
+
+    for(; i + blVector::numOfElements <= numOfElements; i += blVector::numOfElements)
+        blVector::store(dst + i,blOperation::apply(blVector::load(src + i),scalarValues));
+
+    return i;
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions vectorize an
+// unsigned char row with saturation,
+// returning the number of bytes processed
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+template<typename blOperation>
+
+inline int perElementSaturatedRowOperationSSE2(const unsigned char* src1,
+                                               const unsigned char* src2,
+                                               unsigned char* dst,
+                                               const int& numOfBytes)
+{
+    int i = 0;
+
+    for(; i + 16 <= numOfBytes; i += 16)
+    {
+        __m128i values1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + i));
+        __m128i values2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src2 + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),blOperation::applySaturated(values1,values2));
+    }
+
+    return i;
+}
+
+
+template<typename blOperation>
+
+BL_SIMD_TARGET_AVX2 inline int perElementSaturatedRowOperationAVX2(const unsigned char* src1,
+                                                                   const unsigned char* src2,
+                                                                   unsigned char* dst,
+                                                                   const int& numOfBytes)
+{
+    int i = 0;
+
+    for(; i + 32 <= numOfBytes; i += 32)
+    {
+        __m256i values1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src1 + i));
+        __m256i values2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src2 + i));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),blOperation::applySaturated(values1,values2));
+    }
+
+    return i;
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions vectorize an
+// unsigned char row with a scalar that
+// repeats every "period" bytes (1 for
+// a plain scalar, 3 for a blColor3 scalar)
+// - Additions and subtractions of integer
+//   scalars use saturating byte arithmetic
+// - Everything else is carried out in
+//   single precision and saturated
+//-------------------------------------------------------------------
+#if defined(BL_USE_SIMD_X86)
+
+inline int perElementSaturatedRowAdditionSSE2(const unsigned char* src,
+                                              const int (&scalarPattern)[3],
+                                              const int& period,
+                                              unsigned char* dst,
+                                              const int& numOfBytes)
+{
+    // We build one pattern for each
+    // phase of the scalar, the values
+    // added are the positive parts and
+    // the values subtracted the negative
+    // parts of the scalar
+
+    __m128i positivePatterns[3];
+    __m128i negativePatterns[3];
+
+    for(int phase = 0; phase < period; ++phase)
+    {
+        unsigned char positiveBytes[16];
+        unsigned char negativeBytes[16];
+
+        for(int j = 0; j < 16; ++j)
+        {
+            int value = scalarPattern[(phase + j) % period];
+
+            positiveBytes[j] = static_cast<unsigned char>(value > 0 ? value : 0);
+            negativeBytes[j] = static_cast<unsigned char>(value < 0 ? -value : 0);
+        }
+
+        positivePatterns[phase] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(positiveBytes));
+        negativePatterns[phase] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(negativeBytes));
+    }
+
+    int phase = 0;
+    int phaseStep = 16 % period;
+
+    int i = 0;
+
+    for(; i + 16 <= numOfBytes; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+        values = _mm_subs_epu8(_mm_adds_epu8(values,positivePatterns[phase]),negativePatterns[phase]);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),values);
+
+        phase += phaseStep;
+        if(phase >= period)
+            phase -= period;
+    }
+
+    return i;
+}
+
+
+BL_SIMD_TARGET_AVX2 inline int perElementSaturatedRowAdditionAVX2(const unsigned char* src,
+                                                                  const int (&scalarPattern)[3],
+                                                                  const int& period,
+                                                                  unsigned char* dst,
+                                                                  const int& numOfBytes)
+{
+    __m256i positivePatterns[3];
+    __m256i negativePatterns[3];
+
+    for(int phase = 0; phase < period; ++phase)
+    {
+        unsigned char positiveBytes[32];
+        unsigned char negativeBytes[32];
+
+        for(int j = 0; j < 32; ++j)
+        {
+            int value = scalarPattern[(phase + j) % period];
+
+            positiveBytes[j] = static_cast<unsigned char>(value > 0 ? value : 0);
+            negativeBytes[j] = static_cast<unsigned char>(value < 0 ? -value : 0);
+        }
+
+        positivePatterns[phase] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(positiveBytes));
+        negativePatterns[phase] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(negativeBytes));
+    }
+
+    int phase = 0;
+    int phaseStep = 32 % period;
+
+    int i = 0;
+
+    for(; i + 32 <= numOfBytes; i += 32)
+    {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+
+        values = _mm256_subs_epu8(_mm256_adds_epu8(values,positivePatterns[phase]),negativePatterns[phase]);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),values);
+
+        phase += phaseStep;
+        if(phase >= period)
+            phase -= period;
+    }
+
+    return i;
+}
+
+
+template<typename blOperation>
+
+inline int perElementSaturatedRowFloatOperationSSE2(const unsigned char* src,
+                                                    const float (&scalarPattern)[3],
+                                                    const int& period,
+                                                    unsigned char* dst,
+                                                    const int& numOfBytes)
+{
+    // Each block of sixteen bytes is
+    // split in four float vectors, the
+    // q-th vector starting 4*q bytes into
+    // the block, so we need one float
+    // pattern for each phase of the scalar
+
+    __m128 floatPatterns[3];
+
+    for(int phase = 0; phase < period; ++phase)
+    {
+        floatPatterns[phase] = _mm_setr_ps(scalarPattern[phase % period],
+                                           scalarPattern[(phase + 1) % period],
+                                           scalarPattern[(phase + 2) % period],
+                                           scalarPattern[(phase + 3) % period]);
+    }
+
+    int phase = 0;
+    int phaseStep = 16 % period;
+    int vectorPhaseStep = 4 % period;
+
+    int i = 0;
+
+    for(; i + 16 <= numOfBytes; i += 16)
+    {
+        __m128 floatValues[4];
+
+        unpackUnsignedCharToFloatSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),floatValues);
+
+        for(int q = 0, vectorPhase = phase; q < 4; ++q)
+        {
+            floatValues[q] = blOperation::apply(floatValues[q],floatPatterns[vectorPhase]);
+
+            vectorPhase += vectorPhaseStep;
+            if(vectorPhase >= period)
+                vectorPhase -= period;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),packFloatToUnsignedCharSSE2(floatValues));
+
+        phase += phaseStep;
+        if(phase >= period)
+            phase -= period;
+    }
+
+    return i;
+}
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following functions process a
+// whole row, picking the best instruction
+// set available and finishing the tail
+// (or the whole row when there's no
+// instruction set available) with a
+// scalar loop
+//-------------------------------------------------------------------
+template<typename blOperation,typename blDataType>
+
+inline void perElementRowOperation(const blDataType* src1,
+                                   const blDataType* src2,
+                                   blDataType* dst,
+                                   const int& numOfElements)
+{
+    int i = 0;
+
+    #if defined(BL_USE_SIMD_X86)
+
+        if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+            i = perElementRowOperationAVX2<blOperation>(src1,src2,dst,numOfElements);
+        else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+            i = perElementRowOperationSSE2<blOperation>(src1,src2,dst,numOfElements);
+
+    #endif
+
+    for(; i < numOfElements; ++i)
+        dst[i] = blOperation::apply(src1[i],src2[i]);
+}
+
+
+template<typename blOperation,typename blDataType>
+
+inline void perElementRowOperation(const blDataType* src,
+                                   const blDataType& scalar,
+                                   blDataType* dst,
+                                   const int& numOfElements)
+{
+    int i = 0;
+
+    #if defined(BL_USE_SIMD_X86)
+
+        if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+            i = perElementRowOperationAVX2<blOperation>(src,scalar,dst,numOfElements);
+        else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+            i = perElementRowOperationSSE2<blOperation>(src,scalar,dst,numOfElements);
+
+    #endif
+
+    for(; i < numOfElements; ++i)
+        dst[i] = blOperation::apply(src[i],scalar);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blOperation>
+
+inline void perElementSaturatedRowOperation(const unsigned char* src1,
+                                            const unsigned char* src2,
+                                            unsigned char* dst,
+                                            const int& numOfBytes)
+{
+    int i = 0;
+
+    #if defined(BL_USE_SIMD_X86)
+
+        if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+            i = perElementSaturatedRowOperationAVX2<blOperation>(src1,src2,dst,numOfBytes);
+
+        if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+            i += perElementSaturatedRowOperationSSE2<blOperation>(src1 + i,src2 + i,dst + i,numOfBytes - i);
+
+    #endif
+
+    for(; i < numOfBytes; ++i)
+        dst[i] = blOperation::applySaturated(src1[i],src2[i]);
+}
+
+
+template<typename blOperation>
+
+inline void perElementSaturatedRowOperation(const unsigned char* src,
+                                            const float (&scalarPattern)[3],
+                                            const int& period,
+                                            unsigned char* dst,
+                                            const int& numOfBytes)
+{
+    int i = 0;
+
+    #if defined(BL_USE_SIMD_X86)
+
+        // We check whether the scalar is
+        // made of integers we can add or
+        // subtract with saturating byte
+        // arithmetic
+
+        bool canUseSaturatedAddition = (blOperation::saturatedScalarSign != 0);
+        int integerPattern[3] = {0,0,0};
+
+        for(int phase = 0; phase < period && canUseSaturatedAddition; ++phase)
+        {
+            float value = float(blOperation::saturatedScalarSign) * scalarPattern[phase];
+
+            if(value >= -255.0f && value <= 255.0f && value == float(int(value)))
+                integerPattern[phase] = int(value);
+            else
+                canUseSaturatedAddition = false;
+        }
+
+        if(canUseSaturatedAddition)
+        {
+            if(getSimdInstructionSet() >= BL_SIMD_AVX2)
+                i = perElementSaturatedRowAdditionAVX2(src,integerPattern,period,dst,numOfBytes);
+
+            // The SSE2 pass has to start
+            // at the right phase of the scalar
+
+            if(getSimdInstructionSet() >= BL_SIMD_SSE2 && i % period == 0)
+                i += perElementSaturatedRowAdditionSSE2(src + i,integerPattern,period,dst + i,numOfBytes - i);
+        }
+        else if(getSimdInstructionSet() >= BL_SIMD_SSE2)
+        {
+            i = perElementSaturatedRowFloatOperationSSE2<blOperation>(src,scalarPattern,period,dst,numOfBytes);
+        }
+
+    #endif
+
+    for(int phase = i % period; i < numOfBytes; ++i)
+    {
+        dst[i] = saturateToUnsignedChar(blOperation::apply(float(src[i]),scalarPattern[phase]));
+
+        ++phase;
+        if(phase >= period)
+            phase = 0;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to convert a scalar
+// to a native type only when it's
+// an arithmetic type
+//-------------------------------------------------------------------
+template<typename blDataType,typename blScalarType>
+
+inline blDataType convertSimdScalar(const blScalarType& scalar,std::true_type)
+{
+    return static_cast<blDataType>(scalar);
+}
+
+
+template<typename blDataType,typename blScalarType>
+
+inline blDataType convertSimdScalar(const blScalarType&,std::false_type)
+{
+    return blDataType(0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following structures are used
+// by the per-element image functions
+// to find out whether the data type
+// has a row kernel and to run it
+// - Data types without a row kernel
+//   keep the generic element by
+//   element loops
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperation>
+struct blSimdPerElementKernel
+{
+    static const bool                           isSupported = false;
+
+    static void applyToRow(const blDataType*,const blDataType*,blDataType*,const int&){}
+
+    template<typename blScalarType>
+    static bool canApplyScalar(const blScalarType&){return false;}
+
+    template<typename blScalarType>
+    static void applyScalarToRow(const blDataType*,const blScalarType&,blDataType*,const int&){}
+};
+
+
+template<typename blOperation>
+struct blSimdPerElementKernel<float,blOperation>
+{
+    static const bool                           isSupported = true;
+
+    static void applyToRow(const float* src1,const float* src2,float* dst,const int& numOfElements)
+    {
+        perElementRowOperation<blOperation>(src1,src2,dst,numOfElements);
+    }
+
+    template<typename blScalarType>
+    static bool canApplyScalar(const blScalarType&)
+    {
+        return std::is_arithmetic<blScalarType>::value;
+    }
+
+    template<typename blScalarType>
+    static void applyScalarToRow(const float* src,const blScalarType& scalar,float* dst,const int& numOfElements)
+    {
+        float nativeScalar = convertSimdScalar<float>(scalar,std::is_arithmetic<blScalarType>());
+
+        perElementRowOperation<blOperation>(src,nativeScalar,dst,numOfElements);
+    }
+};
+
+
+template<typename blOperation>
+struct blSimdPerElementKernel<double,blOperation>
+{
+    static const bool                           isSupported = true;
+
+    static void applyToRow(const double* src1,const double* src2,double* dst,const int& numOfElements)
+    {
+        perElementRowOperation<blOperation>(src1,src2,dst,numOfElements);
+    }
+
+    template<typename blScalarType>
+    static bool canApplyScalar(const blScalarType&)
+    {
+        return std::is_arithmetic<blScalarType>::value;
+    }
+
+    template<typename blScalarType>
+    static void applyScalarToRow(const double* src,const blScalarType& scalar,double* dst,const int& numOfElements)
+    {
+        double nativeScalar = convertSimdScalar<double>(scalar,std::is_arithmetic<blScalarType>());
+
+        perElementRowOperation<blOperation>(src,nativeScalar,dst,numOfElements);
+    }
+};
+
+
+template<typename blOperation>
+struct blSimdPerElementKernel<unsigned char,blOperation>
+{
+    static const bool                           isSupported = true;
+
+    static void applyToRow(const unsigned char* src1,const unsigned char* src2,unsigned char* dst,const int& numOfElements)
+    {
+        perElementSaturatedRowOperation<blOperation>(src1,src2,dst,numOfElements);
+    }
+
+    template<typename blScalarType>
+    static bool canApplyScalar(const blScalarType&)
+    {
+        return std::is_arithmetic<blScalarType>::value;
+    }
+
+    template<typename blScalarType>
+    static void applyScalarToRow(const unsigned char* src,const blScalarType& scalar,unsigned char* dst,const int& numOfElements)
+    {
+        float nativeScalar = convertSimdScalar<float>(scalar,std::is_arithmetic<blScalarType>());
+        float scalarPattern[3] = {nativeScalar,nativeScalar,nativeScalar};
+
+        perElementSaturatedRowOperation<blOperation>(src,scalarPattern,1,dst,numOfElements);
+    }
+};
+
+
+template<typename blOperation>
+struct blSimdPerElementKernel<blColor3<unsigned char>,blOperation>
+{
+    // A row of blColor3<unsigned char>
+    // is a contiguous row of three times
+    // as many bytes
+
+    static const bool                           isSupported = true;
+
+    static void applyToRow(const blColor3<unsigned char>* src1,
+                           const blColor3<unsigned char>* src2,
+                           blColor3<unsigned char>* dst,
+                           const int& numOfElements)
+    {
+        perElementSaturatedRowOperation<blOperation>(reinterpret_cast<const unsigned char*>(src1),
+                                                     reinterpret_cast<const unsigned char*>(src2),
+                                                     reinterpret_cast<unsigned char*>(dst),
+                                                     3 * numOfElements);
+    }
+
+    template<typename blScalarType>
+    static bool canApplyScalar(const blScalarType&)
+    {
+        return std::is_arithmetic<blScalarType>::value;
+    }
+
+    static bool canApplyScalar(const blColor3<unsigned char>&)
+    {
+        return true;
+    }
+
+    template<typename blScalarType>
+    static void applyScalarToRow(const blColor3<unsigned char>* src,
+                                 const blScalarType& scalar,
+                                 blColor3<unsigned char>* dst,
+                                 const int& numOfElements)
+    {
+        float nativeScalar = convertSimdScalar<float>(scalar,std::is_arithmetic<blScalarType>());
+        float scalarPattern[3] = {nativeScalar,nativeScalar,nativeScalar};
+
+        perElementSaturatedRowOperation<blOperation>(reinterpret_cast<const unsigned char*>(src),
+                                                     scalarPattern,
+                                                     1,
+                                                     reinterpret_cast<unsigned char*>(dst),
+                                                     3 * numOfElements);
+    }
+
+    static void applyScalarToRow(const blColor3<unsigned char>* src,
+                                 const blColor3<unsigned char>& scalar,
+                                 blColor3<unsigned char>* dst,
+                                 const int& numOfElements)
+    {
+        float scalarPattern[3] = {float(scalar.m_blue),float(scalar.m_green),float(scalar.m_red)};
+
+        perElementSaturatedRowOperation<blOperation>(reinterpret_cast<const unsigned char*>(src),
+                                                     scalarPattern,
+                                                     3,
+                                                     reinterpret_cast<unsigned char*>(dst),
+                                                     3 * numOfElements);
+    }
+};
+//-------------------------------------------------------------------
+
+
+#endif // BL_SIMDKERNELS_HPP
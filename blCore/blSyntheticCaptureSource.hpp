@@ -0,0 +1,493 @@
+#ifndef BL_SYNTHETICCAPTURESOURCE_HPP
+#define BL_SYNTHETICCAPTURESOURCE_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSyntheticCaptureSource.hpp
+// CLASS:           blSyntheticCaptureSource
+// BASE CLASS:      blCaptureSource
+//
+// PURPOSE:         A capture source generating frames of a chosen
+//                  pattern, size and frame rate (with optional
+//                  jitter), used to run and benchmark the video
+//                  pipelines without a camera
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blCaptureSource -- The interface implemented
+//                  std::chrono -- Used to pace the frames
+//                  std::mt19937 -- Used to generate the jitter
+//
+// NOTES:           - Frame n is due at n / FPS seconds after the
+//                    first query (plus a uniformly distributed
+//                    jitter), and queryFrame sleeps until it's due
+//                  - Like a camera, the source doesn't wait for
+//                    slow consumers, so when queried late it skips
+//                    to the newest due frame and counts the frames
+//                    it skipped
+//                  - A FPS of 0 generates frames as fast as they
+//                    are queried
+//                  - Every frame is stamped with its frame number
+//                    and due time in the first 16 bytes of its first
+//                    row (see readFrameStamp), so that consumers can
+//                    measure end-to-end latencies and dropped frames
+//                  - With the same settings and random seed, the
+//                    source generates the same frames and jitters
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blSyntheticPattern
+{
+    BL_SOLID_FRAME_NUMBER_PATTERN = 0,
+    BL_MOVING_GRADIENT_PATTERN,
+    BL_MOVING_CHECKERBOARD_PATTERN,
+    BL_NOISE_PATTERN
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blSyntheticCaptureSource : public blCaptureSource
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blSyntheticCaptureSource(const int& width = 320,
+                             const int& height = 240,
+                             const double& FPS = 30.0,
+                             const blSyntheticPattern& pattern = BL_MOVING_GRADIENT_PATTERN,
+                             const double& jitterInMilliseconds = 0.0,
+                             const unsigned int& randomSeed = 0);
+
+    // Destructor
+
+    ~blSyntheticCaptureSource()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to generate
+    // the next frame
+
+    virtual IplImage*                       queryFrame();
+
+    // Functions used to get/set the
+    // width, height, FPS and position
+    // (CV_CAP_PROP_POS_FRAMES) of
+    // the source
+
+    virtual double                          getProperty(const int& propertyID)const;
+    virtual int                             setProperty(const int& propertyID,
+                                                        const double& value);
+
+    // Functions used to set/get
+    // the generated pattern
+
+    void                                    setPattern(const blSyntheticPattern& pattern);
+    blSyntheticPattern                      getPattern()const;
+
+    // Functions used to set/get the
+    // maximum jitter added to the
+    // time each frame is due
+
+    void                                    setJitter(const double& jitterInMilliseconds);
+    double                                  getJitter()const;
+
+    // Function used to get the
+    // number of frames skipped
+    // because they were queried late
+
+    unsigned long long                      getNumOfSkippedFrames()const;
+
+    // Function used to restart the
+    // source from frame 0 with the
+    // original random seed
+
+    void                                    restart();
+
+    // Function used to read the
+    // frame number and due time
+    // stamped into a generated frame
+    // - It returns false when the
+    //   image is too small to hold
+    //   the stamp
+
+    static bool                             readFrameStamp(const IplImage* frame,
+                                                           unsigned long long& frameNumber,
+                                                           std::chrono::steady_clock::time_point& captureTime);
+
+private: // Private functions
+
+    // Function used to draw the
+    // pattern and stamp of a frame
+    // (called with the lock held)
+
+    void                                    renderFrame(const unsigned long long& frameNumber,
+                                                        const std::chrono::steady_clock::time_point& captureTime);
+
+private: // Private variables
+
+    // Mutex protecting the settings
+    // and the state of the source
+
+    mutable std::mutex                      m_mutex;
+
+    // The generated frame, which
+    // only gets reallocated when
+    // its size changes
+
+    std::shared_ptr<IplImage>               m_frame;
+
+    // The settings
+
+    int                                     m_width;
+    int                                     m_height;
+    double                                  m_FPS;
+    blSyntheticPattern                      m_pattern;
+    double                                  m_jitterInMilliseconds;
+    unsigned int                            m_randomSeed;
+
+    // The state of the source
+
+    bool                                    m_hasStarted;
+    std::chrono::steady_clock::time_point   m_startTime;
+    unsigned long long                      m_nextFrameNumber;
+    unsigned long long                      m_numOfSkippedFrames;
+    std::mt19937                            m_randomGenerator;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blSyntheticCaptureSource::blSyntheticCaptureSource(const int& width,
+                                                          const int& height,
+                                                          const double& FPS,
+                                                          const blSyntheticPattern& pattern,
+                                                          const double& jitterInMilliseconds,
+                                                          const unsigned int& randomSeed)
+{
+    m_width = std::max(1,width);
+    m_height = std::max(1,height);
+    m_FPS = std::max(0.0,FPS);
+    m_pattern = pattern;
+    m_jitterInMilliseconds = std::max(0.0,jitterInMilliseconds);
+    m_randomSeed = randomSeed;
+
+    m_hasStarted = false;
+    m_nextFrameNumber = 0;
+    m_numOfSkippedFrames = 0;
+    m_randomGenerator.seed(m_randomSeed);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blSyntheticCaptureSource::restart()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_hasStarted = false;
+    m_nextFrameNumber = 0;
+    m_numOfSkippedFrames = 0;
+    m_randomGenerator.seed(m_randomSeed);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline IplImage* blSyntheticCaptureSource::queryFrame()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
+
+    if(!m_hasStarted)
+    {
+        // The schedule starts with
+        // the next frame being due now
+
+        m_startTime = currentTime;
+
+        if(m_FPS > 0)
+            m_startTime -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(double(m_nextFrameNumber) / m_FPS));
+
+        m_hasStarted = true;
+    }
+
+    unsigned long long frameNumber = m_nextFrameNumber;
+    std::chrono::steady_clock::time_point captureTime = currentTime;
+
+    if(m_FPS > 0)
+    {
+        // Frames that were due before
+        // now are skipped, just like a
+        // camera would drop them
+
+        double numOfElapsedFrames = std::chrono::duration<double>(currentTime - m_startTime).count() * m_FPS;
+
+        unsigned long long newestDueFrame = (unsigned long long)(std::max(0.0,std::floor(numOfElapsedFrames)));
+
+        if(newestDueFrame > frameNumber)
+        {
+            m_numOfSkippedFrames += newestDueFrame - frameNumber;
+            frameNumber = newestDueFrame;
+        }
+
+        double jitterInSeconds = 0;
+
+        if(m_jitterInMilliseconds > 0)
+            jitterInSeconds = std::uniform_real_distribution<double>(-m_jitterInMilliseconds,m_jitterInMilliseconds)(m_randomGenerator) / 1000.0;
+
+        captureTime = m_startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(double(frameNumber) / m_FPS + jitterInSeconds));
+    }
+
+    m_nextFrameNumber = frameNumber + 1;
+
+    // We wait for the frame to
+    // be due without holding the
+    // lock, and then draw it
+
+    lock.unlock();
+
+    std::this_thread::sleep_until(captureTime);
+
+    lock.lock();
+
+    renderFrame(frameNumber,captureTime);
+
+    return m_frame.get();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blSyntheticCaptureSource::renderFrame(const unsigned long long& frameNumber,
+                                                  const std::chrono::steady_clock::time_point& captureTime)
+{
+    // The frame only gets
+    // reallocated when its
+    // size was changed
+
+    if(!m_frame || m_frame->width != m_width || m_frame->height != m_height)
+        m_frame = std::shared_ptr<IplImage>(cvCreateImage(cvSize(m_width,m_height),IPL_DEPTH_8U,3),releaseImage());
+
+    IplImage* frame = m_frame.get();
+
+    int offset = int(frameNumber % 256);
+
+    // The noise is generated with a
+    // xorshift generator seeded with
+    // the frame number, so that it's
+    // cheap and reproducible
+
+    unsigned int noiseState = (unsigned int)(frameNumber * 2654435761ULL) ^ (m_randomSeed + 0x9E3779B9u);
+
+    for(int y = 0; y < frame->height; ++y)
+    {
+        unsigned char* row = reinterpret_cast<unsigned char*>(frame->imageData + std::ptrdiff_t(frame->widthStep) * y);
+
+        for(int x = 0; x < frame->width; ++x)
+        {
+            unsigned char* pixel = row + 3 * x;
+
+            switch(m_pattern)
+            {
+            case BL_MOVING_GRADIENT_PATTERN:
+
+                pixel[0] = (unsigned char)(x + 4 * offset);
+                pixel[1] = (unsigned char)(y + 2 * offset);
+                pixel[2] = (unsigned char)(x + y + offset);
+                break;
+
+            case BL_MOVING_CHECKERBOARD_PATTERN:
+
+                pixel[0] = pixel[1] = pixel[2] = ( ( ((x + offset) >> 4) + (y >> 4) ) & 1 ) ? 255 : 0;
+                break;
+
+            case BL_NOISE_PATTERN:
+
+                noiseState ^= noiseState << 13;
+                noiseState ^= noiseState >> 17;
+                noiseState ^= noiseState << 5;
+
+                pixel[0] = (unsigned char)(noiseState);
+                pixel[1] = (unsigned char)(noiseState >> 8);
+                pixel[2] = (unsigned char)(noiseState >> 16);
+                break;
+
+            case BL_SOLID_FRAME_NUMBER_PATTERN:
+            default:
+
+                pixel[0] = pixel[1] = pixel[2] = (unsigned char)(offset);
+                break;
+            }
+        }
+    }
+
+    // Stamp the frame number
+    // and the due time in the
+    // first row of the frame
+
+    if(frame->width * 3 >= 16)
+    {
+        long long captureTimeInNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(captureTime.time_since_epoch()).count();
+
+        std::memcpy(frame->imageData,&frameNumber,8);
+        std::memcpy(frame->imageData + 8,&captureTimeInNanoseconds,8);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blSyntheticCaptureSource::readFrameStamp(const IplImage* frame,
+                                                     unsigned long long& frameNumber,
+                                                     std::chrono::steady_clock::time_point& captureTime)
+{
+    if(!frame || frame->depth != IPL_DEPTH_8U || frame->width * frame->nChannels < 16)
+        return false;
+
+    long long captureTimeInNanoseconds = 0;
+
+    std::memcpy(&frameNumber,frame->imageData,8);
+    std::memcpy(&captureTimeInNanoseconds,frame->imageData + 8,8);
+
+    captureTime = std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(captureTimeInNanoseconds)));
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline double blSyntheticCaptureSource::getProperty(const int& propertyID)const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    switch(propertyID)
+    {
+    case CV_CAP_PROP_FRAME_WIDTH:
+        return double(m_width);
+
+    case CV_CAP_PROP_FRAME_HEIGHT:
+        return double(m_height);
+
+    case CV_CAP_PROP_FPS:
+        return m_FPS;
+
+    case CV_CAP_PROP_POS_FRAMES:
+        return double(m_nextFrameNumber);
+
+    case CV_CAP_PROP_POS_MSEC:
+        return (m_FPS > 0 ? 1000.0 * double(m_nextFrameNumber) / m_FPS : 0.0);
+
+    default:
+        return 0.0;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blSyntheticCaptureSource::setProperty(const int& propertyID,
+                                                 const double& value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    switch(propertyID)
+    {
+    case CV_CAP_PROP_FRAME_WIDTH:
+        m_width = std::max(1,int(value));
+        return 1;
+
+    case CV_CAP_PROP_FRAME_HEIGHT:
+        m_height = std::max(1,int(value));
+        return 1;
+
+    case CV_CAP_PROP_FPS:
+
+        // The schedule restarts
+        // from the next frame at
+        // the new frame rate
+
+        m_FPS = std::max(0.0,value);
+        m_hasStarted = false;
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blSyntheticCaptureSource::setPattern(const blSyntheticPattern& pattern)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pattern = pattern;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blSyntheticPattern blSyntheticCaptureSource::getPattern()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_pattern;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blSyntheticCaptureSource::setJitter(const double& jitterInMilliseconds)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_jitterInMilliseconds = std::max(0.0,jitterInMilliseconds);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline double blSyntheticCaptureSource::getJitter()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_jitterInMilliseconds;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline unsigned long long blSyntheticCaptureSource::getNumOfSkippedFrames()const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_numOfSkippedFrames;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SYNTHETICCAPTURESOURCE_HPP
@@ -20,11 +20,33 @@
 //
 // DEPENDENCIES:    blImage
 //                  std::shared_ptr -- From boost c++ libraries
+//                  std::thread -- Used to run the encoder
+//                                 in asynchronous mode
+//                  blImageBufferPool -- The queued frames are
+//                                       taken from the pool
+//                  convertImage -- Used to copy the frames
+//                                  into the queued frames
 //
-// NOTES:
+// NOTES:           - In asynchronous mode (StartAsyncWriting),
+//                    WriteFrame copies the frame into one of a
+//                    fixed number of preallocated frames, queues
+//                    it and returns, while a dedicated encoder
+//                    thread writes the queued frames in order
+//                  - When all the frames are queued, WriteFrame
+//                    either blocks until the encoder frees one or
+//                    drops the frame, depending on the queue policy
+//                  - Flush waits until every queued frame has been
+//                    written, and Close flushes before closing
+//                  - WriteFrame should not be called while the
+//                    writer is being closed or re-created
+//                  - When the writer doesn't know its frame size
+//                    (it wasn't created with Create), the first
+//                    queued frame sets it, and frames of any other
+//                    size are rejected with an error instead of
+//                    being counted as dropped
 //
 // DATE CREATED:    Sep/22/2009
-// DATE UPDATED:
+// DATE UPDATED:    Oct/16/2026
 //-------------------------------------------------------------------
 
 
@@ -37,6 +59,11 @@
 //-------------------------------------------------------------------
 // Enums used for this file and sub-files
 //-------------------------------------------------------------------
+enum blVideoWriterQueuePolicy
+{
+    BL_BLOCK_WHEN_QUEUE_IS_FULL = 0,
+    BL_DROP_FRAME_WHEN_QUEUE_IS_FULL
+};
 //-------------------------------------------------------------------
 
 
@@ -54,8 +81,17 @@ public: // Constructors and destructors
     // Virtual destructor
     virtual ~blVideoWriter()
     {
+        // Any queued frame gets
+        // written before the
+        // encoder thread stops
+        StopAsyncWriting();
     }
 
+    // Assignment operator (only the
+    // video writer is shared, not
+    // the asynchronous queue)
+    blVideoWriter&                              operator=(const blVideoWriter& VideoWriter);
+
 public: // Public functions
 
     // Function used to create
@@ -69,14 +105,52 @@ public: // Public functions
     // Function used to close
     // the currently open
     // video writer
+    // (in asynchronous mode, the
+    // queued frames are written
+    // first)
     void                                        Close();
 
     // Function used to write
     // a frame to the video
     // writer
+    // - In asynchronous mode it
+    //   returns 1 when the frame
+    //   got queued, 0 when it got
+    //   dropped (the queue was full)
+    //   and -1 when it can't be
+    //   written (no frame, or a frame
+    //   not the size of the writer)
     template<typename blType>
     int                                         WriteFrame(const blImage<blType>& Frame);
 
+    // Functions used to start/stop
+    // the asynchronous mode, where
+    // frames are queued and written
+    // by an encoder thread
+    // - The writer has to be created
+    //   before starting it
+    // - Stopping it writes the queued
+    //   frames first
+    bool                                        StartAsyncWriting(const int& MaxQueueSize = 8,
+                                                                  const blVideoWriterQueuePolicy& QueuePolicy = BL_BLOCK_WHEN_QUEUE_IS_FULL);
+    void                                        StopAsyncWriting();
+    bool                                        IsAsyncWritingEnabled()const;
+
+    // Function used to wait until
+    // every queued frame has been
+    // written
+    void                                        Flush();
+
+    // Functions used to get the
+    // asynchronous mode statistics
+    // - The latency percentile is
+    //   in milliseconds and is taken
+    //   over the last frames written
+    int                                         GetQueueDepth()const;
+    long long                                   GetNumOfWrittenFrames()const;
+    long long                                   GetNumOfDroppedFrames()const;
+    double                                      GetEncodeLatencyPercentile(const double& Percentile)const;
+
     // Function used to query
     // whether the video writer
     // is valid
@@ -111,6 +185,66 @@ protected: // Protected variables
 
     // Image variable
     std::shared_ptr<CvVideoWriter>              m_VideoWriter;
+
+    // Size and color of the
+    // frames the writer was
+    // created with
+    CvSize                                      m_FrameSize;
+    int                                         m_IsColor;
+
+private: // Private functions
+
+    // Function used to queue a
+    // frame in asynchronous mode
+    int                                         QueueFrame(const IplImage* Frame);
+
+    // Function used to take the
+    // queued frames from the image
+    // pool once the frame size
+    // is known
+    void                                        AcquireQueuedFrames();
+
+    // Function run by the
+    // encoder thread
+    void                                        EncoderThreadLoop();
+
+private: // Private variables
+
+    // The number of encode
+    // latencies kept for the
+    // percentiles
+    static const int                            m_MaxNumOfLatencySamples = 1024;
+
+    // The preallocated frames, the
+    // indices of the free ones and
+    // the ring of queued indices
+    std::vector<IplImage*>                      m_FramePool;
+    std::vector<int>                            m_FreeFrames;
+    std::vector<int>                            m_QueuedFrames;
+    int                                         m_OldestQueuedFrame;
+    int                                         m_QueueDepth;
+
+    // Whether the encoder is
+    // writing a frame right now
+    bool                                        m_IsEncoderBusy;
+
+    // The queue policy
+    blVideoWriterQueuePolicy                    m_QueuePolicy;
+
+    // The statistics
+    long long                                   m_NumOfWrittenFrames;
+    long long                                   m_NumOfDroppedFrames;
+    std::vector<double>                         m_EncodeLatencies;
+    int                                         m_NextLatencySample;
+
+    // The encoder thread and the
+    // mutex and condition variable
+    // protecting and signaling
+    // changes to the queue
+    std::thread                                 m_EncoderThread;
+    bool                                        m_IsEncoderThreadToBeTerminated;
+    mutable std::mutex                          m_QueueMutex;
+    std::condition_variable                     m_QueueChanged;
 };
 //-------------------------------------------------------------------
 
@@ -118,12 +252,25 @@ protected: // Protected variables
 //-------------------------------------------------------------------
 inline blVideoWriter::blVideoWriter()
 {
+    m_FrameSize = cvSize(0,0);
+    m_IsColor = 1;
+
+    m_OldestQueuedFrame = 0;
+    m_QueueDepth = 0;
+    m_IsEncoderBusy = false;
+    m_QueuePolicy = BL_BLOCK_WHEN_QUEUE_IS_FULL;
+
+    m_NumOfWrittenFrames = 0;
+    m_NumOfDroppedFrames = 0;
+    m_NextLatencySample = 0;
+
+    m_IsEncoderThreadToBeTerminated = true;
 }
 //-------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------
-inline blVideoWriter::blVideoWriter(const blVideoWriter& VideoWriter)
+inline blVideoWriter::blVideoWriter(const blVideoWriter& VideoWriter) : blVideoWriter()
 {
     // We link to the same capture
     // device of the passed object
@@ -131,6 +278,28 @@ inline blVideoWriter::blVideoWriter(const blVideoWriter& VideoWriter)
     // a pointer to the same capture
     // device
     m_VideoWriter = VideoWriter.GetVideoWriter();
+    m_FrameSize = VideoWriter.m_FrameSize;
+    m_IsColor = VideoWriter.m_IsColor;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blVideoWriter& blVideoWriter::operator=(const blVideoWriter& VideoWriter)
+{
+    if(this != &VideoWriter)
+    {
+        // Our own queued frames
+        // get written to our old
+        // video writer first
+        StopAsyncWriting();
+
+        m_VideoWriter = VideoWriter.GetVideoWriter();
+        m_FrameSize = VideoWriter.m_FrameSize;
+        m_IsColor = VideoWriter.m_IsColor;
+    }
+
+    return (*this);
 }
 //-------------------------------------------------------------------
 
@@ -161,6 +330,11 @@ inline bool blVideoWriter::Create(const std::string& Filename,
                                   const CvSize& FrameSize,
                                   const int& IsColor)
 {
+    // Frames queued for the
+    // previous video writer
+    // are written to it first
+    StopAsyncWriting();
+
     // First we try to
     // create the video
     // writer
@@ -184,6 +358,8 @@ inline bool blVideoWriter::Create(const std::string& Filename,
         // we store it into the std::shared_ptr
         // pointer and return true
         m_VideoWriter = std::shared_ptr<CvVideoWriter>(MyVideoWriter,releaseVideoWriter());
+        m_FrameSize = FrameSize;
+        m_IsColor = IsColor;
         return true;
     }
 }
@@ -193,6 +369,10 @@ inline bool blVideoWriter::Create(const std::string& Filename,
 //-------------------------------------------------------------------
 inline void blVideoWriter::Close()
 {
+    // The queued frames are
+    // written before closing
+    StopAsyncWriting();
+
     // To release/close the video writer
     // we simply release the std::shared_ptr
     // pointer
@@ -206,9 +386,334 @@ inline void blVideoWriter::Close()
 template<typename blType>
 inline int blVideoWriter::WriteFrame(const blImage<blType>& Frame)
 {
+    if(IsAsyncWritingEnabled())
+        return QueueFrame(Frame.getImagePtr());
+
     return cvWriteFrame((*this),Frame);
 }
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+inline bool blVideoWriter::StartAsyncWriting(const int& MaxQueueSize,
+                                             const blVideoWriterQueuePolicy& QueuePolicy)
+{
+    // Frames queued with the
+    // previous settings are
+    // written first
+    StopAsyncWriting();
+
+    if(!IsVideoWriterValid() || MaxQueueSize < 1)
+    {
+        // Error -- We need a valid video
+        //          writer to write to
+        return false;
+    }
+
+    // We take the frames from the
+    // image pool up front, so that
+    // queueing a frame never
+    // allocates anything (unless
+    // the frame size is unknown,
+    // in which case the first
+    // queued frame sets it)
+    m_FramePool.assign(MaxQueueSize,NULL);
+    m_FreeFrames.resize(MaxQueueSize);
+    m_QueuedFrames.assign(MaxQueueSize,0);
+
+    for(int i = 0; i < MaxQueueSize; ++i)
+        m_FreeFrames[i] = i;
+
+    if(m_FrameSize.width > 0 && m_FrameSize.height > 0)
+        AcquireQueuedFrames();
+
+    m_OldestQueuedFrame = 0;
+    m_QueueDepth = 0;
+    m_IsEncoderBusy = false;
+    m_QueuePolicy = QueuePolicy;
+
+    m_NumOfWrittenFrames = 0;
+    m_NumOfDroppedFrames = 0;
+    m_EncodeLatencies.clear();
+    m_EncodeLatencies.reserve(m_MaxNumOfLatencySamples);
+    m_NextLatencySample = 0;
+
+    // Set the boolean before launching
+    // the thread so that the thread
+    // doesn't see the old value
+    m_IsEncoderThreadToBeTerminated = false;
+
+    m_EncoderThread = std::thread(&blVideoWriter::EncoderThreadLoop,this);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoWriter::StopAsyncWriting()
+{
+    if(!m_EncoderThread.joinable())
+        return;
+
+    // The encoder thread writes
+    // every queued frame before
+    // it terminates
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_IsEncoderThreadToBeTerminated = true;
+    }
+
+    m_QueueChanged.notify_all();
+
+    m_EncoderThread.join();
+
+    // Give the frames
+    // back to the pool
+    for(int i = 0; i < int(m_FramePool.size()); ++i)
+        blImageBufferPool::getInstance().recycleImage(m_FramePool[i]);
+
+    m_FramePool.clear();
+    m_FreeFrames.clear();
+    m_QueuedFrames.clear();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoWriter::IsAsyncWritingEnabled()const
+{
+    return m_EncoderThread.joinable();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoWriter::AcquireQueuedFrames()
+{
+    int NumOfChannels = (m_IsColor ? 3 : 1);
+
+    for(int i = 0; i < int(m_FramePool.size()); ++i)
+    {
+        if(!m_FramePool[i])
+            m_FramePool[i] = blImageBufferPool::getInstance().acquireImage(m_FrameSize,IPL_DEPTH_8U,NumOfChannels);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoWriter::QueueFrame(const IplImage* Frame)
+{
+    if(!Frame)
+    {
+        // Error -- There's no
+        //          frame to write
+        return -1;
+    }
+
+    int FrameIndex = 0;
+
+    {
+        std::unique_lock<std::mutex> lock(m_QueueMutex);
+
+        // The first frame sets the
+        // frame size when the writer
+        // doesn't know it
+        if(m_FrameSize.width <= 0 || m_FrameSize.height <= 0)
+        {
+            m_FrameSize = cvSize(Frame->width,Frame->height);
+            AcquireQueuedFrames();
+        }
+
+        if(Frame->width != m_FrameSize.width || Frame->height != m_FrameSize.height)
+        {
+            // Error -- The frame is not
+            //          the size of the
+            //          writer's frames
+            return -1;
+        }
+
+        if(m_FreeFrames.empty())
+        {
+            if(m_QueuePolicy == BL_DROP_FRAME_WHEN_QUEUE_IS_FULL)
+            {
+                ++m_NumOfDroppedFrames;
+                return 0;
+            }
+
+            // We wait for the encoder
+            // to free up a frame
+            m_QueueChanged.wait(lock,[this]()
+            {
+                return ( !m_FreeFrames.empty() || m_IsEncoderThreadToBeTerminated );
+            });
+
+            if(m_FreeFrames.empty())
+            {
+                ++m_NumOfDroppedFrames;
+                return 0;
+            }
+        }
+
+        FrameIndex = m_FreeFrames.back();
+        m_FreeFrames.pop_back();
+    }
+
+    // The frame is copied outside
+    // of the lock, since nobody
+    // else touches a frame taken
+    // off the free list
+    bool WasFrameCopied = convertImage(Frame,m_FramePool[FrameIndex]);
+
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+
+        if(WasFrameCopied)
+        {
+            m_QueuedFrames[(m_OldestQueuedFrame + m_QueueDepth) % int(m_QueuedFrames.size())] = FrameIndex;
+            ++m_QueueDepth;
+        }
+        else
+        {
+            // Error -- The frame could
+            //          not be converted
+            //          (it's not counted as
+            //          dropped since the
+            //          queue wasn't full)
+            m_FreeFrames.push_back(FrameIndex);
+        }
+    }
+
+    m_QueueChanged.notify_all();
+
+    return (WasFrameCopied ? 1 : -1);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoWriter::EncoderThreadLoop()
+{
+    std::unique_lock<std::mutex> lock(m_QueueMutex);
+
+    while(true)
+    {
+        m_QueueChanged.wait(lock,[this]()
+        {
+            return ( m_QueueDepth > 0 || m_IsEncoderThreadToBeTerminated );
+        });
+
+        // We only terminate once
+        // the queue is drained
+        if(m_QueueDepth == 0)
+            break;
+
+        int FrameIndex = m_QueuedFrames[m_OldestQueuedFrame];
+        m_OldestQueuedFrame = (m_OldestQueuedFrame + 1) % int(m_QueuedFrames.size());
+        --m_QueueDepth;
+        m_IsEncoderBusy = true;
+
+        // Encode the frame
+        // outside of the lock
+        lock.unlock();
+
+        std::chrono::steady_clock::time_point EncodeStart = std::chrono::steady_clock::now();
+
+        cvWriteFrame(m_VideoWriter.get(),m_FramePool[FrameIndex]);
+
+        double EncodeLatency = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - EncodeStart).count();
+
+        lock.lock();
+
+        // Keep the latency in a
+        // ring of the last samples
+        if(int(m_EncodeLatencies.size()) < m_MaxNumOfLatencySamples)
+            m_EncodeLatencies.push_back(EncodeLatency);
+        else
+            m_EncodeLatencies[m_NextLatencySample] = EncodeLatency;
+
+        m_NextLatencySample = (m_NextLatencySample + 1) % m_MaxNumOfLatencySamples;
+
+        ++m_NumOfWrittenFrames;
+        m_FreeFrames.push_back(FrameIndex);
+        m_IsEncoderBusy = false;
+
+        // Wake up the writers waiting
+        // for a free frame and the
+        // threads flushing the queue
+        m_QueueChanged.notify_all();
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoWriter::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_QueueMutex);
+
+    m_QueueChanged.wait(lock,[this]()
+    {
+        return ( m_QueueDepth == 0 && !m_IsEncoderBusy );
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoWriter::GetQueueDepth()const
+{
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+
+    return m_QueueDepth;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blVideoWriter::GetNumOfWrittenFrames()const
+{
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+
+    return m_NumOfWrittenFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blVideoWriter::GetNumOfDroppedFrames()const
+{
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+
+    return m_NumOfDroppedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline double blVideoWriter::GetEncodeLatencyPercentile(const double& Percentile)const
+{
+    std::vector<double> Latencies;
+
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        Latencies = m_EncodeLatencies;
+    }
+
+    if(Latencies.empty())
+        return 0.0;
+
+    // Nearest rank percentile
+
+    int Rank = int(std::ceil(std::max(0.0,std::min(100.0,Percentile)) / 100.0 * double(Latencies.size()))) - 1;
+    Rank = std::max(0,Rank);
+
+    std::nth_element(Latencies.begin(),Latencies.begin() + Rank,Latencies.end());
+
+    return Latencies[Rank];
+}
+//-------------------------------------------------------------------
+
+
 #endif // BL_VIDEOWRITER_HPP
@@ -31,7 +31,33 @@
 // Includes and libs needed for this file and sub-files
 //-------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <map>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Intrinsics used by the vectorized
+// kernels (define BL_DISABLE_SIMD to
+// only use the scalar loops)
+
+#if !defined(BL_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define BL_USE_SIMD_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
 
 #include <blMathAPI/blMathAPI.hpp>
 
@@ -58,6 +84,15 @@ namespace blImageAPI
 
 
 
+    // A thread-safe, size-bucketed pool of
+    // IplImage buffers that blImage2::create
+    // can take its images from instead of
+    // allocating new ones every time
+
+    #include "blCore/blImageBufferPool.hpp"
+
+
+
     // A collection of functions used to
     // simplify converting images from one
     // form to another
@@ -108,6 +143,15 @@ namespace blImageAPI
 
 
 
+    // Defines row spans, row iterators and
+    // segmented (padding aware) iterators
+    // used to traverse a whole image or an
+    // image ROI one contiguous row at a time
+
+    #include "blCore/blImageRowIterators.hpp"
+
+
+
     // Based on blImage0, this class adds linear,
     // circular as well as reverse linear and
     // reverse circular iterators to facilitate
@@ -126,6 +170,32 @@ namespace blImageAPI
 
 
 
+    // A shared pool of threads and a work-stealing
+    // scheduler used to run algorithms over the
+    // tiles of an image ROI (parallelForTiles)
+
+    #include "blCore/blParallelForTiles.hpp"
+
+
+
+    // A collection of vectorized (SSE2/AVX2) row
+    // kernels picked at run time and used by the
+    // per-element image functions
+
+    #include "blCore/blSimdKernels.hpp"
+
+
+
+    // The image conversion engine, which resolves
+    // the depths and channel mapping once and
+    // runs a templated (and for unsigned char
+    // images vectorized) row kernel over bands
+    // of rows in parallel
+
+    #include "blAlgorithms/blConversionKernels.hpp"
+
+
+
     // This file defines circular forward and
     // reverse random access iterators to allow
     // the use of blImage as a circular buffer
@@ -143,6 +213,14 @@ namespace blImageAPI
 
 
 
+    // Defines a lightweight pointer/stride
+    // iterator used by blImage3 to go
+    // through an image ROI in stl algorithms
+
+    #include "blCore/blImageROIIterator.hpp"
+
+
+
     // Based on blImage2, this class adds functions to
     // clone other images, as well as functions to
     // wrap IplImage images with blImage objects without
@@ -192,6 +270,15 @@ namespace blImageAPI
 
 
 
+    // A single pass, multi-threaded and vectorized
+    // reduction engine used to compute the mean,
+    // variance, standard deviation, minimum and
+    // maximum of images
+
+    #include "blCore/blImageStatistics.hpp"
+
+
+
     // A collection of overloaded operators and functions
     // I developed to handle images just like matrices, so
     // as to make code very readable
@@ -200,6 +287,26 @@ namespace blImageAPI
 
 
 
+    // Lazy expression templates used to evaluate
+    // per-element image arithmetic (for example
+    // lazy(img1) * 2.0 + img2 - lazy(img3) / 3.0) in one
+    // single pass without temporary images
+
+    #include "blCore/blImageExpressions.hpp"
+
+
+
+    // An interface for custom video sources that
+    // a blCaptureDevice can be connected to, and a
+    // synthetic source generating stamped frames at
+    // a controlled rate (used to run and benchmark
+    // the video pipelines without a camera)
+
+    #include "blCore/blCaptureSource.hpp"
+    #include "blCore/blSyntheticCaptureSource.hpp"
+
+
+
     // A base class used to wrap OpenCV's CvCapture
     // class with a smart shared_ptr pointer
 
@@ -300,6 +407,48 @@ namespace blImageAPI
 
 
 
+    // The fftshift/ifftshift functions that move
+    // the zero frequency of an fft image to the
+    // middle and back, and a view that reads an
+    // image as if it had been shifted
+
+    #include "blAlgorithms/blFFTShift.hpp"
+
+
+
+    // A reusable fft context that caches the
+    // padded sizes, scratch buffers and outputs
+    // of an fft, and computes the compact half
+    // spectrum of real images (rfft2/irfft2)
+
+    #include "blAlgorithms/blFFTPlan.hpp"
+
+
+
+    // A cache of the frequency domain filter
+    // masks drawn by filterMask, so that video
+    // filtering only draws each mask once
+
+    #include "blAlgorithms/blFilterMaskCache.hpp"
+
+
+
+    // Convolution and correlation of images with
+    // kernels, done either spatially or through
+    // ffts (with overlap-add for big images)
+
+    #include "blAlgorithms/blFFTConvolution.hpp"
+
+
+
+    // A streaming short-time fourier transform
+    // that turns incoming samples into the rows
+    // of a circular spectrogram
+
+    #include "blAlgorithms/blSTFT.hpp"
+
+
+
     // A collection of algorithms I wrote to facilitate
     // the generation of image pyramids
 
@@ -307,6 +456,39 @@ namespace blImageAPI
 
 
 
+    // A pyramid engine that builds each gaussian
+    // level and the laplacian residual of the level
+    // below it in the same parallel sweep
+
+    #include "blAlgorithms/blPyramidKernels.hpp"
+
+
+
+    // A reusable pyramid builder that keeps the
+    // gaussian and laplacian pyramids of a frame
+    // size preallocated, and zero-copy views of
+    // their levels
+
+    #include "blAlgorithms/blPyramid.hpp"
+
+
+
+    // A multiband blender that blends two images
+    // band by band on their laplacian pyramids
+    // (a partner to the blending modes above)
+
+    #include "blAlgorithms/blMultibandBlending.hpp"
+
+
+
+    // A gaussian pyramid for static camera video
+    // that only rebuilds the tiles of each level
+    // that changed from the previous frame
+
+    #include "blAlgorithms/blIncrementalPyramid.hpp"
+
+
+
     // A simple class that wraps CvFont and
     // provides easy to use text function to
     // write on images
@@ -367,6 +549,17 @@ namespace blImageAPI
         // frame buffer
         #include "blVideoThread2.hpp"
 
+        // Based on blVideoThread, this class keeps the
+        // last N captured frames in a ring of preallocated
+        // and timestamped frames, with a configurable policy
+        // for dropping frames when the consumer falls behind
+        #include "blVideoThread3.hpp"
+
+        // Functions used to benchmark the latency,
+        // throughput and drop rate of the video thread
+        // classes fed by a synthetic capture source
+        #include "blVideoPipelineBenchmark.hpp"
+
     #endif
 }
 //-------------------------------------------------------------------
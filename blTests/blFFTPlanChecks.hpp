@@ -0,0 +1,97 @@
+#ifndef BL_FFTPLANCHECKS_HPP
+#define BL_FFTPLANCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFFTPlanChecks.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to check that the inverse
+//                  transforms of a blFFTPlan reject spectra that
+//                  don't match the plan's size
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blFFTPlan -- The plan checked
+//
+// NOTES:           - Run the checks with the address sanitizer to
+//                    catch a spectrum being read out of its bounds
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to check that the
+// inverse transforms give back an
+// empty image for a plan that was
+// never set up, and for spectra
+// smaller than the plan's size
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkFFTPlanInverseSizeMismatches(const int& rows = 16,
+                                              const int& cols = 16)
+{
+    blFFTPlan<blDataType> plan;
+
+    blImage< std::complex<blDataType> > smallSpectrum(rows / 4,cols / 4);
+
+    // A plan that was never set up
+
+    if(!plan.inverseHalfSpectrumToReal(smallSpectrum).empty())
+        return false;
+
+    if(!plan.inverse(smallSpectrum).empty())
+        return false;
+
+    // A plan set up for a bigger size
+
+    plan.setup(rows,cols);
+
+    if(!plan.inverseHalfSpectrumToReal(smallSpectrum).empty())
+        return false;
+
+    if(!plan.inverse(smallSpectrum).empty())
+        return false;
+
+    // Spectra of the right size
+
+    blImage< std::complex<blDataType> > halfSpectrum(plan.getNumOfPaddedRows(),plan.getNumOfHalfSpectrumCols());
+    blImage< std::complex<blDataType> > fullSpectrum(plan.getNumOfPaddedRows(),plan.getNumOfPaddedCols());
+
+    const blImage<blDataType>& realImage1 = plan.inverseHalfSpectrumToReal(halfSpectrum);
+
+    if(realImage1.size1ROI() != rows || realImage1.size2ROI() != cols)
+        return false;
+
+    const blImage<blDataType>& realImage2 = plan.inverse(fullSpectrum);
+
+    if(realImage2.size1ROI() != rows || realImage2.size2ROI() != cols)
+        return false;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FFTPLANCHECKS_HPP
@@ -0,0 +1,143 @@
+#ifndef BL_FILTERMASKCHECKS_HPP
+#define BL_FILTERMASKCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFilterMaskChecks.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to check that the filter masks
+//                  computed over the tiles of the shared thread pool
+//                  are the same as the masks computed on the calling
+//                  thread alone
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    filterMask, applyFilterToSpectrum
+//                  blFilterMaskCache
+//                  blTileThreadPool -- Its thread cap is set to one
+//                                      thread for the serial masks
+//
+// NOTES:           - The checks fail when the shared pool only has
+//                    one thread, since there's nothing to compare
+//                    (define BL_NUM_OF_TILE_THREADS to more than one
+//                    on single core machines)
+//                  - The masks are big enough (512x512 by default)
+//                    to be split into many tiles
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to compare two images
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool areImagesEqual(const blImage<blDataType>& image1,
+                           const blImage<blDataType>& image2)
+{
+    if(image1.size1() != image2.size1() || image1.size2() != image2.size2())
+        return false;
+
+    for(int i = 0; i < image1.size1(); ++i)
+    {
+        if(!std::equal(image1[i],image1[i] + image1.size2(),image2[i]))
+            return false;
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function checks the masks
+// and the filtered spectra of every filter
+// type and function, computed serially and
+// with all the threads of the pool
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkParallelFilterMasks(const int& numOfRows = 512,
+                                     const int& numOfCols = 512)
+{
+    blTileThreadPool& pool = getTileThreadPool();
+
+    if(pool.getNumOfThreads() < 2)
+        return false;
+
+    const int maxNumOfThreads = pool.getMaxNumOfThreads();
+
+    const blFilterTypeEnum filterTypes[] = {BL_LOWPASS,BL_HIGHPASS,BL_BANDPASS,BL_BANDREJECT};
+    const blFilterFunctionTypeEnum filterFunctionTypes[] = {BL_BUTTERWORTH,BL_GAUSSIAN};
+
+    bool areMasksEqual = true;
+
+    for(const auto& filterType : filterTypes)
+    {
+        for(const auto& filterFunctionType : filterFunctionTypes)
+        {
+            blImage<blDataType> serialMask(numOfRows,numOfCols);
+            blImage<blDataType> parallelMask(numOfRows,numOfCols);
+
+            blImage< std::complex<blDataType> > serialSpectrum(numOfRows,numOfCols);
+            blImage< std::complex<blDataType> > parallelSpectrum(numOfRows,numOfCols);
+
+            for(int i = 0; i < numOfRows; ++i)
+            {
+                std::fill(serialSpectrum[i],serialSpectrum[i] + numOfCols,std::complex<blDataType>(1,-1));
+                std::fill(parallelSpectrum[i],parallelSpectrum[i] + numOfCols,std::complex<blDataType>(1,-1));
+            }
+
+            pool.setMaxNumOfThreads(1);
+
+            filterMask(serialMask,2,0.3,0.1,filterType,filterFunctionType);
+            applyFilterToSpectrum(serialSpectrum,2,0.3,0.1,filterType,filterFunctionType);
+
+            pool.setMaxNumOfThreads(maxNumOfThreads);
+
+            filterMask(parallelMask,2,0.3,0.1,filterType,filterFunctionType);
+            applyFilterToSpectrum(parallelSpectrum,2,0.3,0.1,filterType,filterFunctionType);
+
+            // The cache builds its
+            // masks with filterMask
+
+            blFilterMaskCache<blDataType> filterMaskCache;
+
+            const blImage<blDataType>& cachedMask = filterMaskCache.getMask(numOfRows,numOfCols,2,0.3,0.1,filterType,filterFunctionType);
+
+            if(!areImagesEqual(serialMask,parallelMask) ||
+               !areImagesEqual(serialMask,cachedMask) ||
+               !areImagesEqual(serialSpectrum,parallelSpectrum))
+            {
+                areMasksEqual = false;
+            }
+        }
+    }
+
+    return areMasksEqual;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FILTERMASKCHECKS_HPP
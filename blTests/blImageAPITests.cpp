@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------
+// FILE:            blImageAPITests.cpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Runs the checks of blImageAPITests.hpp and prints
+//                  the ones that fail
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageAPITests.hpp
+//
+// NOTES:           - It returns the number of failed checks, so zero
+//                    means every check passed
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+
+#include <cstdio>
+
+// The checks of the parallel loops need
+// more than one thread, even on single
+// core machines
+
+#ifndef BL_NUM_OF_TILE_THREADS
+    #define BL_NUM_OF_TILE_THREADS 4
+#endif
+
+// The video thread checks
+// need SFML
+
+#ifdef USE_BL_VIDEOTHREAD
+    #include <SFML/System.hpp>
+#endif
+
+#include "blImageAPITests.hpp"
+
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to run one check
+//-------------------------------------------------------------------
+inline void runCheck(const char* checkName,
+                     const bool& hasCheckPassed,
+                     int& numOfFailedChecks)
+{
+    std::printf("%s %s\n",(hasCheckPassed ? "PASSED" : "FAILED"),checkName);
+
+    if(!hasCheckPassed)
+        ++numOfFailedChecks;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+int main()
+{
+    using namespace blImageAPI;
+
+    int numOfFailedChecks = 0;
+
+    runCheck("checkImageMoveAllocations",checkImageMoveAllocations<float>(),numOfFailedChecks);
+    runCheck("checkImageDefaultConstructionAllocations",checkImageDefaultConstructionAllocations<float>(),numOfFailedChecks);
+    runCheck("checkSplitImageIntoVectorOfSubImagesAllocations",checkSplitImageIntoVectorOfSubImagesAllocations<float>(),numOfFailedChecks);
+    runCheck("checkImageROIIteratorDistances",checkImageROIIteratorDistances<float>(),numOfFailedChecks);
+    runCheck("checkParallelFilterMasks",checkParallelFilterMasks<double>(),numOfFailedChecks);
+    runCheck("checkEvaluateIntoLargerOperand",checkEvaluateIntoLargerOperand<float>(),numOfFailedChecks);
+    runCheck("checkFFTPlanInverseSizeMismatches",checkFFTPlanInverseSizeMismatches<float>(),numOfFailedChecks);
+
+    #ifdef USE_BL_VIDEOTHREAD
+        runCheck("checkVideoThreadFailedQueries",checkVideoThreadFailedQueries(),numOfFailedChecks);
+        runCheck("checkVideoThread2FailedQueries",checkVideoThread2FailedQueries(),numOfFailedChecks);
+        runCheck("checkVideoThread3FailedQueries",checkVideoThread3FailedQueries(),numOfFailedChecks);
+    #endif
+
+    return numOfFailedChecks;
+}
+//-------------------------------------------------------------------
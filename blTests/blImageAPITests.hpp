@@ -0,0 +1,98 @@
+#ifndef BL_IMAGEAPITESTS_HPP
+#define BL_IMAGEAPITESTS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageAPITests.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         An opt-in collection of checks of the blImageAPI
+//                  library (blImageAPI.hpp does not include it), each
+//                  check being a function that returns true when it
+//                  passes
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageAPI.hpp
+//
+// NOTES:           - blImageAPITests.cpp runs every check
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file and sub-files
+//-------------------------------------------------------------------
+
+#include "../blImageAPI.hpp"
+
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+namespace blImageAPI
+{
+    // A counter of image allocations and functions
+    // used to check that moving and default
+    // constructing images don't allocate, and
+    // that splitting images allocates each sub
+    // image once
+
+    #include "blImageAllocationChecks.hpp"
+
+
+
+    // Functions used to check that the distance
+    // between two ROI iterators agrees with the
+    // number of steps of a (first != last) loop
+
+    #include "blImageROIIteratorChecks.hpp"
+
+
+
+    // Functions used to check that the filter
+    // masks computed with the thread pool are
+    // the same as the ones computed serially
+
+    #include "blFilterMaskChecks.hpp"
+
+
+
+    // Functions used to check that the lazy image
+    // expressions can be evaluated into one of
+    // their own operands
+
+    #include "blImageExpressionChecks.hpp"
+
+
+
+    // Functions used to check that the inverse
+    // transforms of a plan reject spectra that
+    // don't match the plan's size
+
+    #include "blFFTPlanChecks.hpp"
+
+
+
+    // A failing capture source and functions
+    // used to check that the video threads
+    // neither publish nor spin when their
+    // queries fail (the video threads need
+    // USE_BL_VIDEOTHREAD to be defined)
+
+    #ifdef USE_BL_VIDEOTHREAD
+        #include "blVideoThreadChecks.hpp"
+    #endif
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEAPITESTS_HPP
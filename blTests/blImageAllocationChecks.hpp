@@ -0,0 +1,288 @@
+#ifndef BL_IMAGEALLOCATIONCHECKS_HPP
+#define BL_IMAGEALLOCATIONCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageAllocationChecks.hpp
+// CLASS:           blImageAllocationCounter
+// BASE CLASS:      None
+//
+// PURPOSE:         A counter of the image buffers allocated by
+//                  blImage2::create, and functions that use it to
+//                  check that moving images and default constructing
+//                  them don't allocate anything, and that splitting
+//                  an image allocates each sub image once
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageBufferPool -- Every buffer blImage2::create
+//                                       takes from the pool is either
+//                                       a hit or a miss, so the sum of
+//                                       the two is the number of
+//                                       allocations
+//
+// NOTES:           - The counter enables the buffer pool while it's
+//                    alive, and puts it back the way it was when it's
+//                    destroyed (clearing it if it was disabled)
+//                  - It counts the allocations of every thread, so
+//                    the checks should run while no other thread is
+//                    creating images
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blImageAllocationCounter
+{
+public: // Constructors and destructors
+
+    // Default constructor
+    // (It starts counting)
+
+    blImageAllocationCounter();
+
+    // Destructor
+
+    ~blImageAllocationCounter();
+
+private: // The counter cannot be copied
+
+    blImageAllocationCounter(const blImageAllocationCounter& counter);
+    blImageAllocationCounter&               operator=(const blImageAllocationCounter& counter);
+
+public: // Public functions
+
+    // Function used to get the
+    // number of image buffers
+    // allocated since the counter
+    // was created or last reset
+
+    long long                               getNumOfAllocations()const;
+
+    // Function used to restart
+    // the count from zero
+
+    void                                    reset();
+
+private: // Private functions
+
+    long long                               getNumOfPoolAcquisitions()const;
+
+private: // Private variables
+
+    bool                                    m_wasPoolEnabled;
+
+    long long                               m_startingNumOfAcquisitions;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blImageAllocationCounter::blImageAllocationCounter()
+{
+    m_wasPoolEnabled = blImageBufferPool::getInstance().isEnabled();
+
+    blImageBufferPool::getInstance().setEnabled(true);
+
+    m_startingNumOfAcquisitions = getNumOfPoolAcquisitions();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blImageAllocationCounter::~blImageAllocationCounter()
+{
+    if(!m_wasPoolEnabled)
+    {
+        blImageBufferPool::getInstance().setEnabled(false);
+        blImageBufferPool::getInstance().clear();
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageAllocationCounter::getNumOfPoolAcquisitions()const
+{
+    return ( blImageBufferPool::getInstance().getNumOfHits() +
+             blImageBufferPool::getInstance().getNumOfMisses() );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline long long blImageAllocationCounter::getNumOfAllocations()const
+{
+    return ( getNumOfPoolAcquisitions() - m_startingNumOfAcquisitions );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blImageAllocationCounter::reset()
+{
+    m_startingNumOfAcquisitions = getNumOfPoolAcquisitions();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function checks that
+// the result of operator+ is allocated
+// once, whether it's returned or moved
+// into another image afterwards
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkImageMoveAllocations(const int& numOfRows = 16,
+                                      const int& numOfCols = 16)
+{
+    blImage<blDataType> image1(numOfRows,numOfCols);
+    blImage<blDataType> image2(numOfRows,numOfCols);
+
+    blImageAllocationCounter counter;
+
+    // A returned result
+
+    blImage<blDataType> sum = image1 + image2;
+
+    if(counter.getNumOfAllocations() != 1)
+        return false;
+
+    // Moving it around
+
+    counter.reset();
+
+    blImage<blDataType> movedSum(std::move(sum));
+
+    blImage<blDataType> moveAssignedSum;
+    moveAssignedSum = std::move(movedSum);
+
+    std::vector< blImage<blDataType> > images;
+
+    for(int i = 0; i < 8; ++i)
+        images.push_back(image1 + image2);
+
+    if(counter.getNumOfAllocations() != 8)
+        return false;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function checks that
+// default constructed images don't
+// allocate anything
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkImageDefaultConstructionAllocations(const int& numOfImages = 64)
+{
+    blImageAllocationCounter counter;
+
+    std::vector< blImage<blDataType> > images(numOfImages);
+
+    images.resize(2 * numOfImages);
+    images.emplace_back();
+
+    if(counter.getNumOfAllocations() != 0)
+        return false;
+
+    for(const auto& image : images)
+    {
+        if(!image.empty())
+            return false;
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following function checks that
+// splitting an image into a vector of
+// sub images allocates every sub image
+// exactly once, and that the sub images
+// hold the right pixels
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkSplitImageIntoVectorOfSubImagesAllocations(const int& numOfRows = 17,
+                                                            const int& numOfCols = 19,
+                                                            const int& numOfVerticalSplits = 3,
+                                                            const int& numOfHorizontalSplits = 4)
+{
+    blImage<blDataType> srcImage(numOfRows,numOfCols);
+
+    for(int i = 0; i < numOfRows; ++i)
+        for(int j = 0; j < numOfCols; ++j)
+            srcImage[i][j] = blDataType(i * numOfCols + j);
+
+    std::vector< blImage<blDataType> > subImages;
+
+    blImageAllocationCounter counter;
+
+    splitImageIntoVectorOfSubImages(srcImage,subImages,numOfVerticalSplits,numOfHorizontalSplits);
+
+    if(subImages.size() != std::size_t(numOfVerticalSplits * numOfHorizontalSplits))
+        return false;
+
+    if(counter.getNumOfAllocations() != numOfVerticalSplits * numOfHorizontalSplits)
+        return false;
+
+    // The sub images are stored row
+    // by row, and the last row/col
+    // of sub images takes the
+    // leftover rows/cols
+
+    int rows = numOfRows / numOfVerticalSplits;
+    int cols = numOfCols / numOfHorizontalSplits;
+
+    for(int i = 0; i < numOfVerticalSplits; ++i)
+    {
+        for(int j = 0; j < numOfHorizontalSplits; ++j)
+        {
+            const blImage<blDataType>& subImage = subImages[i * numOfHorizontalSplits + j];
+
+            int subRows = (i < numOfVerticalSplits - 1) ? rows : (numOfRows - i * rows);
+            int subCols = (j < numOfHorizontalSplits - 1) ? cols : (numOfCols - j * cols);
+
+            if(subImage.size1ROI() != subRows || subImage.size2ROI() != subCols)
+                return false;
+
+            for(int n = 0; n < subRows; ++n)
+                for(int m = 0; m < subCols; ++m)
+                    if(subImage.atROI(n,m) != srcImage[i * rows + n][j * cols + m])
+                        return false;
+        }
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEALLOCATIONCHECKS_HPP
@@ -0,0 +1,84 @@
+#ifndef BL_IMAGEEXPRESSIONCHECKS_HPP
+#define BL_IMAGEEXPRESSIONCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageExpressionChecks.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to check that the lazy image
+//                  expressions evaluate correctly when the
+//                  destination image is also one of the operands
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImageExpressions.hpp -- lazy and evaluate
+//
+// NOTES:           - Run the checks with the address sanitizer to
+//                    catch an operand being read after its buffer
+//                    has been released
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to check evaluating an
+// expression into one of its operands,
+// when that operand is bigger than the
+// expression and so has to be recreated
+// - The operand is the only owner of its
+//   buffer, so the buffer is released
+//   when the operand is recreated
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkEvaluateIntoLargerOperand(const int& bigSize = 20,
+                                           const int& smallSize = 10)
+{
+    blImage<blDataType> bigImage(bigSize,bigSize);
+    blImage<blDataType> smallImage(smallSize,smallSize);
+
+    for(int i = 0; i < bigSize; ++i)
+        for(int j = 0; j < bigSize; ++j)
+            bigImage[i][j] = blDataType(i + j);
+
+    for(int i = 0; i < smallSize; ++i)
+        for(int j = 0; j < smallSize; ++j)
+            smallImage[i][j] = blDataType(100);
+
+    evaluate(lazy(bigImage) + lazy(smallImage),bigImage);
+
+    if(bigImage.size1ROI() != smallSize || bigImage.size2ROI() != smallSize)
+        return false;
+
+    for(int i = 0; i < smallSize; ++i)
+        for(int j = 0; j < smallSize; ++j)
+            if(bigImage[i][j] != blDataType(i + j + 100))
+                return false;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEEXPRESSIONCHECKS_HPP
@@ -0,0 +1,160 @@
+#ifndef BL_IMAGEROIITERATORCHECKS_HPP
+#define BL_IMAGEROIITERATORCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blImageROIIteratorChecks.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to check that the distance between
+//                  two ROI iterators agrees with their equality, so
+//                  that stl algorithms that use std::distance (like
+//                  std::copy on random access iterators) walk the
+//                  same elements as a (first != last) loop
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blImage3 -- begin_ROI, end_ROI and getIterROI
+//
+// NOTES:           - The checks are done on a ROI that doesn't span
+//                    the whole width of its image, starting from a
+//                    non-zero element and circulating more than once
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to check one range
+// - std::distance has to be the number
+//   of steps of a (first != last) loop,
+//   first + distance has to be last and
+//   first has to be before last
+//-------------------------------------------------------------------
+template<typename blIteratorType>
+
+inline bool checkImageROIIteratorDistance(const blIteratorType& first,
+                                          const blIteratorType& last,
+                                          const ptrdiff_t& expectedNumOfSteps)
+{
+    ptrdiff_t numOfSteps = 0;
+
+    for(blIteratorType iter = first; iter != last; ++iter)
+    {
+        ++numOfSteps;
+
+        // Don't loop forever if
+        // the end is never reached
+
+        if(numOfSteps > expectedNumOfSteps)
+            return false;
+    }
+
+    if(numOfSteps != expectedNumOfSteps)
+        return false;
+
+    if(std::distance(first,last) != numOfSteps)
+        return false;
+
+    if(std::distance(last,first) != -numOfSteps)
+        return false;
+
+    if( (first + numOfSteps) != last )
+        return false;
+
+    if(numOfSteps > 0 && !(first < last && last > first && first <= last && !(last <= first)))
+        return false;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The following function checks the
+// distances of ROI iterators starting
+// from a non-zero element and going
+// around the ROI multiple times
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+inline bool checkImageROIIteratorDistances(const int& numOfRows = 20,
+                                           const int& numOfCols = 30)
+{
+    if(numOfRows < 3 || numOfCols < 3)
+        return false;
+
+    blImage<blDataType> image(numOfRows,numOfCols);
+
+    image.setROI(1,1,numOfRows - 2,numOfCols - 2);
+
+    const ptrdiff_t sizeOfROI = ptrdiff_t(image.sizeROI());
+
+    // One circulation from the
+    // first element
+
+    if(!checkImageROIIteratorDistance(image.begin_ROI(),image.end_ROI(),sizeOfROI))
+        return false;
+
+    // One circulation from a
+    // non-zero element
+
+    if(!checkImageROIIteratorDistance(image.getIterROI(5,1),image.end_ROI(),sizeOfROI))
+        return false;
+
+    // Multiple circulations from
+    // the first element and from
+    // a non-zero element
+
+    for(int numOfCirculations = 2; numOfCirculations <= 3; ++numOfCirculations)
+    {
+        if(!checkImageROIIteratorDistance(image.begin_ROI(numOfCirculations),image.end_ROI(),numOfCirculations * sizeOfROI))
+            return false;
+
+        if(!checkImageROIIteratorDistance(image.getIterROI(5,numOfCirculations),image.end_ROI(),numOfCirculations * sizeOfROI))
+            return false;
+    }
+
+    // The same checks with
+    // const iterators
+
+    const blImage<blDataType>& constImage = image;
+
+    if(!checkImageROIIteratorDistance(constImage.getConstIterROI(5,2),constImage.cend_ROI(),2 * sizeOfROI))
+        return false;
+
+    // Iterators that aren't past
+    // the end, on the same element
+    // in different circulations
+
+    auto iter1 = image.begin_ROI(3) + ptrdiff_t(2);
+    auto iter2 = iter1 + sizeOfROI;
+
+    if(iter1 == iter2 || (iter2 - iter1) != sizeOfROI || !(iter1 < iter2))
+        return false;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_IMAGEROIITERATORCHECKS_HPP
@@ -0,0 +1,193 @@
+#ifndef BL_VIDEOTHREADCHECKS_HPP
+#define BL_VIDEOTHREADCHECKS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blVideoThreadChecks.hpp
+// CLASS:           blFailingCaptureSource
+// BASE CLASS:      blCaptureSource
+//
+// PURPOSE:         A capture source that never has a frame to give,
+//                  and functions used to check that the video
+//                  threads neither publish a frame nor spin when
+//                  their queries fail
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blCaptureSource -- The interface implemented
+//                  blVideoThread,blVideoThread2,blVideoThread3 --
+//                                      The video threads checked
+//
+// NOTES:           - Only available when USE_BL_VIDEOTHREAD is
+//                    defined, since the video threads need SFML
+//                  - A spinning thread queries the source millions
+//                    of times in the time the checks run, while a
+//                    thread that backs off queries it a few dozen
+//                    times at most
+//
+// DATE CREATED:    Oct/17/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blFailingCaptureSource : public blCaptureSource
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blFailingCaptureSource() : m_numOfQueries(0)
+    {
+    }
+
+    // Destructor
+
+    ~blFailingCaptureSource()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to grab the
+    // next frame, which always
+    // fails
+
+    virtual IplImage*                       queryFrame()
+    {
+        ++m_numOfQueries;
+
+        return NULL;
+    }
+
+    // Functions used to get/set
+    // the properties of the source
+
+    virtual double                          getProperty(const int& propertyID)const
+    {
+        return 0;
+    }
+
+    virtual int                             setProperty(const int& propertyID,
+                                                        const double& value)
+    {
+        return 0;
+    }
+
+    // Function used to get the
+    // number of failed queries
+
+    unsigned long long                      getNumOfQueries()const
+    {
+        return m_numOfQueries;
+    }
+
+private: // Private variables
+
+    // The number of failed queries
+
+    std::atomic<unsigned long long>         m_numOfQueries;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to run a video thread
+// connected to a failing source for a
+// while, and to check that it neither
+// spun nor told anyone about a frame
+//-------------------------------------------------------------------
+template<typename blVideoThreadType,
+         typename blHasNewFrameFunctorType>
+
+inline bool checkVideoThreadFailedQueries(const blHasNewFrameFunctorType& hasNewFrame,
+                                          const int& runTimeInMilliseconds = 200,
+                                          const unsigned long long& maxNumOfQueries = 200)
+{
+    std::shared_ptr<blFailingCaptureSource> captureSource(new blFailingCaptureSource());
+
+    blVideoThreadType videoThread;
+
+    if(!videoThread.connectToCaptureSource(captureSource))
+        return false;
+
+    videoThread.startCapturingThread();
+
+    bool wasFrameAnnounced = videoThread.waitForNewFrame(runTimeInMilliseconds);
+
+    wasFrameAnnounced = wasFrameAnnounced || hasNewFrame(videoThread);
+
+    videoThread.stopCapturingThread();
+
+    return ( !wasFrameAnnounced &&
+             captureSource->getNumOfQueries() > 0 &&
+             captureSource->getNumOfQueries() <= maxNumOfQueries );
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to check that
+// blVideoThread doesn't flag
+// frames it failed to query
+//-------------------------------------------------------------------
+inline bool checkVideoThreadFailedQueries()
+{
+    return checkVideoThreadFailedQueries<blVideoThread>([](const blVideoThread& videoThread)
+    {
+        return videoThread.isNewFrameAvailable();
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to check that
+// blVideoThread2 doesn't publish
+// frames it failed to query
+//-------------------------------------------------------------------
+inline bool checkVideoThread2FailedQueries()
+{
+    return checkVideoThreadFailedQueries<blVideoThread2>([](const blVideoThread2& videoThread)
+    {
+        return videoThread.hasNewFrame();
+    });
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to check that
+// blVideoThread3 doesn't spin
+// on failed queries
+//-------------------------------------------------------------------
+inline bool checkVideoThread3FailedQueries()
+{
+    return checkVideoThreadFailedQueries<blVideoThread3>([](const blVideoThread3& videoThread)
+    {
+        return ( videoThread.getNumOfQueuedFrames() > 0 ||
+                 videoThread.getNumOfCapturedFrames() > 0 );
+    });
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_VIDEOTHREADCHECKS_HPP
@@ -0,0 +1,311 @@
+#ifndef BL_VIDEOPIPELINEBENCHMARK_HPP
+#define BL_VIDEOPIPELINEBENCHMARK_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blVideoPipelineBenchmark.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Functions used to benchmark the end-to-end
+//                  latency, throughput and drop rate of the
+//                  different video thread classes (frame exchange
+//                  strategies) fed by a synthetic capture source
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    blVideoThread,blVideoThread2,blVideoThread3 --
+//                  The frame exchange strategies benchmarked
+//
+//                  blSyntheticCaptureSource -- Used to generate
+//                                              stamped frames at
+//                                              a controlled rate
+//
+// NOTES:           - The latency of a frame is measured from the
+//                    time the synthetic source made it due to the
+//                    time the consumer got hold of it
+//                  - A frame counts as dropped when the consumer
+//                    never saw it, whether it was skipped by the
+//                    source (the capturing thread was late) or
+//                    overwritten/dropped by the video thread
+//                  - The consumer simulates its own processing by
+//                    sleeping for the given time after each frame
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The results of a benchmark run
+//-------------------------------------------------------------------
+struct blVideoPipelineBenchmarkResults
+{
+    std::string                             m_strategyName;
+
+    long long                               m_numOfGeneratedFrames = 0;
+    long long                               m_numOfReceivedFrames = 0;
+    double                                  m_dropRate = 0;
+    double                                  m_throughputInFPS = 0;
+
+    double                                  m_meanLatencyInMilliseconds = 0;
+    double                                  m_medianLatencyInMilliseconds = 0;
+    double                                  m_99thPercentileLatencyInMilliseconds = 0;
+    double                                  m_maxLatencyInMilliseconds = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Class used to collect the stamps
+// of the frames received by the
+// consumer during a benchmark run
+//-------------------------------------------------------------------
+class blVideoPipelineBenchmarkRecorder
+{
+public: // Public functions
+
+    // Function used to record
+    // a frame the moment the
+    // consumer received it
+
+    void                                    recordFrame(const IplImage* frame);
+
+    // Function used to compute
+    // the results of the run
+
+    blVideoPipelineBenchmarkResults         getResults(const std::string& strategyName,
+                                                       const double& durationInMilliseconds)const;
+
+public: // Public variables
+
+    // Frames popped from the ring
+    // video threads, which are kept
+    // and recycled from call to call
+
+    std::vector<blTimestampedFrame>         m_poppedFrames;
+
+private: // Private variables
+
+    std::vector<double>                     m_latencies;
+    unsigned long long                      m_firstFrameNumber = 0;
+    unsigned long long                      m_lastFrameNumber = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoPipelineBenchmarkRecorder::recordFrame(const IplImage* frame)
+{
+    std::chrono::steady_clock::time_point receiveTime = std::chrono::steady_clock::now();
+
+    unsigned long long frameNumber = 0;
+    std::chrono::steady_clock::time_point captureTime;
+
+    if(!blSyntheticCaptureSource::readFrameStamp(frame,frameNumber,captureTime))
+        return;
+
+    if(m_latencies.empty())
+        m_firstFrameNumber = frameNumber;
+
+    m_lastFrameNumber = frameNumber;
+
+    m_latencies.push_back(std::chrono::duration<double,std::milli>(receiveTime - captureTime).count());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blVideoPipelineBenchmarkResults blVideoPipelineBenchmarkRecorder::getResults(const std::string& strategyName,
+                                                                                    const double& durationInMilliseconds)const
+{
+    blVideoPipelineBenchmarkResults results;
+
+    results.m_strategyName = strategyName;
+
+    if(m_latencies.empty())
+        return results;
+
+    // Every frame between the first and
+    // last received ones was generated,
+    // so the missing ones were dropped
+
+    results.m_numOfGeneratedFrames = (long long)(m_lastFrameNumber - m_firstFrameNumber) + 1;
+    results.m_numOfReceivedFrames = (long long)(m_latencies.size());
+    results.m_dropRate = 1.0 - double(results.m_numOfReceivedFrames) / double(results.m_numOfGeneratedFrames);
+
+    if(durationInMilliseconds > 0)
+        results.m_throughputInFPS = 1000.0 * double(results.m_numOfReceivedFrames) / durationInMilliseconds;
+
+    std::vector<double> sortedLatencies = m_latencies;
+    std::sort(sortedLatencies.begin(),sortedLatencies.end());
+
+    double sumOfLatencies = 0;
+
+    for(int i = 0; i < int(sortedLatencies.size()); ++i)
+        sumOfLatencies += sortedLatencies[i];
+
+    int numOfLatencies = int(sortedLatencies.size());
+
+    results.m_meanLatencyInMilliseconds = sumOfLatencies / double(numOfLatencies);
+    results.m_medianLatencyInMilliseconds = sortedLatencies[(numOfLatencies - 1) / 2];
+    results.m_99thPercentileLatencyInMilliseconds = sortedLatencies[std::max(0,int(std::ceil(0.99 * numOfLatencies)) - 1)];
+    results.m_maxLatencyInMilliseconds = sortedLatencies.back();
+
+    return results;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used by the consumer to
+// receive the new frames of each kind
+// of video thread
+//-------------------------------------------------------------------
+inline void receiveNewFrames(blVideoThread& videoThread,
+                             blVideoPipelineBenchmarkRecorder& recorder,
+                             const double& processingTimeInMilliseconds)
+{
+    if(!videoThread.waitForNewFrame(100))
+        return;
+
+    recorder.recordFrame(videoThread.getFrame().getImagePtr());
+
+    std::this_thread::sleep_for(std::chrono::duration<double,std::milli>(processingTimeInMilliseconds));
+
+    videoThread.letThreadQueryAnotherFrame();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void receiveNewFrames(blVideoThread2& videoThread,
+                             blVideoPipelineBenchmarkRecorder& recorder,
+                             const double& processingTimeInMilliseconds)
+{
+    if(!videoThread.waitForNewFrame(100))
+        return;
+
+    recorder.recordFrame(videoThread.getFrame().getImagePtr());
+
+    std::this_thread::sleep_for(std::chrono::duration<double,std::milli>(processingTimeInMilliseconds));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void receiveNewFrames(blVideoThread3& videoThread,
+                             blVideoPipelineBenchmarkRecorder& recorder,
+                             const double& processingTimeInMilliseconds)
+{
+    if(!videoThread.waitForNewFrame(100))
+        return;
+
+    int numOfPoppedFrames = videoThread.popFrames(recorder.m_poppedFrames);
+
+    for(int i = 0; i < numOfPoppedFrames; ++i)
+    {
+        recorder.recordFrame(recorder.m_poppedFrames[i].m_frame.getImagePtr());
+
+        std::this_thread::sleep_for(std::chrono::duration<double,std::milli>(processingTimeInMilliseconds));
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to benchmark one
+// video thread (which gets connected
+// to the synthetic source passed in)
+//-------------------------------------------------------------------
+template<typename blVideoThreadType>
+inline blVideoPipelineBenchmarkResults benchmarkVideoThread(blVideoThreadType& videoThread,
+                                                            const std::shared_ptr<blSyntheticCaptureSource>& captureSource,
+                                                            const std::string& strategyName,
+                                                            const double& durationInMilliseconds,
+                                                            const double& processingTimeInMilliseconds = 0)
+{
+    blVideoPipelineBenchmarkRecorder recorder;
+
+    captureSource->restart();
+
+    videoThread.connectToCaptureSource(captureSource);
+    videoThread.startCapturingThread();
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point endTime = startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double,std::milli>(durationInMilliseconds));
+
+    while(std::chrono::steady_clock::now() < endTime)
+        receiveNewFrames(videoThread,recorder,processingTimeInMilliseconds);
+
+    double elapsedTimeInMilliseconds = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    videoThread.stopCapturingThread();
+    videoThread.disconnectDevice();
+
+    return recorder.getResults(strategyName,elapsedTimeInMilliseconds);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to benchmark every
+// frame exchange strategy with the
+// same synthetic source settings
+//-------------------------------------------------------------------
+inline std::vector<blVideoPipelineBenchmarkResults> benchmarkFrameExchangeStrategies(const int& width,
+                                                                                     const int& height,
+                                                                                     const double& FPS,
+                                                                                     const double& durationInMilliseconds,
+                                                                                     const double& processingTimeInMilliseconds = 0,
+                                                                                     const double& jitterInMilliseconds = 0,
+                                                                                     const blSyntheticPattern& pattern = BL_MOVING_GRADIENT_PATTERN,
+                                                                                     const int& numOfFramesInRing = 4)
+{
+    std::vector<blVideoPipelineBenchmarkResults> results;
+
+    std::shared_ptr<blSyntheticCaptureSource> captureSource(new blSyntheticCaptureSource(width,height,FPS,pattern,jitterInMilliseconds));
+
+    {
+        blVideoThread videoThread;
+        results.push_back(benchmarkVideoThread(videoThread,captureSource,"blVideoThread (handshake)",durationInMilliseconds,processingTimeInMilliseconds));
+    }
+
+    {
+        blVideoThread2 videoThread;
+        results.push_back(benchmarkVideoThread(videoThread,captureSource,"blVideoThread2 (triple buffer)",durationInMilliseconds,processingTimeInMilliseconds));
+    }
+
+    {
+        blVideoThread3 videoThread(numOfFramesInRing,BL_DROP_OLDEST_FRAME);
+        results.push_back(benchmarkVideoThread(videoThread,captureSource,"blVideoThread3 (ring, drop oldest)",durationInMilliseconds,processingTimeInMilliseconds));
+    }
+
+    {
+        blVideoThread3 videoThread(numOfFramesInRing,BL_BLOCK_WHEN_FULL);
+        results.push_back(benchmarkVideoThread(videoThread,captureSource,"blVideoThread3 (ring, block)",durationInMilliseconds,processingTimeInMilliseconds));
+    }
+
+    return results;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_VIDEOPIPELINEBENCHMARK_HPP
@@ -27,10 +27,20 @@
 //                  blImage -- We use a blImage to store the
 //                             last captured frame
 //
-// NOTES:
+// NOTES:           - The capturing thread and the consumer talk
+//                    through atomics and condition variables:
+//                    - The capturing thread sleeps while paused
+//                      and while the last frame has not yet been
+//                      released by the consumer
+//                    - The consumer can block on waitForNewFrame
+//                      (with an optional timeout) instead of
+//                      polling isNewFrameAvailable
+//                  - stopCapturingThread wakes the capturing thread
+//                    up and waits for it to finish its last query,
+//                    instead of terminating it
 //
 // DATE CREATED:    Feb/03/2011
-// DATE UPDATED:
+// DATE UPDATED:    Oct/16/2026
 //-------------------------------------------------------------------
 
 
@@ -72,7 +82,17 @@ public: // Public functions
     // Function used to know whether
     // there's a new image available
 
-    const bool&                                 isNewFrameAvailable()const;
+    bool                                        isNewFrameAvailable()const;
+
+    // Function used to wait until
+    // there's a new image available
+    // - A negative timeout waits
+    //   until a frame arrives or the
+    //   thread stops
+    // - It returns whether a new
+    //   frame is available
+
+    bool                                        waitForNewFrame(const int& timeoutInMilliseconds = -1)const;
 
     // Function used to tell the video
     // thread that we grabbed the frame
@@ -91,6 +111,45 @@ public: // Public functions
 
     const blImage< blColor3<unsigned char> >&   getFrame()const;
 
+protected: // Protected functions
+
+    // Function used by the capturing
+    // thread to sleep until it can
+    // query another frame
+    // - It returns false when the
+    //   thread should terminate
+
+    bool                                        waitUntilFrameCanBeQueried(const bool& shouldWaitForConsumer);
+
+    // Function used by the capturing
+    // thread to wake up the threads
+    // waiting for a new frame
+
+    void                                        notifyNewFrame()const;
+
+    // Function used by the capturing
+    // thread to back off for a little
+    // while after a failed query,
+    // instead of spinning on a source
+    // that has no frame to give
+    // - It wakes up early when the
+    //   thread is told to terminate
+
+    void                                        backOffAfterFailedQuery();
+
+    // Function used to wait until
+    // a new frame is available as
+    // told by the passed predicate
+
+    template<typename blPredicateType>
+    bool                                        waitForNewFrame(const int& timeoutInMilliseconds,
+                                                                const blPredicateType& isFrameAvailable)const;
+
+    // Function used to tell the
+    // capturing thread to stop
+
+    void                                        signalCapturingThreadToTerminate();
+
 protected: // Protected variables
 
     // Frame image used in this thread
@@ -100,18 +159,28 @@ protected: // Protected variables
     // Boolean variable used to
     // continue/terminate the thread
 
-    bool                                        m_isCapturingThreadToBeTerminated;
+    std::atomic<bool>                           m_isCapturingThreadToBeTerminated;
 
     // Boolean variable used for
     // pausing the video grabbing
 
-    bool                                        m_isCapturingThreadPaused;
+    std::atomic<bool>                           m_isCapturingThreadPaused;
 
     // Boolean variable used
     // to check if new image
     // is available from this thread
 
-    bool                                        m_isNewFrameAvailable;
+    std::atomic<bool>                           m_isNewFrameAvailable;
+
+    // Mutex and condition variables
+    // used to wake up the capturing
+    // thread when its state changes
+    // and the consumers when a new
+    // frame is available
+
+    mutable std::mutex                          m_stateMutex;
+    std::condition_variable                     m_stateChanged;
+    mutable std::condition_variable             m_newFrameCaptured;
 
     // The thread that will
     // keep running the thread
@@ -149,11 +218,18 @@ inline void blVideoThread::startCapturingThread()
     // Check if the capture device has been set
     if(this->isConnected())
     {
+        // In case the thread stopped
+        // by itself (the device got
+        // disconnected) we wait for it
+        m_thread.wait();
+
+        // Set boolean so that thread will
+        // run (before launching it, so that
+        // the thread doesn't see the old value)
+        m_isCapturingThreadToBeTerminated = false;
+
         // Since we have a capture device, we start the thread
         m_thread.launch();
-
-        // Set boolean so that thread will run
-        m_isCapturingThreadToBeTerminated = false;
         return;
     }
 
@@ -174,11 +250,99 @@ inline void blVideoThread::stopCapturingThread()
 {
     // Set the boolean in order
     // to terminate the thread
-    m_isCapturingThreadToBeTerminated = true;
+    // and wake it up in case
+    // it's sleeping
+    signalCapturingThreadToTerminate();
+
+    // Here we wait for the thread
+    // to finish its last query
+    m_thread.wait();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread::signalCapturingThreadToTerminate()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_isCapturingThreadToBeTerminated = true;
+    }
+
+    m_stateChanged.notify_all();
+    m_newFrameCaptured.notify_all();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoThread::waitUntilFrameCanBeQueried(const bool& shouldWaitForConsumer)
+{
+    std::unique_lock<std::mutex> lock(m_stateMutex);
+
+    // We sleep while paused and (if
+    // asked to) while the consumer
+    // still holds the last frame
+
+    m_stateChanged.wait(lock,[&]()
+    {
+        return ( m_isCapturingThreadToBeTerminated ||
+                 ( !m_isCapturingThreadPaused &&
+                   (!shouldWaitForConsumer || !m_isNewFrameAvailable) ) );
+    });
+
+    return !m_isCapturingThreadToBeTerminated;
+}
+//-------------------------------------------------------------------
+
 
-    // Here we just terminate
-    // the running thread
-    m_thread.terminate();
+//-------------------------------------------------------------------
+inline void blVideoThread::notifyNewFrame()const
+{
+    // Taking the lock makes sure a
+    // consumer can't miss the signal
+    // between checking for a frame
+    // and going to sleep
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+    }
+
+    m_newFrameCaptured.notify_all();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread::backOffAfterFailedQuery()
+{
+    std::unique_lock<std::mutex> lock(m_stateMutex);
+
+    m_stateChanged.wait_for(lock,std::chrono::milliseconds(10),[&]()
+    {
+        return m_isCapturingThreadToBeTerminated.load();
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blPredicateType>
+inline bool blVideoThread::waitForNewFrame(const int& timeoutInMilliseconds,
+                                           const blPredicateType& isFrameAvailable)const
+{
+    std::unique_lock<std::mutex> lock(m_stateMutex);
+
+    auto isWaitOver = [&]()
+    {
+        return ( isFrameAvailable() || m_isCapturingThreadToBeTerminated );
+    };
+
+    if(timeoutInMilliseconds < 0)
+        m_newFrameCaptured.wait(lock,isWaitOver);
+    else
+        m_newFrameCaptured.wait_for(lock,std::chrono::milliseconds(timeoutInMilliseconds),isWaitOver);
+
+    return isFrameAvailable();
 }
 //-------------------------------------------------------------------
 
@@ -186,30 +350,36 @@ inline void blVideoThread::stopCapturingThread()
 //-------------------------------------------------------------------
 inline void blVideoThread::threadLoop()
 {
-    while(!m_isCapturingThreadToBeTerminated)
+    // We sleep until the consumer
+    // releases the last frame, or
+    // while the thread is paused
+    while(waitUntilFrameCanBeQueried(true))
     {
-        if(!m_isCapturingThreadPaused &&
-           !m_isNewFrameAvailable &&
-           !m_isCapturingThreadToBeTerminated)
+        // If we cannot successfully query
+        // a frame, then we just stop the
+        // capturing thread
+        if(this->isConnected())
         {
-            // If we cannot successfully query
-            // a frame, then we just stop the
-            // capturing thread
-            if(this->isConnected())
-            {
-                // Query a new frame and
-                // signal that a new frame
-                // is available
-                this->queryFrame(m_frame);
-                m_isNewFrameAvailable = true;
-            }
-            else
+            // Query a new frame and
+            // signal that a new frame
+            // is available, or back off
+            // when there was no frame
+            // to query
+            if(!this->queryFrame(m_frame))
             {
-                // The capturing device got
-                // disconnected, so we stop
-                // this capturing thread
-                m_isCapturingThreadToBeTerminated = true;
+                backOffAfterFailedQuery();
+                continue;
             }
+
+            m_isNewFrameAvailable = true;
+            notifyNewFrame();
+        }
+        else
+        {
+            // The capturing device got
+            // disconnected, so we stop
+            // this capturing thread
+            signalCapturingThreadToTerminate();
         }
     }
 }
@@ -221,10 +391,12 @@ inline void blVideoThread::pauseCapturingThread()
 {
     // If the thread is currently paused, then
     // we unpause otherwise we pause it
-    if(m_isCapturingThreadPaused)
-        m_isCapturingThreadPaused = false;
-    else
-        m_isCapturingThreadPaused = true;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_isCapturingThreadPaused = !m_isCapturingThreadPaused;
+    }
+
+    m_stateChanged.notify_all();
 }
 //-------------------------------------------------------------------
 
@@ -238,17 +410,36 @@ inline const blImage< blColor3<unsigned char> >& blVideoThread::getFrame()const
 
 
 //-------------------------------------------------------------------
-inline const bool& blVideoThread::isNewFrameAvailable()const
+inline bool blVideoThread::isNewFrameAvailable()const
 {
     return m_isNewFrameAvailable;
 }
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+inline bool blVideoThread::waitForNewFrame(const int& timeoutInMilliseconds)const
+{
+    return waitForNewFrame(timeoutInMilliseconds,[this]()
+    {
+        return bool(m_isNewFrameAvailable);
+    });
+}
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 inline void blVideoThread::letThreadQueryAnotherFrame()
 {
-    m_isNewFrameAvailable = false;
+    // Wake up the capturing thread
+    // so that it queries the next
+    // frame
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_isNewFrameAvailable = false;
+    }
+
+    m_stateChanged.notify_all();
 }
 //-------------------------------------------------------------------
 
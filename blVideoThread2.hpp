@@ -9,8 +9,8 @@
 //
 // PURPOSE:         Based on blVideoThread, this class has a buffer
 //                  that is always available and the same size,
-//                  and that new pixel data is fed serially to the
-//                  frame buffer
+//                  and that new frames are fed to without ever
+//                  blocking the capturing thread
 //
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
@@ -25,14 +25,30 @@
 //                                     grab frames from a video source
 //                  blImage -- We use a blImage to store the
 //                             last captured frame
+//                  std::atomic -- Used to hand the frame buffers
+//                                 over between the threads
 //
 // NOTES:           - The difference in this class is that the
-//                    frame buffer is always available and that
-//                    new data is continuously fed to the image
-//                    one pixel at a time
+//                    frame buffer is always available
+//                  - Frames are exchanged using three buffers:
+//                    - The capturing thread queries frames into
+//                      the "back" buffer
+//                    - A finished frame is published by swapping
+//                      the back buffer with the "middle" buffer
+//                    - getFrame swaps the middle buffer with the
+//                      "front" buffer (only when a newer frame
+//                      was published) and returns the front buffer
+//                  - Buffers are handed over by swapping their
+//                    indices with a single atomic exchange, so the
+//                    capturing thread never blocks, no pixel is
+//                    ever copied and the frame returned by getFrame
+//                    is never written to while the caller uses it
+//                  - The frame returned by getFrame stays valid
+//                    until the next call to getFrame, which should
+//                    only be called from one (consumer) thread
 //
 // DATE CREATED:    May/10/2011
-// DATE UPDATED:
+// DATE UPDATED:    Oct/16/2026
 //-------------------------------------------------------------------
 
 
@@ -61,6 +77,10 @@ public: // Constructors and destructors
 
     ~blVideoThread2()
     {
+        // The thread has to stop before
+        // the frame buffers are destroyed
+
+        stopCapturingThread();
     }
 
 public: // Public functions
@@ -70,42 +90,63 @@ public: // Public functions
 
     virtual void                                threadLoop();
 
-    // Function used to get
-    // the captured frame
+    // Function used to get the
+    // newest captured frame
 
     const blImage< blColor3<unsigned char> >&   getFrame()const;
 
+    // Function used to know whether
+    // a frame newer than the one
+    // returned by the last call to
+    // getFrame has been captured
+
+    bool                                        hasNewFrame()const;
+
+    // Function used to wait until
+    // a frame newer than the one
+    // returned by the last call to
+    // getFrame has been captured
+
+    bool                                        waitForNewFrame(const int& timeoutInMilliseconds = -1)const;
+
 protected: // Protected variables
 
-    // Frame image buffer which is
-    // used to always have a buffer
-    // available to read continuously
+    // The three frame buffers
+    // that get handed over
+    // between the threads
 
-    blImage< blColor3<unsigned char> >          m_frameBuffer;
+    blImage< blColor3<unsigned char> >          m_frameBuffers[3];
 
 private: // Private functions
 
-    // Function used to resize the
-    // frame buffer to match the
-    // size of the main capturing
-    // frame
+    // Function used by the capturing
+    // thread to publish the frame
+    // in the back buffer
+
+    void                                        publishBackBuffer();
 
-    void                                        resizeFrameBuffer();
+private: // Private variables
 
-    // Function used to copy the
-    // frame into the frame buffer
+    // The state of the middle
+    // buffer, which holds its
+    // index and a flag telling
+    // whether it holds a frame
+    // that was not yet read
 
-    void                                        copyFrameIntoFrameBuffer();
+    static const int                            m_bufferIndexMask = 3;
+    static const int                            m_newFrameFlag = 4;
 
-private: // Private variables
+    mutable std::atomic<int>                    m_middleBufferState;
 
-    // Variable used to check whether
-    // the frame buffer is being resized.
-    // This prevents the main program thread
-    // to try to read the buffer while we're
-    // resizing it
+    // Index of the buffer owned
+    // by the capturing thread
 
-    bool                                        m_isFrameBufferBeingResized;
+    int                                         m_backBufferIndex;
+
+    // Index of the buffer owned
+    // by the consumer thread
+
+    mutable int                                 m_frontBufferIndex;
 };
 //-------------------------------------------------------------------
 
@@ -113,8 +154,13 @@ private: // Private variables
 //-------------------------------------------------------------------
 inline blVideoThread2::blVideoThread2() : blVideoThread()
 {
-    // Default the booleans
-    m_isFrameBufferBeingResized = false;
+    // The buffers start out
+    // owned by the back, middle
+    // and front respectively
+
+    m_backBufferIndex = 0;
+    m_middleBufferState = 1;
+    m_frontBufferIndex = 2;
 }
 //-------------------------------------------------------------------
 
@@ -122,49 +168,42 @@ inline blVideoThread2::blVideoThread2() : blVideoThread()
 //-------------------------------------------------------------------
 inline void blVideoThread2::threadLoop()
 {
-    while(!m_isCapturingThreadToBeTerminated)
+    // The capturing thread only
+    // sleeps while paused, since
+    // it never waits for the
+    // consumer
+
+    while(waitUntilFrameCanBeQueried(false))
     {
-        if(!m_isCapturingThreadPaused &&
-           !m_isCapturingThreadToBeTerminated)
+        // If we cannot successfully query
+        // a frame, then we just stop the
+        // capturing thread
+
+        if(this->isConnected())
         {
-            // If we cannot successfully query
-            // a frame, then we just stop the
-            // capturing thread
+            // Query a new frame straight
+            // into the back buffer (which
+            // nobody else is reading) and
+            // publish it, or back off when
+            // there was no frame to query
 
-            if(this->isConnected())
+            if(!this->queryFrame(m_frameBuffers[m_backBufferIndex]))
             {
-                // Query a new frame and
-                // signal that a new frame
-                // is available
-
-                this->queryFrame(m_frame);
-
-                // Now that we have a frame
-                // we simply copy it to the
-                // buffer
-                // Let's make sure that the
-                // frame buffer is the same
-                // size as the frame
-
-                if(m_frameBuffer.size1() != this->m_frame.size1() ||
-                   m_frameBuffer.size2() != this->m_frame.size2())
-                {
-                    resizeFrameBuffer();
-                }
+                backOffAfterFailedQuery();
+                continue;
+            }
 
-                // Copy the frame into
-                // the frame buffer
+            publishBackBuffer();
 
-                copyFrameIntoFrameBuffer();
-            }
-            else
-            {
-                // The capturing device got
-                // disconnected, so we stop
-                // this capturing thread
+            notifyNewFrame();
+        }
+        else
+        {
+            // The capturing device got
+            // disconnected, so we stop
+            // this capturing thread
 
-                m_isCapturingThreadToBeTerminated = true;
-            }
+            signalCapturingThreadToTerminate();
         }
     }
 }
@@ -172,32 +211,37 @@ inline void blVideoThread2::threadLoop()
 
 
 //-------------------------------------------------------------------
-inline void blVideoThread2::resizeFrameBuffer()
+inline void blVideoThread2::publishBackBuffer()
 {
-    m_isFrameBufferBeingResized = true;
+    // The back buffer becomes the
+    // middle buffer (flagged as new)
+    // and we take over the old
+    // middle buffer, whether or not
+    // its frame was ever read
 
-    // Resize the frame buffer
+    int oldMiddleBufferState = m_middleBufferState.exchange(m_backBufferIndex | m_newFrameFlag,
+                                                            std::memory_order_acq_rel);
 
-    m_frameBuffer.create(this->m_frame.size1(),
-                         this->m_frame.size2());
+    m_backBufferIndex = oldMiddleBufferState & m_bufferIndexMask;
+}
+//-------------------------------------------------------------------
 
-    // Reset the resizing flag
 
-    m_isFrameBufferBeingResized = false;
+//-------------------------------------------------------------------
+inline bool blVideoThread2::hasNewFrame()const
+{
+    return ( (m_middleBufferState.load(std::memory_order_acquire) & m_newFrameFlag) != 0 );
 }
 //-------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------
-inline void blVideoThread2::copyFrameIntoFrameBuffer()
+inline bool blVideoThread2::waitForNewFrame(const int& timeoutInMilliseconds)const
 {
-    for(int i = 0; i < m_frameBuffer.size1(); ++i)
+    return blVideoThread::waitForNewFrame(timeoutInMilliseconds,[this]()
     {
-        for(int j = 0; j < m_frameBuffer.size2(); ++j)
-        {
-            m_frameBuffer[i][j] = this->m_frame[i][j];
-        }
-    }
+        return hasNewFrame();
+    });
 }
 //-------------------------------------------------------------------
 
@@ -205,24 +249,21 @@ inline void blVideoThread2::copyFrameIntoFrameBuffer()
 //-------------------------------------------------------------------
 inline const blImage< blColor3<unsigned char> >& blVideoThread2::getFrame()const
 {
-    // Since this function is being called
-    // from the main program thread or another
-    // thread, we could be currently resizing
-    // the frame buffer, and thus we could
-    // have a problem
-    // So if we're currently resizing the
-    // frame buffer, we wait till the
-    // buffer is resized
-
-    while(m_isFrameBufferBeingResized)
+    // If a newer frame was
+    // published, the front buffer
+    // is swapped with the middle
+    // buffer, otherwise we keep
+    // returning the same frame
+
+    if(hasNewFrame())
     {
-    }
+        int oldMiddleBufferState = m_middleBufferState.exchange(m_frontBufferIndex,
+                                                                std::memory_order_acq_rel);
 
-    // By now we know that the frame
-    // buffer has been resized, so we
-    // simply return it
+        m_frontBufferIndex = oldMiddleBufferState & m_bufferIndexMask;
+    }
 
-    return m_frameBuffer;
+    return m_frameBuffers[m_frontBufferIndex];
 }
 //-------------------------------------------------------------------
 
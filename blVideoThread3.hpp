@@ -0,0 +1,634 @@
+#ifndef BL_VIDEOTHREAD3_HPP
+#define BL_VIDEOTHREAD3_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blVideoThread3.hpp
+// CLASS:           blVideoThread3
+// BASE CLASS:      blVideoThread
+//
+// PURPOSE:         Based on blVideoThread, this class keeps the
+//                  last N captured frames in a ring of preallocated
+//                  frames, each one stamped with its capture time
+//                  and sequence number, so that consumers can
+//                  process batches of frames without copying them
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+// DEPENDENCIES:    blVideoThread -- The base thread class
+//
+//                  std::chrono -- Used to timestamp the frames
+//
+// NOTES:           - The capturing thread queries each frame into
+//                    its own "capture" slot and, once done, swaps
+//                    it into the ring, so the lock is never held
+//                    while a frame is being queried
+//                  - Consumers pop frames by swapping them with the
+//                    frames they pass in, which are recycled as
+//                    storage for the next captures, so no pixel
+//                    is ever copied and, after the first few frames,
+//                    no image is ever allocated
+//                  - A frame passed to the pop functions should
+//                    not be shared with any other image, since
+//                    the capturing thread will write into it
+//                  - When the ring is full, the drop policy decides
+//                    whether the oldest queued frame or the newly
+//                    captured frame is dropped, or whether the
+//                    capturing thread waits for the consumer
+//                  - Sequence numbers keep counting dropped frames,
+//                    so a gap between two popped frames tells how
+//                    many frames were dropped (or skipped) in between
+//                  - The dropped frames count only the frames lost
+//                    because the ring was full, the older frames
+//                    that popNewestFrames skips on purpose are
+//                    counted separately as skipped frames
+//
+// DATE CREATED:    Oct/16/2026
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Includes and libs needed for this file
+//-------------------------------------------------------------------
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Enums needed for this file
+//-------------------------------------------------------------------
+enum blFrameDropPolicy
+{
+    BL_DROP_OLDEST_FRAME = 0,
+    BL_DROP_NEWEST_FRAME,
+    BL_BLOCK_WHEN_FULL
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A captured frame along with
+// the time it was captured at
+// and its sequence number
+//-------------------------------------------------------------------
+struct blTimestampedFrame
+{
+    blImage< blColor3<unsigned char> >          m_frame;
+    std::chrono::steady_clock::time_point       m_captureTime;
+    unsigned long long                          m_sequenceNumber = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+class blVideoThread3 : public blVideoThread
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blVideoThread3(const int& numOfFramesInRing = 4,
+                   const blFrameDropPolicy& dropPolicy = BL_DROP_OLDEST_FRAME);
+
+    // Destructor
+
+    ~blVideoThread3()
+    {
+        // The thread has to stop before
+        // the ring is destroyed
+
+        stopCapturingThread();
+    }
+
+public: // Public functions
+
+    // Function that gets called
+    // when thread is running
+
+    virtual void                                threadLoop();
+
+    // Functions used to set/get the
+    // number of frames in the ring
+    // - Setting it discards the
+    //   queued frames
+
+    void                                        setRingSize(const int& numOfFramesInRing);
+    int                                         getRingSize()const;
+
+    // Functions used to set/get
+    // what happens when a frame
+    // is captured while the ring
+    // is full
+
+    void                                        setDropPolicy(const blFrameDropPolicy& dropPolicy);
+    blFrameDropPolicy                           getDropPolicy()const;
+
+    // Function used to get the
+    // number of frames waiting
+    // to be popped
+
+    int                                         getNumOfQueuedFrames()const;
+
+    // Functions used to wait until
+    // one (or the specified number
+    // of) frames are queued
+    // - A negative timeout waits
+    //   until the frames arrive or
+    //   the thread stops
+
+    bool                                        waitForNewFrame(const int& timeoutInMilliseconds = -1)const;
+    bool                                        waitForFrames(const int& numOfFrames,
+                                                              const int& timeoutInMilliseconds = -1)const;
+
+    // Function used to pop the
+    // oldest queued frame
+    // - It returns false when
+    //   no frame is queued
+
+    bool                                        popOldestFrame(blTimestampedFrame& frame);
+
+    // Function used to pop up to
+    // maxNumOfFrames of the oldest
+    // queued frames (all of them
+    // when negative) into the first
+    // elements of the passed vector,
+    // oldest first
+    // - The vector only grows, so
+    //   that passing the same vector
+    //   keeps recycling its frames
+    // - It returns the number of
+    //   popped frames
+
+    int                                         popFrames(std::vector<blTimestampedFrame>& frames,
+                                                          const int& maxNumOfFrames = -1);
+
+    // Function used to pop the
+    // newest numOfFrames queued
+    // frames, oldest first, the
+    // same way as popFrames
+    // - The older queued frames
+    //   are skipped (they're counted
+    //   as skipped, not as dropped)
+
+    int                                         popNewestFrames(std::vector<blTimestampedFrame>& frames,
+                                                                const int& numOfFrames);
+
+    // Functions used to get the
+    // number of captured frames, the
+    // number of frames that got
+    // dropped because the ring was full
+    // and the number of frames that
+    // popNewestFrames skipped
+
+    unsigned long long                          getNumOfCapturedFrames()const;
+    unsigned long long                          getNumOfDroppedFrames()const;
+    unsigned long long                          getNumOfSkippedFrames()const;
+
+private: // Private functions
+
+    // Function used by the capturing
+    // thread to wait for a free slot
+    // when the ring is full and the
+    // policy is to block
+    // - It also preallocates the ring
+    //   frames when the ring changed
+    // - It returns false when the
+    //   thread should terminate
+
+    bool                                        waitUntilRingHasRoom();
+
+    // Function used by the capturing
+    // thread to swap the captured
+    // frame into the ring
+
+    void                                        pushCapturedFrame();
+
+    // Function used to pop the
+    // oldest queued frames
+    // (called with the lock held)
+
+    int                                         popQueuedFrames(std::vector<blTimestampedFrame>& frames,
+                                                                const int& numOfFrames);
+
+    // Function used to allocate
+    // the frames in the ring to
+    // the size of the captured frames
+    // (called by the capturing thread
+    // with the lock held, so that it
+    // never queries the device while
+    // a frame is being queried)
+
+    void                                        preallocateFrames();
+
+private: // Private variables
+
+    // The ring of frames and the
+    // position and number of the
+    // queued frames in it
+    // (protected by the state mutex)
+
+    std::vector<blTimestampedFrame>             m_ring;
+    int                                         m_oldestFrameIndex;
+    int                                         m_numOfQueuedFrames;
+
+    // The policy used when
+    // the ring is full
+    // (protected by the state mutex)
+
+    blFrameDropPolicy                           m_dropPolicy;
+
+    // Whether the ring frames have
+    // to be allocated before the
+    // next frame is queried
+    // (protected by the state mutex)
+
+    bool                                        m_areFramesToBePreallocated;
+
+    // The frame owned by the
+    // capturing thread that new
+    // frames are queried into
+
+    blTimestampedFrame                          m_captureSlot;
+
+    // The frame counters
+
+    std::atomic<unsigned long long>             m_numOfCapturedFrames;
+    std::atomic<unsigned long long>             m_numOfDroppedFrames;
+    std::atomic<unsigned long long>             m_numOfSkippedFrames;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blVideoThread3::blVideoThread3(const int& numOfFramesInRing,
+                                      const blFrameDropPolicy& dropPolicy) : blVideoThread()
+{
+    m_oldestFrameIndex = 0;
+    m_numOfQueuedFrames = 0;
+    m_dropPolicy = dropPolicy;
+    m_numOfCapturedFrames = 0;
+    m_numOfDroppedFrames = 0;
+    m_numOfSkippedFrames = 0;
+    m_areFramesToBePreallocated = true;
+
+    m_ring.resize(std::max(1,numOfFramesInRing));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread3::setRingSize(const int& numOfFramesInRing)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        m_ring.resize(std::max(1,numOfFramesInRing));
+        m_oldestFrameIndex = 0;
+        m_numOfQueuedFrames = 0;
+        m_isNewFrameAvailable = false;
+        m_areFramesToBePreallocated = true;
+    }
+
+    // Wake up the capturing thread
+    // in case it's waiting for room
+
+    m_stateChanged.notify_all();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoThread3::getRingSize()const
+{
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+    return int(m_ring.size());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread3::setDropPolicy(const blFrameDropPolicy& dropPolicy)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_dropPolicy = dropPolicy;
+    }
+
+    m_stateChanged.notify_all();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blFrameDropPolicy blVideoThread3::getDropPolicy()const
+{
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+    return m_dropPolicy;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoThread3::getNumOfQueuedFrames()const
+{
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+    return m_numOfQueuedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline unsigned long long blVideoThread3::getNumOfCapturedFrames()const
+{
+    return m_numOfCapturedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline unsigned long long blVideoThread3::getNumOfDroppedFrames()const
+{
+    return m_numOfDroppedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline unsigned long long blVideoThread3::getNumOfSkippedFrames()const
+{
+    return m_numOfSkippedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread3::preallocateFrames()
+{
+    if(!this->isConnected())
+        return;
+
+    CvSize frameSize = this->getFrameSize();
+
+    for(int i = 0; i < int(m_ring.size()); ++i)
+    {
+        if(m_ring[i].m_frame.size1() != frameSize.height ||
+           m_ring[i].m_frame.size2() != frameSize.width)
+        {
+            m_ring[i].m_frame.create(frameSize.height,frameSize.width);
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread3::threadLoop()
+{
+    // The capturing thread only
+    // sleeps while paused or, when
+    // the policy is to block, while
+    // the ring is full
+
+    while(waitUntilFrameCanBeQueried(false))
+    {
+        // If we cannot successfully query
+        // a frame, then we just stop the
+        // capturing thread
+
+        if(this->isConnected())
+        {
+            if(!waitUntilRingHasRoom())
+                break;
+
+            // Query the frame outside
+            // of the lock, straight into
+            // the capture slot, which
+            // nobody else is reading, or
+            // back off when there was no
+            // frame to query
+
+            if(!this->queryFrameInto(m_captureSlot.m_frame))
+            {
+                backOffAfterFailedQuery();
+                continue;
+            }
+
+            m_captureSlot.m_captureTime = std::chrono::steady_clock::now();
+            m_captureSlot.m_sequenceNumber = m_numOfCapturedFrames++;
+
+            pushCapturedFrame();
+
+            notifyNewFrame();
+        }
+        else
+        {
+            // The capturing device got
+            // disconnected, so we stop
+            // this capturing thread
+
+            signalCapturingThreadToTerminate();
+        }
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoThread3::waitUntilRingHasRoom()
+{
+    std::unique_lock<std::mutex> lock(m_stateMutex);
+
+    if(m_areFramesToBePreallocated)
+    {
+        preallocateFrames();
+        m_areFramesToBePreallocated = false;
+    }
+
+    m_stateChanged.wait(lock,[this]()
+    {
+        return ( m_isCapturingThreadToBeTerminated ||
+                 m_dropPolicy != BL_BLOCK_WHEN_FULL ||
+                 m_numOfQueuedFrames < int(m_ring.size()) );
+    });
+
+    return !m_isCapturingThreadToBeTerminated;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blVideoThread3::pushCapturedFrame()
+{
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+    int ringSize = int(m_ring.size());
+
+    if(m_numOfQueuedFrames == ringSize)
+    {
+        ++m_numOfDroppedFrames;
+
+        // When dropping the newest
+        // frame, the capture slot is
+        // simply reused for the next one
+
+        if(m_dropPolicy == BL_DROP_NEWEST_FRAME)
+            return;
+
+        // Otherwise the oldest frame
+        // is dropped, which also covers
+        // a blocking ring that filled up
+        // while the policy was changed
+
+        m_oldestFrameIndex = (m_oldestFrameIndex + 1) % ringSize;
+        --m_numOfQueuedFrames;
+    }
+
+    // The captured frame takes the
+    // free slot after the newest
+    // frame, whose old frame becomes
+    // the new capture slot
+
+    std::swap(m_ring[(m_oldestFrameIndex + m_numOfQueuedFrames) % ringSize],m_captureSlot);
+
+    ++m_numOfQueuedFrames;
+    m_isNewFrameAvailable = true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoThread3::waitForNewFrame(const int& timeoutInMilliseconds)const
+{
+    return waitForFrames(1,timeoutInMilliseconds);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoThread3::waitForFrames(const int& numOfFrames,
+                                          const int& timeoutInMilliseconds)const
+{
+    // The predicate is evaluated
+    // with the state mutex held
+
+    return blVideoThread::waitForNewFrame(timeoutInMilliseconds,[this,numOfFrames]()
+    {
+        return ( m_numOfQueuedFrames >= std::min(numOfFrames,int(m_ring.size())) );
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoThread3::popQueuedFrames(std::vector<blTimestampedFrame>& frames,
+                                           const int& numOfFrames)
+{
+    int ringSize = int(m_ring.size());
+
+    if(int(frames.size()) < numOfFrames)
+        frames.resize(numOfFrames);
+
+    for(int i = 0; i < numOfFrames; ++i)
+    {
+        std::swap(frames[i],m_ring[m_oldestFrameIndex]);
+
+        m_oldestFrameIndex = (m_oldestFrameIndex + 1) % ringSize;
+    }
+
+    m_numOfQueuedFrames -= numOfFrames;
+    m_isNewFrameAvailable = (m_numOfQueuedFrames > 0);
+
+    return numOfFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline bool blVideoThread3::popOldestFrame(blTimestampedFrame& frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        if(m_numOfQueuedFrames == 0)
+            return false;
+
+        std::swap(frame,m_ring[m_oldestFrameIndex]);
+
+        m_oldestFrameIndex = (m_oldestFrameIndex + 1) % int(m_ring.size());
+        --m_numOfQueuedFrames;
+        m_isNewFrameAvailable = (m_numOfQueuedFrames > 0);
+    }
+
+    // Wake up the capturing thread
+    // in case it's waiting for room
+
+    m_stateChanged.notify_all();
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoThread3::popFrames(std::vector<blTimestampedFrame>& frames,
+                                     const int& maxNumOfFrames)
+{
+    int numOfPoppedFrames = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        int numOfFrames = m_numOfQueuedFrames;
+
+        if(maxNumOfFrames >= 0)
+            numOfFrames = std::min(numOfFrames,maxNumOfFrames);
+
+        numOfPoppedFrames = popQueuedFrames(frames,numOfFrames);
+    }
+
+    m_stateChanged.notify_all();
+
+    return numOfPoppedFrames;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline int blVideoThread3::popNewestFrames(std::vector<blTimestampedFrame>& frames,
+                                           const int& numOfFrames)
+{
+    int numOfPoppedFrames = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        // The frames older than the
+        // newest ones are skipped
+        // without being touched
+
+        int numOfOlderFrames = std::max(0,m_numOfQueuedFrames - std::max(0,numOfFrames));
+
+        m_oldestFrameIndex = (m_oldestFrameIndex + numOfOlderFrames) % int(m_ring.size());
+        m_numOfQueuedFrames -= numOfOlderFrames;
+        m_numOfSkippedFrames += numOfOlderFrames;
+
+        int numOfNewestFrames = m_numOfQueuedFrames;
+
+        numOfPoppedFrames = popQueuedFrames(frames,numOfNewestFrames);
+    }
+
+    m_stateChanged.notify_all();
+
+    return numOfPoppedFrames;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_VIDEOTHREAD3_HPP